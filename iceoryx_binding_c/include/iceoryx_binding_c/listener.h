@@ -35,6 +35,15 @@ typedef IOX_C_CLASS Listener* iox_listener_t;
 /// @return an initialized iox_listener_t
 iox_listener_t iox_listener_init(iox_listener_storage_t* self);
 
+/// @brief initializes a listener struct from a storage struct pointer whose callbacks are executed by a pool of
+/// worker threads
+/// @param[in] self pointer to raw memory which can hold a listener
+/// @param[in] numberOfCallbackWorkers the number of worker threads which execute the callbacks; with 0 the callbacks
+/// are executed by the thread which waits for the events, like with iox_listener_init
+/// @return an initialized iox_listener_t
+iox_listener_t iox_listener_init_with_callback_workers(iox_listener_storage_t* self,
+                                                       const uint32_t numberOfCallbackWorkers);
+
 /// @brief after using an iox_listener_t it must be cleaned up with this function
 /// @param[in] self the listener which should be deinitialized
 void iox_listener_deinit(iox_listener_t const self);
@@ -43,6 +43,17 @@ typedef struct
     /// @brief describes whether a publisher blocks when subscriber queue is full
     enum iox_ConsumerTooSlowPolicy subscriberTooSlowPolicy;
 
+    /// @brief number of chunks which are acquired at once from the mempool and cached for this publisher; 0 disables
+    /// the cache
+    uint32_t chunkCacheSize;
+
+    /// @brief stamps the send time behind the user-payload to let the subscribers record the latency
+    bool stampSendTimestamp;
+
+    /// @brief NUMA node of the writable segment the chunks are loaned from; IOX_C_NUMA_NODE_OF_CALLING_THREAD uses
+    /// the node of the thread which creates the publisher and IOX_C_NO_NUMA_NODE_PREFERENCE the default segment
+    uint32_t preferredNumaNode;
+
     /// @brief this value will be set exclusively by 'iox_pub_options_init' and is not supposed to be modified otherwise
     uint64_t initCheck;
 } iox_pub_options_t;
@@ -128,6 +139,13 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief sends previously allocated chunks in order; the subscribers are notified once per batch instead of once per
+/// chunk
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array of pointers to the user-payloads of the chunks which should be send
+/// @param[in] numberOfUserPayloads number of entries in userPayloads
+void iox_pub_publish_batch(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfUserPayloads);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
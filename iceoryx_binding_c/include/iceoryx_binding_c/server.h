@@ -44,6 +44,9 @@ typedef struct
     /// @brief Sets whether the server blocks when the client response queue is full
     enum iox_ConsumerTooSlowPolicy clientTooSlowPolicy;
 
+    /// @brief Allows multiple threads to take requests and to loan, send and release responses concurrently
+    bool concurrentRequestProcessing;
+
     /// @brief this value will be set exclusively by 'iox_server_options_init' and is not supposed to be modified
     /// otherwise
     uint64_t initCheck;
@@ -51,6 +51,9 @@ typedef struct
     ///        not be connected to the publisher.
     bool requirePublisherHistorySupport;
 
+    /// @brief records the latency of the received chunks which carry a send timestamp for the port introspection
+    bool recordLatency;
+
     /// @brief this value will be set exclusively by iox_sub_options_init and is not supposed to be modified otherwise
     uint64_t initCheck;
 } iox_sub_options_t;
@@ -107,7 +110,32 @@ enum iox_SubscribeState iox_sub_get_subscription_state(iox_sub_t const self);
 ///         an enum which describes the error
 enum iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** const userPayload);
 
-/// @brief release a previously acquired chunk (via iox_sub_take_chunk)
+/// @brief retrieve multiple received chunks at once
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array in which the pointers to the user-payloads of the chunks are stored
+/// @param[in] userPayloadsCapacity size of the userPayloads array and therefore the maximum number of chunks to take
+/// @param[in] numberOfTakenChunks pointer in which the number of chunks taken is stored
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error
+enum iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                                const void** const userPayloads,
+                                                const uint64_t userPayloadsCapacity,
+                                                uint64_t* const numberOfTakenChunks);
+
+/// @brief retrieve all received chunks and call the callback with each of them
+/// @param[in] self handle to the subscriber
+/// @param[in] callback is called with the pointer to the user-payload of each chunk taken and the contextData; it is
+///            allowed to release the chunk with iox_sub_release_chunk
+/// @param[in] contextData a void pointer which is provided as second argument to the callback
+/// @param[in] numberOfTakenChunks pointer in which the number of chunks taken is stored
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error
+enum iox_ChunkReceiveResult iox_sub_take_all_chunks(iox_sub_t const self,
+                                                    void (*callback)(const void*, void*),
+                                                    void* const contextData,
+                                                    uint64_t* const numberOfTakenChunks);
+
+/// @brief release a previously acquired chunk (via iox_sub_take_chunk, iox_sub_take_chunks or iox_sub_take_all_chunks)
 /// @param[in] self handle to the subscriber
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload);
@@ -23,6 +23,8 @@
 #define IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT 8
 #define IOX_C_CHUNK_NO_USER_HEADER_SIZE 0
 #define IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT 1
+#define IOX_C_NO_NUMA_NODE_PREFERENCE 0xFFFFFFFFU
+#define IOX_C_NUMA_NODE_OF_CALLING_THREAD 0xFFFFFFFEU
 
 /// The issue iox-308: https://github.com/eclipse-iceoryx/iceoryx/issues/308
 /// was created to explore other options then a magic number to create
@@ -43,6 +43,16 @@ iox_listener_t iox_listener_init(iox_listener_storage_t* self)
     return me;
 }
 
+iox_listener_t iox_listener_init_with_callback_workers(iox_listener_storage_t* self,
+                                                       const uint32_t numberOfCallbackWorkers)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+
+    auto* me = new Listener(numberOfCallbackWorkers);
+    self->do_not_touch_me[0] = reinterpret_cast<uint64_t>(me);
+    return me;
+}
+
 void iox_listener_deinit(iox_listener_t const self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/assertions.hpp"
 #include "iox/logging.hpp"
+#include "iox/vector.hpp"
 
 using namespace iox;
 using namespace iox::popo;
@@ -37,6 +38,11 @@ extern "C" {
 
 constexpr uint64_t PUBLISHER_OPTIONS_INIT_CHECK_CONSTANT = 123454321;
 
+static_assert(IOX_C_NO_NUMA_NODE_PREFERENCE == PublisherOptions::NO_NUMA_NODE_PREFERENCE,
+              "the C and C++ constants for no NUMA node preference differ");
+static_assert(IOX_C_NUMA_NODE_OF_CALLING_THREAD == PublisherOptions::NUMA_NODE_OF_CALLING_THREAD,
+              "the C and C++ constants for the NUMA node of the calling thread differ");
+
 void iox_pub_options_init(iox_pub_options_t* options)
 {
     if (options == nullptr)
@@ -50,6 +56,9 @@ void iox_pub_options_init(iox_pub_options_t* options)
     options->nodeName = nullptr;
     options->offerOnCreate = publisherOptions.offerOnCreate;
     options->subscriberTooSlowPolicy = cpp2c::consumerTooSlowPolicy(publisherOptions.subscriberTooSlowPolicy);
+    options->chunkCacheSize = publisherOptions.chunkCacheSize;
+    options->stampSendTimestamp = publisherOptions.stampSendTimestamp;
+    options->preferredNumaNode = publisherOptions.preferredNumaNode;
 
     options->initCheck = PUBLISHER_OPTIONS_INIT_CHECK_CONSTANT;
 }
@@ -90,6 +99,9 @@ iox_pub_t iox_pub_init(iox_pub_storage_t* self,
         }
         publisherOptions.offerOnCreate = options->offerOnCreate;
         publisherOptions.subscriberTooSlowPolicy = c2cpp::consumerTooSlowPolicy(options->subscriberTooSlowPolicy);
+        publisherOptions.chunkCacheSize = options->chunkCacheSize;
+        publisherOptions.stampSendTimestamp = options->stampSendTimestamp;
+        publisherOptions.preferredNumaNode = options->preferredNumaNode;
     }
 
     auto* me = new cpp2c_Publisher();
@@ -168,6 +180,31 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_pub_publish_batch(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfUserPayloads)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr || numberOfUserPayloads == 0U, "'userPayloads' must not be a 'nullptr'");
+
+    PublisherPortUser port(self->m_portData);
+    vector<ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (uint64_t i = 0U; i < numberOfUserPayloads; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) C API with array and size
+        void* const userPayload = userPayloads[i];
+        IOX_ENFORCE(userPayload != nullptr, "'userPayloads' must not contain a 'nullptr'");
+        chunkHeaders.emplace_back(ChunkHeader::fromUserPayload(userPayload));
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port.sendChunks(span<ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+    }
+    if (!chunkHeaders.empty())
+    {
+        port.sendChunks(span<ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+    }
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
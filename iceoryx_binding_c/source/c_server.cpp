@@ -42,6 +42,7 @@ void iox_server_options_init(iox_server_options_t* const options)
     options->offerOnCreate = serverOptions.offerOnCreate;
     options->requestQueueFullPolicy = cpp2c::queueFullPolicy(serverOptions.requestQueueFullPolicy);
     options->clientTooSlowPolicy = cpp2c::consumerTooSlowPolicy(serverOptions.clientTooSlowPolicy);
+    options->concurrentRequestProcessing = serverOptions.concurrentRequestProcessing;
     options->initCheck = SERVER_OPTIONS_INIT_CHECK_CONSTANT;
 }
 
@@ -73,6 +74,7 @@ iox_server_t iox_server_init(iox_server_storage_t* self,
         serverOptions.offerOnCreate = options->offerOnCreate;
         serverOptions.requestQueueFullPolicy = c2cpp::queueFullPolicy(options->requestQueueFullPolicy);
         serverOptions.clientTooSlowPolicy = c2cpp::consumerTooSlowPolicy(options->clientTooSlowPolicy);
+        serverOptions.concurrentRequestProcessing = options->concurrentRequestProcessing;
     }
 
     auto* me = new UntypedServer(ServiceDescription{IdString_t(TruncateToCapacity, service),
@@ -24,8 +24,10 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/assertions.hpp"
 #include "iox/logging.hpp"
+#include "iox/vector.hpp"
 
 using namespace iox;
 using namespace iox::popo;
@@ -61,6 +63,7 @@ void iox_sub_options_init(iox_sub_options_t* options)
     options->subscribeOnCreate = subscriberOptions.subscribeOnCreate;
     options->queueFullPolicy = cpp2c::queueFullPolicy(subscriberOptions.queueFullPolicy);
     options->requirePublisherHistorySupport = false;
+    options->recordLatency = subscriberOptions.recordLatency;
 
     options->initCheck = SUBSCRIBER_OPTIONS_INIT_CHECK_CONSTANT;
 }
@@ -103,6 +106,7 @@ iox_sub_t iox_sub_init(iox_sub_storage_t* self,
         subscriberOptions.subscribeOnCreate = options->subscribeOnCreate;
         subscriberOptions.queueFullPolicy = c2cpp::queueFullPolicy(options->queueFullPolicy);
         subscriberOptions.requiresPublisherHistorySupport = options->requirePublisherHistorySupport;
+        subscriberOptions.recordLatency = options->recordLatency;
     }
 
     // this is required for CycloneDDS to limit the fallout of our change to use the heap for storage
@@ -165,6 +169,78 @@ iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** con
     return ChunkReceiveResult_SUCCESS;
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                           const void** const userPayloads,
+                                           const uint64_t userPayloadsCapacity,
+                                           uint64_t* const numberOfTakenChunks)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr, "'userPayloads' must not be a 'nullptr'");
+    IOX_ENFORCE(numberOfTakenChunks != nullptr, "'numberOfTakenChunks' must not be a 'nullptr'");
+
+    *numberOfTakenChunks = 0U;
+    auto result = SubscriberPortUser(self->m_portData)
+                      .tryGetChunks(userPayloadsCapacity, [&](const ChunkHeader* chunkHeader) {
+                          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounded by the capacity
+                          userPayloads[*numberOfTakenChunks] = chunkHeader->userPayload();
+                          ++(*numberOfTakenChunks);
+                      });
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.error());
+    }
+
+    return ChunkReceiveResult_SUCCESS;
+}
+
+iox_ChunkReceiveResult iox_sub_take_all_chunks(iox_sub_t const self,
+                                               void (*callback)(const void*, void*),
+                                               void* const contextData,
+                                               uint64_t* const numberOfTakenChunks)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(callback != nullptr, "'callback' must not be a 'nullptr'");
+    IOX_ENFORCE(numberOfTakenChunks != nullptr, "'numberOfTakenChunks' must not be a 'nullptr'");
+
+    // the chunks are taken batch-wise and handed to the callback once their batch was taken, therefore the callback
+    // is allowed to release them; at most MAX_SUBSCRIBER_QUEUE_CAPACITY chunks are taken to prevent that a fast
+    // publisher keeps the caller busy forever
+    constexpr uint64_t TAKE_ALL_BATCH_SIZE{64U};
+    vector<const void*, TAKE_ALL_BATCH_SIZE> userPayloads;
+    SubscriberPortUser port(self->m_portData);
+    *numberOfTakenChunks = 0U;
+    while (*numberOfTakenChunks < MAX_SUBSCRIBER_QUEUE_CAPACITY)
+    {
+        const auto maxNumberOfChunks =
+            algorithm::minVal(TAKE_ALL_BATCH_SIZE, MAX_SUBSCRIBER_QUEUE_CAPACITY - *numberOfTakenChunks);
+        auto result = port.tryGetChunks(maxNumberOfChunks, [&](const ChunkHeader* chunkHeader) {
+            userPayloads.push_back(chunkHeader->userPayload());
+        });
+        if (result.has_error())
+        {
+            if (*numberOfTakenChunks == 0U)
+            {
+                return cpp2c::chunkReceiveResult(result.error());
+            }
+            break;
+        }
+
+        for (auto userPayload : userPayloads)
+        {
+            callback(userPayload, contextData);
+        }
+        userPayloads.clear();
+
+        *numberOfTakenChunks += result.value();
+        if (result.value() < maxNumberOfChunks)
+        {
+            break;
+        }
+    }
+
+    return ChunkReceiveResult_SUCCESS;
+}
+
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -343,6 +343,31 @@ TEST_F(iox_pub_test, sendDeliversChunk)
     EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711);
 }
 
+TEST_F(iox_pub_test, publishBatchDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5664649-a745-46ec-90c2-1a7073704905");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS];
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunk(&m_sut, &chunks[i], 100));
+        static_cast<DummySample*>(chunks[i])->dummy = 4711 + i;
+    }
+    iox_pub_publish_batch(&m_sut, chunks, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_TRUE(*maybeSharedChunk == chunks[i]);
+        EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711 + i);
+    }
+    EXPECT_FALSE(m_chunkQueuePopper.tryPop().has_value());
+}
+
 TEST_F(iox_pub_test, correctServiceDescriptionReturned)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4f91cb12-fbfa-4bad-ad59-ab2579f83fbe");
@@ -375,6 +400,19 @@ TEST_F(iox_pub_test, pubPublishChunckWithNullptr)
     IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunk(&m_sut, nullptr); }, iox::er::ENFORCE_VIOLATION);
 }
 
+TEST_F(iox_pub_test, pubPublishBatchWithNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e7d374f-44f9-4373-b464-6a3f6b252989");
+    void* chunks[] = {nullptr};
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+    iox_pub_loan_chunk(&m_sut, &chunks[0], 100);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_batch(nullptr, chunks, 1U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_batch(&m_sut, nullptr, 1U); }, iox::er::ENFORCE_VIOLATION);
+    chunks[0] = nullptr;
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_batch(&m_sut, chunks, 1U); }, iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_pub_test, pubOfferWithNullptr)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5588dacf-6e6c-44c6-835d-1dfeb03ff2c1");
@@ -424,6 +462,9 @@ TEST(iox_pub_options_test, publisherOptionsAreInitializedCorrectly)
     sut.nodeName = "Dr.Gonzo";
     sut.offerOnCreate = false;
     sut.subscriberTooSlowPolicy = ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER;
+    sut.chunkCacheSize = 73;
+    sut.stampSendTimestamp = true;
+    sut.preferredNumaNode = 2U;
 
     PublisherOptions options;
     // set offerOnCreate to the opposite of the expected default to check if it gets overwritten to default
@@ -434,6 +475,9 @@ TEST(iox_pub_options_test, publisherOptionsAreInitializedCorrectly)
     EXPECT_EQ(sut.nodeName, nullptr);
     EXPECT_EQ(sut.offerOnCreate, options.offerOnCreate);
     EXPECT_EQ(sut.subscriberTooSlowPolicy, cpp2c::consumerTooSlowPolicy(options.subscriberTooSlowPolicy));
+    EXPECT_EQ(sut.chunkCacheSize, options.chunkCacheSize);
+    EXPECT_EQ(sut.stampSendTimestamp, options.stampSendTimestamp);
+    EXPECT_EQ(sut.preferredNumaNode, options.preferredNumaNode);
     EXPECT_TRUE(iox_pub_options_is_initialized(&sut));
 }
 
@@ -86,7 +86,8 @@ class iox_server_test : public Test
 
     void connectClient()
     {
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&clientResponseQueueData);
+        ChunkSender<ServerChunkSenderData_t> chunkSender{&sutPort->m_chunkSenderData};
+        EXPECT_FALSE(chunkSender.tryAddQueue(&clientResponseQueueData).has_error());
     }
 
     void prepareServerInit(const ServerOptions& options = ServerOptions())
@@ -160,6 +161,7 @@ TEST_F(iox_server_test, initializedOptionsToCPPDefaults)
                 Eq(cpp2c::queueFullPolicy(cppOptions.requestQueueFullPolicy)));
     EXPECT_THAT(initializedOptions.clientTooSlowPolicy,
                 Eq(cpp2c::consumerTooSlowPolicy(cppOptions.clientTooSlowPolicy)));
+    EXPECT_THAT(initializedOptions.concurrentRequestProcessing, Eq(cppOptions.concurrentRequestProcessing));
 }
 
 TEST_F(iox_server_test, InitializingServerWithNullptrOptionsGetsMiddlewareServerWithDefaultOptions)
@@ -183,6 +185,7 @@ TEST_F(iox_server_test, InitializingServerWithCustomOptionsWorks)
     options.offerOnCreate = false;
     options.requestQueueFullPolicy = QueueFullPolicy_BLOCK_PRODUCER;
     options.clientTooSlowPolicy = ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER;
+    options.concurrentRequestProcessing = true;
 
     ServerOptions cppOptions;
     cppOptions.requestQueueCapacity = options.requestQueueCapacity;
@@ -190,6 +193,7 @@ TEST_F(iox_server_test, InitializingServerWithCustomOptionsWorks)
     cppOptions.offerOnCreate = options.offerOnCreate;
     cppOptions.requestQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     cppOptions.clientTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    cppOptions.concurrentRequestProcessing = options.concurrentRequestProcessing;
 
     prepareServerInit(cppOptions);
 
@@ -288,6 +288,152 @@ TEST_F(iox_sub_test, receiveChunkWhenToManyChunksAreHold)
     EXPECT_EQ(iox_sub_take_chunk(m_sut, &chunk), ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
 }
 
+TEST_F(iox_sub_test, takeChunksWhenThereAreNoneReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f83baf37-aede-424c-a3f6-d3c886603bd8");
+    const void* chunks[2U] = {nullptr, nullptr};
+    uint64_t numberOfTakenChunks{1U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfTakenChunks), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfTakenChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksReceivesAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8e75f1f-3120-4b1b-8d0f-10832411b3f5");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        *static_cast<uint64_t*>(sharedChunk.getUserPayload()) = i;
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS + 1U] = {nullptr, nullptr, nullptr, nullptr};
+    uint64_t numberOfTakenChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS + 1U, &numberOfTakenChunks),
+              ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfTakenChunks, Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunks[i]), Eq(i));
+    }
+    EXPECT_THAT(chunks[NUMBER_OF_CHUNKS], Eq(nullptr));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(iox_sub_test, takeChunksIsLimitedByTheCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2530a656-03a8-4db1-a0e1-6595f64cc77d");
+    this->Subscribe(&m_portPtr);
+    m_chunkPusher.push(getChunkFromMemoryManager());
+    m_chunkPusher.push(getChunkFromMemoryManager());
+    m_chunkPusher.push(getChunkFromMemoryManager());
+
+    const void* chunks[2U] = {nullptr, nullptr};
+    uint64_t numberOfTakenChunks{0U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfTakenChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfTakenChunks, Eq(2U));
+
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfTakenChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfTakenChunks, Eq(1U));
+}
+
+TEST_F(iox_sub_test, takeChunksWhenTooManyChunksAreHeldDoesNotDropTheQueuedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3b7d44f-da6c-4fcf-b5eb-f9043cf27d9b");
+    this->Subscribe(&m_portPtr);
+    const void* chunk = nullptr;
+    for (uint64_t i = 0U; i < MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+        ASSERT_EQ(iox_sub_take_chunk(m_sut, &chunk), ChunkReceiveResult_SUCCESS);
+    }
+
+    m_chunkPusher.push(getChunkFromMemoryManager());
+    const void* chunks[2U] = {nullptr, nullptr};
+    uint64_t numberOfTakenChunks{0U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfTakenChunks),
+              ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    EXPECT_THAT(numberOfTakenChunks, Eq(0U));
+
+    iox_sub_release_chunk(m_sut, chunk);
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfTakenChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfTakenChunks, Eq(1U));
+}
+
+TEST_F(iox_sub_test, takeAllChunksWhenThereAreNoneReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08103815-de38-4251-998c-0b4ac01fea4c");
+    uint64_t numberOfCallbacks{0U};
+    uint64_t numberOfTakenChunks{1U};
+    EXPECT_EQ(iox_sub_take_all_chunks(
+                  m_sut,
+                  [](const void*, void* contextData) { ++(*static_cast<uint64_t*>(contextData)); },
+                  &numberOfCallbacks,
+                  &numberOfTakenChunks),
+              ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfTakenChunks, Eq(0U));
+    EXPECT_THAT(numberOfCallbacks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeAllChunksCallsTheCallbackWithAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6645d6ee-0c25-472b-87c0-d29599d3135e");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        *static_cast<uint64_t*>(sharedChunk.getUserPayload()) = i;
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    std::vector<uint64_t> receivedValues;
+    uint64_t numberOfTakenChunks{0U};
+    ASSERT_EQ(iox_sub_take_all_chunks(
+                  m_sut,
+                  [](const void* userPayload, void* contextData) {
+                      static_cast<std::vector<uint64_t>*>(contextData)->push_back(
+                          *static_cast<const uint64_t*>(userPayload));
+                  },
+                  &receivedValues,
+                  &numberOfTakenChunks),
+              ChunkReceiveResult_SUCCESS);
+
+    EXPECT_THAT(numberOfTakenChunks, Eq(NUMBER_OF_CHUNKS));
+    ASSERT_THAT(receivedValues.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(receivedValues[i], Eq(i));
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(iox_sub_test, takeAllChunksCallbackCanReleaseTheChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e560c250-decb-45bc-8109-61ecdd90a4bc");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+    }
+
+    uint64_t numberOfTakenChunks{0U};
+    EXPECT_EQ(iox_sub_take_all_chunks(
+                  m_sut,
+                  [](const void* userPayload, void* contextData) {
+                      iox_sub_release_chunk(static_cast<iox_sub_t>(contextData), userPayload);
+                  },
+                  m_sut,
+                  &numberOfTakenChunks),
+              ChunkReceiveResult_SUCCESS);
+
+    EXPECT_THAT(numberOfTakenChunks, Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, releaseChunkWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "53619897-cad8-4377-a877-4ec6971308fa");
@@ -471,6 +617,18 @@ TEST_F(iox_sub_test, subscriberTakeChunkWithNullptrFails)
     IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunk(nullptr, &chunk); }, iox::er::ENFORCE_VIOLATION);
 }
 
+TEST_F(iox_sub_test, subscriberTakeChunksWithNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b497efed-43ab-4f35-8d44-851fbb3806a7");
+    const void* chunks[1U] = {nullptr};
+    uint64_t numberOfTakenChunks{0U};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(nullptr, chunks, 1U, &numberOfTakenChunks); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(m_sut, nullptr, 1U, &numberOfTakenChunks); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(m_sut, chunks, 1U, nullptr); }, iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_sub_test, subReleaseChunkWithNullptrFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "425c9e6c-5211-4f35-b1d9-408e328757d0");
@@ -518,6 +676,7 @@ TEST(iox_sub_options_test, subscriberOptionsAreInitializedCorrectly)
     sut.nodeName = "Dr.Gonzo";
     sut.subscribeOnCreate = false;
     sut.queueFullPolicy = QueueFullPolicy_BLOCK_PRODUCER;
+    sut.recordLatency = true;
 
     SubscriberOptions options;
     // set subscribeOnCreate to the opposite of the expected default to check if it gets overwritten to default
@@ -529,6 +688,7 @@ TEST(iox_sub_options_test, subscriberOptionsAreInitializedCorrectly)
     EXPECT_EQ(sut.nodeName, nullptr);
     EXPECT_EQ(sut.subscribeOnCreate, options.subscribeOnCreate);
     EXPECT_EQ(sut.queueFullPolicy, cpp2c::queueFullPolicy(options.queueFullPolicy));
+    EXPECT_EQ(sut.recordLatency, options.recordLatency);
     EXPECT_TRUE(iox_sub_options_is_initialized(&sut));
 }
 
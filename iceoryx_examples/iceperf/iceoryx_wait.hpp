@@ -23,6 +23,11 @@ class IceoryxWait : public Iceoryx
   public:
     IceoryxWait(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
 
+    /// @brief the WaitSet polls for the samples for the given spin duration before it blocks
+    IceoryxWait(const iox::capro::IdString_t& publisherName,
+                const iox::capro::IdString_t& subscriberName,
+                const iox::units::Duration spinDuration) noexcept;
+
   private:
     void init() noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
@@ -128,6 +128,14 @@ int IcePerfFollower::run() noexcept
         doMeasurement(iceoryxwait);
     }
 
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_WAIT_SPIN_API)
+    {
+        std::cout << std::endl << "**** ICEORYX WAITSET SPIN ********" << std::endl;
+        IceoryxWait iceoryxwait(
+            PUBLISHER, SUBSCRIBER, iox::units::Duration::fromMicroseconds(m_settings.spinDurationInMicroseconds));
+        doMeasurement(iceoryxwait);
+    }
+
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
@@ -33,10 +33,11 @@ int main(int argc, char* argv[])
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
                                       {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"spin-duration", required_argument, nullptr, 's'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:s:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -54,6 +55,7 @@ int main(int argc, char* argv[])
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
             std::cout << "                                          iceoryx-cpp-waitset-api," << std::endl;
+            std::cout << "                                          iceoryx-cpp-waitset-spin-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
@@ -61,6 +63,10 @@ int main(int argc, char* argv[])
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-s, --spin-duration <N>           Set the time in microseconds the WaitSet polls before it"
+                      << std::endl;
+            std::cout << "                                  blocks with 'iceoryx-cpp-waitset-spin-api'" << std::endl;
+            std::cout << "                                  default = '100'" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -95,6 +101,10 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_CPP_WAIT_API;
             }
+            else if (strcmp(optarg, "iceoryx-cpp-waitset-spin-api") == 0)
+            {
+                settings.technology = Technology::ICEORYX_CPP_WAIT_SPIN_API;
+            }
             else if (strcmp(optarg, "iceoryx-c-api") == 0)
             {
                 settings.technology = Technology::ICEORYX_C_API;
@@ -109,8 +119,9 @@ int main(int argc, char* argv[])
             }
             else
             {
-                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-cpp-waitset-api', "
+                             "'iceoryx-cpp-waitset-spin-api', 'iceoryx-c-api', 'posix-message-queue' and "
+                             "'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -126,6 +137,17 @@ int main(int argc, char* argv[])
             settings.numberOfSamples = result.value();
             break;
         }
+        case 's':
+        {
+            auto result = iox::convert::from_string<uint64_t>(optarg);
+            if (!result.has_value())
+            {
+                std::cerr << "Could not parse 'spin-duration' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            settings.spinDurationInMicroseconds = result.value();
+            break;
+        }
         default:
             return EXIT_FAILURE;
         };
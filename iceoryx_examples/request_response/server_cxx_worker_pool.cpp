@@ -0,0 +1,156 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//! [iceoryx includes]
+#include "request_and_response_types.hpp"
+
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/server.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/signal_watcher.hpp"
+//! [iceoryx includes]
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+constexpr char APP_NAME[] = "iox-cpp-request-response-server-worker-pool";
+
+//! [request signal]
+// wakes up the idle workers; the generation ensures that no request is missed between taking the last request and
+// going to sleep
+class RequestSignal
+{
+  public:
+    void notifyAll()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_generation;
+        }
+        m_condition.notify_all();
+    }
+
+    uint64_t generation()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_generation;
+    }
+
+    void waitForNextGeneration(const uint64_t generation, const std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait_for(lock, timeout, [&] { return m_generation != generation; });
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    uint64_t m_generation{0U};
+};
+//! [request signal]
+
+//! [request callback]
+void onRequestReceived(iox::popo::Server<AddRequest, AddResponse>*, RequestSignal* requestSignal)
+{
+    requestSignal->notifyAll();
+}
+//! [request callback]
+
+//! [worker]
+void worker(const uint32_t workerId, iox::popo::Server<AddRequest, AddResponse>& server, RequestSignal& requestSignal)
+{
+    while (!iox::hasTerminationRequested())
+    {
+        const auto generation = requestSignal.generation();
+
+        //! [take request]
+        while (server.take().and_then([&](const auto& request) {
+            server.loan(request)
+                .and_then([&](auto& response) {
+                    response->sum = request->augend + request->addend;
+                    std::stringstream message;
+                    message << APP_NAME << " Worker " << workerId << " Send Response: " << request->augend << " + "
+                            << request->addend << " = " << response->sum << "\n";
+                    std::cout << message.str() << std::flush;
+                    response.send().or_else(
+                        [&](auto& error) { std::cout << "Could not send Response! Error: " << error << std::endl; });
+                })
+                .or_else(
+                    [](auto& error) { std::cout << "Could not allocate Response! Error: " << error << std::endl; });
+        }))
+        {
+        }
+        //! [take request]
+
+        // the timeout lets the worker check for the termination request
+        constexpr std::chrono::milliseconds WAKEUP_TIMEOUT{100};
+        requestSignal.waitForNextGeneration(generation, WAKEUP_TIMEOUT);
+    }
+}
+//! [worker]
+
+int main()
+{
+    //! [initialize runtime]
+    iox::runtime::PoshRuntime::initRuntime(APP_NAME);
+    //! [initialize runtime]
+
+    //! [create server]
+    iox::popo::ServerOptions options;
+    options.requestQueueCapacity = 10U;
+    options.concurrentRequestProcessing = true;
+    iox::popo::Server<AddRequest, AddResponse> server({"Example", "Request-Response", "Add"}, options);
+    //! [create server]
+
+    //! [attach listener]
+    RequestSignal requestSignal;
+    iox::popo::Listener listener;
+    listener
+        .attachEvent(server,
+                     iox::popo::ServerEvent::REQUEST_RECEIVED,
+                     iox::popo::createNotificationCallback(onRequestReceived, requestSignal))
+        .or_else([](auto) {
+            std::cerr << "unable to attach server" << std::endl;
+            std::exit(EXIT_FAILURE);
+        });
+    //! [attach listener]
+
+    //! [start workers]
+    // every worker holds up to one request at a time
+    constexpr uint32_t NUMBER_OF_WORKERS{iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY};
+    std::vector<std::thread> workers;
+    for (uint32_t workerId = 0U; workerId < NUMBER_OF_WORKERS; ++workerId)
+    {
+        workers.emplace_back([&, workerId] { worker(workerId, server, requestSignal); });
+    }
+    //! [start workers]
+
+    //! [cleanup]
+    for (auto& workerThread : workers)
+    {
+        workerThread.join();
+    }
+    listener.detachEvent(server, iox::popo::ServerEvent::REQUEST_RECEIVED);
+    //! [cleanup]
+
+    return EXIT_SUCCESS;
+}
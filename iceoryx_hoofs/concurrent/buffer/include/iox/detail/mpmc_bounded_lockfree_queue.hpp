@@ -0,0 +1,97 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX_HOOFS_CONCURRENT_BUFFER_MPMC_BOUNDED_LOCKFREE_QUEUE_HPP
+#define IOX_HOOFS_CONCURRENT_BUFFER_MPMC_BOUNDED_LOCKFREE_QUEUE_HPP
+
+#include "iox/detail/mpmc_lockfree_queue.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief implements a lock free queue (i.e. container with FIFO order) of elements of type T
+/// with a capacity between 0 and MaxCapacity. Unlike the MpmcResizeableLockFreeQueue, the capacity
+/// can only be set while the queue is empty and not used concurrently, e.g. right after construction.
+/// Afterwards the capacity is fixed, therefore the queue needs neither a resize flag nor a bookkeeping
+/// of the unused indices and push and pop are as cheap as the ones of the MpmcLockFreeQueue.
+
+// Remark: The indices above the capacity are not in the free index queue and therefore never used.
+// We use protected inheritance to make the base class methods inaccessible for the user.
+template <typename ElementType, uint64_t MaxCapacity>
+class MpmcBoundedLockFreeQueue : protected MpmcLockFreeQueue<ElementType, MaxCapacity>
+{
+  private:
+    using Base = MpmcLockFreeQueue<ElementType, MaxCapacity>;
+
+  public:
+    using element_t = ElementType;
+    static constexpr uint64_t MAX_CAPACITY = MaxCapacity;
+
+    MpmcBoundedLockFreeQueue() noexcept = default;
+    ~MpmcBoundedLockFreeQueue() noexcept = default;
+
+    MpmcBoundedLockFreeQueue(const MpmcBoundedLockFreeQueue&) = delete;
+    MpmcBoundedLockFreeQueue(MpmcBoundedLockFreeQueue&&) = delete;
+    MpmcBoundedLockFreeQueue& operator=(const MpmcBoundedLockFreeQueue&) = delete;
+    MpmcBoundedLockFreeQueue& operator=(MpmcBoundedLockFreeQueue&&) = delete;
+
+    /// @brief returns the maximum capacity of the queue
+    /// @return the maximum capacity
+    static constexpr uint64_t maxCapacity() noexcept;
+
+    using Base::empty;
+    using Base::pop;
+    using Base::size;
+    using Base::tryPush;
+
+    /// @brief returns the capacity of the queue
+    /// @return the capacity
+    /// @note threadsafe, lockfree
+    uint64_t capacity() const noexcept;
+
+    /// @brief inserts value in FIFO order, always succeeds by removing the oldest value
+    /// when the queue is detected to be full (overflow)
+    /// @param[in] value to be inserted is copied into the queue
+    /// @return removed value if an overflow occured, empty optional otherwise
+    /// @note threadsafe, lockfree
+    iox::optional<ElementType> push(const ElementType& value) noexcept;
+
+    /// @brief inserts value in FIFO order, always succeeds by removing the oldest value
+    /// when the queue is detected to be full (overflow)
+    /// @param[in] value to be inserted is moved into the queue if possible
+    /// @return removed value if an overflow occured, empty optional otherwise
+    /// @note threadsafe, lockfree
+    iox::optional<ElementType> push(ElementType&& value) noexcept;
+
+    /// @brief Set the capacity to a new capacity between 0 and MaxCapacity
+    /// @param[in] newCapacity new capacity to be set
+    /// @return true if the new capacity was set, false if the queue is not empty or newCapacity > MaxCapacity
+    /// @note not threadsafe, no push or pop calls must occur during this call
+    bool setCapacity(const uint64_t newCapacity) noexcept;
+
+  private:
+    uint64_t m_capacity{MaxCapacity};
+
+    template <typename T>
+    iox::optional<ElementType> pushImpl(T&& value) noexcept;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#include "iox/detail/mpmc_lockfree_queue/mpmc_bounded_lockfree_queue.inl"
+
+#endif // IOX_HOOFS_CONCURRENT_BUFFER_MPMC_BOUNDED_LOCKFREE_QUEUE_HPP
@@ -0,0 +1,106 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX_HOOFS_CONCURRENT_BUFFER_MPMC_LOCKFREE_QUEUE_MPMC_BOUNDED_LOCKFREE_QUEUE_INL
+#define IOX_HOOFS_CONCURRENT_BUFFER_MPMC_LOCKFREE_QUEUE_MPMC_BOUNDED_LOCKFREE_QUEUE_INL
+
+#include "iox/detail/mpmc_bounded_lockfree_queue.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+template <typename ElementType, uint64_t MaxCapacity>
+inline constexpr uint64_t MpmcBoundedLockFreeQueue<ElementType, MaxCapacity>::maxCapacity() noexcept
+{
+    return MAX_CAPACITY;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline uint64_t MpmcBoundedLockFreeQueue<ElementType, MaxCapacity>::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline bool MpmcBoundedLockFreeQueue<ElementType, MaxCapacity>::setCapacity(const uint64_t newCapacity) noexcept
+{
+    if (newCapacity > MAX_CAPACITY || !Base::empty())
+    {
+        return false;
+    }
+
+    // the queue is empty, therefore all indices below the current capacity are free indices; they are replaced by
+    // the indices below the new capacity
+    uint64_t index{0U};
+    while (Base::m_freeIndices.pop(index))
+    {
+    }
+    for (index = 0U; index < newCapacity; ++index)
+    {
+        Base::m_freeIndices.push(index);
+    }
+    m_capacity = newCapacity;
+
+    return true;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+iox::optional<ElementType> inline MpmcBoundedLockFreeQueue<ElementType, MaxCapacity>::push(
+    const ElementType& value) noexcept
+{
+    return pushImpl(std::forward<const ElementType>(value));
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline iox::optional<ElementType>
+// NOLINTNEXTLINE(cppcoreguidelines-rvalue-reference-param-not-moved) perfect forwarding is used
+MpmcBoundedLockFreeQueue<ElementType, MaxCapacity>::push(ElementType&& value) noexcept
+{
+    return pushImpl(std::forward<ElementType>(value));
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+template <typename T>
+inline iox::optional<ElementType> MpmcBoundedLockFreeQueue<ElementType, MaxCapacity>::pushImpl(T&& value) noexcept
+{
+    optional<ElementType> evictedValue;
+
+    uint64_t index{0U};
+
+    while (!Base::m_freeIndices.pop(index))
+    {
+        // the used index queue can only be full if the capacity is MaxCapacity, therefore popIfFull of the
+        // MpmcLockFreeQueue cannot be used to detect a full queue
+        if (Base::m_usedIndices.popIfSizeIsAtLeast(m_capacity, index))
+        {
+            evictedValue = Base::readBufferAt(index);
+            break;
+        }
+        // if m_usedIndices did not contain capacity elements we try again (m_freeIndices should contain an index
+        // in this case)
+    }
+
+    Base::writeBufferAt(index, std::forward<T>(value));
+
+    Base::m_usedIndices.push(index);
+
+    return evictedValue; // value was moved into the queue, if a value was evicted to do so return it
+}
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_BUFFER_MPMC_LOCKFREE_QUEUE_MPMC_BOUNDED_LOCKFREE_QUEUE_INL
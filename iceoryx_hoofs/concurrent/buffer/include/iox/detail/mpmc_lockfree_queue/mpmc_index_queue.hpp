@@ -105,6 +105,9 @@ class MpmcIndexQueue
     template <typename ElementType, uint64_t Cap>
     friend class MpmcResizeableLockFreeQueue;
 
+    template <typename ElementType, uint64_t Cap>
+    friend class MpmcBoundedLockFreeQueue;
+
     // remark: a compile time check whether Index is actually lock free would be nice
     // note: there is a way  with is_always_lock_free in c++17 (which we cannot use here)
     using Index = CyclicIndex<Capacity>;
@@ -92,6 +92,20 @@ class MpmcLoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop multiple values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices is the memory where the popped indices are stored; must be able to hold
+    /// 'maxNumberOfIndices' elements
+    /// @param [in] maxNumberOfIndices is the maximum number of indices to pop
+    /// @return the number of popped indices, can be less than 'maxNumberOfIndices' if the free-list runs empty
+    uint32_t popBatch(not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push multiple previously popped elements with a single compare-and-swap on the head
+    /// @param [in] indices to previously popped elements
+    /// @param [in] numberOfIndices is the number of elements in 'indices'
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in the latter case none of the
+    /// indices is pushed
+    bool pushBatch(not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
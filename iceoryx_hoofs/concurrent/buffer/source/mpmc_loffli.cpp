@@ -110,5 +110,106 @@ bool MpmcLoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t MpmcLoFFLi::popBatch(not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    if (maxNumberOfIndices == 0U || !m_nextFreeIndex)
+    {
+        return 0U;
+    }
+
+    Index_t* const poppedIndices = indices;
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        numberOfIndices = 0U;
+        Index_t current = oldHead.indexToNextFreeIndex;
+
+        /// the chain behind the head can only change when the head changes; if a concurrent pop or push happens
+        /// while we are walking the chain we might read stale indices but the compare-and-swap will fail and we retry
+        while (current < m_size && numberOfIndices < maxNumberOfIndices)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            poppedIndices[numberOfIndices] = current;
+            ++numberOfIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            current = m_nextFreeIndex.get()[current];
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = current;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) see 'pop'
+        m_nextFreeIndex.get()[poppedIndices[i]] = m_invalidIndex;
+    }
+
+    /// see 'pop' for the synchronization with the validity check in 'push'
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool MpmcLoFFLi::pushBatch(not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    if (numberOfIndices == 0U)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (!m_nextFreeIndex)
+    {
+        return false;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) all indices are checked against m_size
+    auto* nextFreeIndex = m_nextFreeIndex.get();
+    const Index_t* const batch = indices;
+
+    /// link the indices to a chain; an index which is not marked as popped or which occurs twice in the batch
+    /// is detected since its successor was already overwritten
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        const Index_t index = batch[i];
+        if (index >= m_size || nextFreeIndex[index] != m_invalidIndex)
+        {
+            for (uint32_t k = 0U; k < i; ++k)
+            {
+                nextFreeIndex[batch[k]] = m_invalidIndex;
+            }
+            return false;
+        }
+        nextFreeIndex[index] = (i + 1U < numberOfIndices) ? batch[i + 1U] : m_size;
+    }
+
+    const Index_t first = batch[0U];
+    const Index_t last = batch[numberOfIndices - 1U];
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        nextFreeIndex[last] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = first;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
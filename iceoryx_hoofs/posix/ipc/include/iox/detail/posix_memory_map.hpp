@@ -90,6 +90,10 @@ class PosixMemoryMapBuilder
     /// @brief Offset of the memory location
     IOX_BUILDER_PARAMETER(off_t, offset, 0)
 
+    /// @brief Advises the kernel to back the mapped memory with transparent huge pages to reduce the TLB misses.
+    ///        This is only an advice, if the platform does not support it a warning is logged.
+    IOX_BUILDER_PARAMETER(bool, transparentHugePages, false)
+
   public:
     /// @brief creates a valid 'PosixMemoryMap' object. If the construction failed the
     ///        expected contains an enum value describing the error.
@@ -37,9 +37,22 @@ enum class PosixSharedMemoryObjectError : uint8_t
     MAPPING_SHARED_MEMORY_FAILED,
     UNABLE_TO_VERIFY_MEMORY_SIZE,
     REQUESTED_SIZE_EXCEEDS_ACTUAL_SIZE,
+    UNABLE_TO_LOCK_MEMORY,
+    UNABLE_TO_APPLY_NUMA_POLICY,
     INTERNAL_LOGIC_FAILURE,
 };
 
+/// @brief Defines on which NUMA nodes the pages of a newly created shared memory are placed
+enum class NumaPolicy : uint8_t
+{
+    /// @brief the pages are placed by the kernel, usually on the node of the thread which touches them first
+    DEFAULT,
+    /// @brief the pages are placed on a single NUMA node
+    BIND,
+    /// @brief the pages are interleaved over all NUMA nodes
+    INTERLEAVE,
+};
+
 enum class PosixSharedMemoryAllocationError : uint8_t
 {
     REQUESTED_MEMORY_AFTER_FINALIZED_ALLOCATION,
@@ -116,7 +129,31 @@ class PosixSharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief Advises the kernel to back the shared memory with transparent huge pages to reduce the TLB misses.
+    ///        This is only an advice, if the platform does not support it a warning is logged.
+    IOX_BUILDER_PARAMETER(bool, transparentHugePages, false)
+
+    /// @brief Locks the mapped shared memory into RAM, which prefaults all pages of this process and prevents that
+    ///        they are swapped out. The memory stays locked until it is unmapped.
+    IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
+    /// @brief The number of threads which write zeros into a newly created shared memory when
+    ///        'platform::IOX_SHM_WRITE_ZEROS_ON_CREATION' is set. Every thread prefaults a page aligned part of the
+    ///        memory, which shortens the creation of large shared memories. The value is limited to
+    ///        MAX_PREFAULT_THREAD_COUNT.
+    IOX_BUILDER_PARAMETER(uint32_t, prefaultThreadCount, 1U)
+
+    /// @brief Defines on which NUMA nodes the pages of a newly created shared memory are placed. The policy is
+    ///        applied before the memory is prefaulted and is kept by the shared memory, therefore it also holds for
+    ///        the pages which are touched first by another process.
+    IOX_BUILDER_PARAMETER(NumaPolicy, numaPolicy, NumaPolicy::DEFAULT)
+
+    /// @brief The NUMA node the pages are placed on when the numaPolicy is NumaPolicy::BIND
+    IOX_BUILDER_PARAMETER(uint32_t, numaNode, 0U)
+
   public:
+    static constexpr uint32_t MAX_PREFAULT_THREAD_COUNT{64U};
+
     expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> create() noexcept;
 };
 } // namespace iox
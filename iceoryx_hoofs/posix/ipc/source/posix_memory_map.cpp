@@ -44,7 +44,24 @@ expected<PosixMemoryMap, PosixMemoryMapError> PosixMemoryMapBuilder::create() no
 
     if (result)
     {
-        return ok(PosixMemoryMap(result.value().value, m_length));
+        PosixMemoryMap memoryMap(result.value().value, m_length);
+
+        if (m_transparentHugePages)
+        {
+            auto adviseResult =
+                IOX_POSIX_CALL(iox_madvise_hugepage)(memoryMap.getBaseAddress(), static_cast<size_t>(m_length))
+                    .failureReturnValue(-1)
+                    .evaluate();
+            if (adviseResult.has_error())
+            {
+                IOX_LOG(Warn,
+                        "Unable to back the memory with a length of "
+                            << m_length << " with transparent huge pages: "
+                            << adviseResult.error().getHumanReadableErrnum());
+            }
+        }
+
+        return ok(std::move(memoryMap));
     }
 
     constexpr uint64_t FLAGS_BIT_SIZE = 32U;
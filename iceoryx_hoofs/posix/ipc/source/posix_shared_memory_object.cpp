@@ -17,10 +17,15 @@
 #include "iox/posix_shared_memory_object.hpp"
 #include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/unistd.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/attributes.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
 #include "iox/signal_handler.hpp"
+#include "iox/thread.hpp"
+#include "iox/vector.hpp"
 
 #include <bitset>
 #include <cstdlib>
@@ -49,8 +54,45 @@ static void memsetSigbusHandler(int) noexcept
     IOX_DISCARD_RESULT(result);
     _exit(EXIT_FAILURE);
 }
+
+/// @brief Writes zeros into the memory with multiple threads which work on page aligned parts. If a thread cannot be
+///        created its part is written by the calling thread.
+static void writeZeros(void* const memory, const uint64_t size, const uint32_t threadCount) noexcept
+{
+    constexpr uint32_t MAX_THREAD_COUNT{PosixSharedMemoryObjectBuilder::MAX_PREFAULT_THREAD_COUNT};
+    const auto numberOfThreads = algorithm::minVal(algorithm::maxVal(threadCount, 1U), MAX_THREAD_COUNT);
+    const auto pageSize = detail::pageSize();
+    const auto numberOfPages = (size + pageSize - 1U) / pageSize;
+    const auto bytesPerThread = ((numberOfPages + numberOfThreads - 1U) / numberOfThreads) * pageSize;
+
+    auto* const begin = static_cast<uint8_t*>(memory);
+    auto writeZerosIntoPart = [begin, size, bytesPerThread](const uint64_t part) {
+        const auto offset = part * bytesPerThread;
+        if (offset < size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the offset is within the memory
+            memset(begin + offset, 0, static_cast<size_t>(algorithm::minVal(bytesPerThread, size - offset)));
+        }
+    };
+
+    vector<optional<Thread>, MAX_THREAD_COUNT> threads;
+    for (uint32_t part = 1U; part < numberOfThreads; ++part)
+    {
+        threads.emplace_back();
+        if (ThreadBuilder()
+                .name("iox-prefault")
+                .create(threads.back(), [writeZerosIntoPart, part] { writeZerosIntoPart(part); })
+                .has_error())
+        {
+            writeZerosIntoPart(part);
+        }
+    }
+    writeZerosIntoPart(0U);
+    // the threads are joined on destruction
+}
 } // namespace detail
 constexpr const void* const PosixSharedMemoryObject::NO_ADDRESS_HINT;
+constexpr uint32_t PosixSharedMemoryObjectBuilder::MAX_PREFAULT_THREAD_COUNT;
 
 // NOLINTJUSTIFICATION the function size is related to the error handling and the cognitive complexity
 // results from the expanded log macro
@@ -120,6 +162,7 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                          .accessMode(m_accessMode)
                          .flags(detail::PosixMemoryMapFlags::SHARE_CHANGES)
                          .offset(0)
+                         .transparentHugePages(m_transparentHugePages)
                          .create();
 
     if (!memoryMap)
@@ -129,6 +172,30 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
         return err(PosixSharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
     }
 
+    if (sharedMemory->hasOwnership() && m_numaPolicy != NumaPolicy::DEFAULT)
+    {
+        // the policy must be applied before the memory is prefaulted, otherwise the pages are placed on the node of
+        // the thread which writes the zeros
+        auto* baseAddress = memoryMap->getBaseAddress();
+        auto length = static_cast<size_t>(realSize);
+        auto numaResult = (m_numaPolicy == NumaPolicy::BIND)
+                              ? IOX_POSIX_CALL(iox_mbind_node)(baseAddress, length, m_numaNode)
+                                    .failureReturnValue(-1)
+                                    .evaluate()
+                              : IOX_POSIX_CALL(iox_mbind_interleave)(baseAddress, length)
+                                    .failureReturnValue(-1)
+                                    .evaluate();
+        if (numaResult.has_error())
+        {
+            printErrorDetails();
+            IOX_LOG(Error,
+                    "Unable to place the shared memory on the NUMA node(s) with the "
+                        << ((m_numaPolicy == NumaPolicy::BIND) ? "bind" : "interleave") << " policy and node "
+                        << m_numaNode << ": " << numaResult.error().getHumanReadableErrnum());
+            return err(PosixSharedMemoryObjectError::UNABLE_TO_APPLY_NUMA_POLICY);
+        }
+    }
+
     if (sharedMemory->hasOwnership())
     {
         IOX_LOG(Debug, "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name << "]");
@@ -162,12 +229,27 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                 (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                 m_permissions.value()));
 
-            memset(memoryMap->getBaseAddress(), 0, static_cast<size_t>(m_memorySizeInBytes));
+            detail::writeZeros(memoryMap->getBaseAddress(), m_memorySizeInBytes, m_prefaultThreadCount);
         }
         IOX_LOG(Debug,
                 "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name << "]");
     }
 
+    if (m_lockMemory)
+    {
+        auto lockResult = IOX_POSIX_CALL(iox_mlock)(memoryMap->getBaseAddress(), static_cast<size_t>(realSize))
+                              .failureReturnValue(-1)
+                              .evaluate();
+        if (lockResult.has_error())
+        {
+            printErrorDetails();
+            IOX_LOG(Error,
+                    "Unable to lock the shared memory into RAM: " << lockResult.error().getHumanReadableErrnum()
+                                                                  << ". Is the limit of locked memory sufficient?");
+            return err(PosixSharedMemoryObjectError::UNABLE_TO_LOCK_MEMORY);
+        }
+    }
+
     return ok(PosixSharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap)));
 }
 
@@ -23,6 +23,10 @@
 #include <cstdint>
 #include <limits>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace iox
 {
 namespace algorithm
@@ -235,6 +239,39 @@ constexpr bool isPowerOfTwo(const T n) noexcept
     // AXIVION Next Construct AutosarC++19_03-M0.1.2, AutosarC++19_03-M0.1.9, FaultDetection-DeadBranches : False positive! 'n' can be zero.
     return (n > 0) && ((n & (n - 1U)) == 0U);
 }
+
+/// @brief Returns the smallest power of two which is greater or equal to an unsigned integer
+/// @note the result is not representable and therefore undefined when n is greater than the largest power of two of T
+/// @return the smallest power of two which is greater or equal to n, 1 for n = 0
+template <typename T>
+constexpr T nextPowerOfTwo(const T n) noexcept
+{
+    static_assert(std::is_unsigned<T>::value && !std::is_same<T, bool>::value, "Only unsigned integer are allowed!");
+    T powerOfTwo{1U};
+    while (powerOfTwo < n)
+    {
+        powerOfTwo = static_cast<T>(powerOfTwo << 1U);
+    }
+    return powerOfTwo;
+}
+
+/// @brief Returns the number of trailing zero bits, i.e. the index of the least significant set bit
+/// @return the number of trailing zero bits of n, 64 for n = 0
+inline uint64_t countTrailingZeros(const uint64_t n) noexcept
+{
+    constexpr uint64_t NUMBER_OF_BITS{64U};
+    if (n == 0U)
+    {
+        return NUMBER_OF_BITS;
+    }
+#if defined(_MSC_VER)
+    unsigned long index{0U};
+    _BitScanForward64(&index, n);
+    return index;
+#else
+    return static_cast<uint64_t>(__builtin_ctzll(n));
+#endif
+}
 } // namespace iox
 
 #include "iox/detail/algorithm.inl"
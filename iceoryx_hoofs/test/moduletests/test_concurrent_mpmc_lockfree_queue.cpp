@@ -17,10 +17,11 @@
 
 #include "test.hpp"
 
+#include "iox/detail/mpmc_bounded_lockfree_queue.hpp"
 #include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/detail/mpmc_resizeable_lockfree_queue.hpp"
 
-// We test the common functionality of LockFreeQueue and ResizableLockFreeQueue here
+// We test the common functionality of LockFreeQueue, BoundedLockFreeQueue and ResizableLockFreeQueue here
 // in typed tests to reduce code duplication.
 
 namespace
@@ -130,6 +131,9 @@ using LFQueue = iox::concurrent::MpmcLockFreeQueue<T, C>;
 template <typename T, uint64_t C>
 using RLFQueue = iox::concurrent::MpmcResizeableLockFreeQueue<T, C>;
 
+template <typename T, uint64_t C>
+using BLFQueue = iox::concurrent::MpmcBoundedLockFreeQueue<T, C>;
+
 
 template <template <typename, uint64_t> class QueueType, typename ElementType, uint64_t Capacity>
 using Full = Config<QueueType, ElementType, Capacity>;
@@ -149,6 +153,12 @@ using LFFull2 = Full<LFQueue, int, 1000>;
 using LFFull3 = Full<LFQueue, Integer, 100>;
 using LFFull4 = Full<LFQueue, MoveOnlyInteger, 10>;
 
+// configs of the bounded lockfree queue
+using BLFFull1 = Full<BLFQueue, Integer, 10>;
+using BLFAlmostFull1 = AlmostFull<BLFQueue, int, 1000>;
+using BLFHalfFull1 = HalfFull<BLFQueue, MoveOnlyInteger, 100>;
+using BLFAlmostEmpty1 = AlmostEmpty<BLFQueue, Integer, 10>;
+
 // configs of the resizeable lockfree queue
 using Full1 = Full<RLFQueue, Integer, 1>;
 using Full2 = Full<RLFQueue, Integer, 10>;
@@ -171,6 +181,10 @@ typedef ::testing::Types<LFFull1,
                          LFFull2,
                          LFFull3,
                          LFFull4,
+                         BLFFull1,
+                         BLFAlmostFull1,
+                         BLFHalfFull1,
+                         BLFAlmostEmpty1,
                          Full1,
                          Full2,
                          Full3,
@@ -196,6 +210,27 @@ TEST(MpmcLockFreeQueueTest, capacityIsConsistent)
     EXPECT_EQ(q.capacity(), CAPACITY);
 }
 
+TEST(MpmcLockFreeQueueTest, boundedQueueSetCapacityFailsWhenTheQueueIsNotEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d5cec81-ad27-4c5b-89b3-744b1c75e101");
+    constexpr uint64_t CAPACITY{10};
+    BLFQueue<int, CAPACITY> q;
+    ASSERT_TRUE(q.tryPush(73));
+
+    EXPECT_FALSE(q.setCapacity(CAPACITY / 2));
+    EXPECT_EQ(q.capacity(), CAPACITY);
+}
+
+TEST(MpmcLockFreeQueueTest, boundedQueueSetCapacityFailsWhenTheCapacityExceedsTheMaximumCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b693bbd6-4598-4240-b02c-33c7b088e750");
+    constexpr uint64_t CAPACITY{10};
+    BLFQueue<int, CAPACITY> q;
+
+    EXPECT_FALSE(q.setCapacity(CAPACITY + 1));
+    EXPECT_EQ(q.capacity(), CAPACITY);
+}
+
 TYPED_TEST(MpmcLockFreeQueueTest, constructedQueueIsEmpty)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9bb8a86e-c3d0-44ef-9fb7-999f50f0c4ac");
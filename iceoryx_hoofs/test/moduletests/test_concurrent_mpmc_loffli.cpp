@@ -220,4 +220,88 @@ TEST_F(MpmcLoFFLi_test, PushToUninitializedLoFFLi)
     MpmcLoFFLi loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TEST_F(MpmcLoFFLi_test, PopBatchReturnsAllIndicesInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e35e3f9a-a0c7-42e9-9f50-b9f4e6bd0ee5");
+    std::vector<uint32_t> indices(CAPACITY + 2U, 0xAFFE);
+    EXPECT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY + 2U), Eq(CAPACITY));
+
+    for (uint32_t i = 0; i < CAPACITY; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TEST_F(MpmcLoFFLi_test, PopBatchFromEmptyLoFFLiReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6423786c-07e7-4b00-9ef4-782ded80f0c9");
+    std::vector<uint32_t> indices(CAPACITY, 0U);
+    EXPECT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY), Eq(CAPACITY));
+    EXPECT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY), Eq(0U));
+}
+
+TEST_F(MpmcLoFFLi_test, PopBatchFromUninitializedLoFFLiReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3e4ee5b-ea58-42b6-8d21-21f4bf16e8a1");
+    uint32_t index{0};
+    MpmcLoFFLi loFFLi;
+    EXPECT_THAT(loFFLi.popBatch(&index, 1U), Eq(0U));
+}
+
+TEST_F(MpmcLoFFLi_test, PushBatchMakesIndicesAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b132b973-e782-4ccb-b2f0-ac2ed1fc10e2");
+    std::vector<uint32_t> indices(CAPACITY, 0U);
+    ASSERT_THAT(this->m_loffli.popBatch(indices.data(), CAPACITY), Eq(CAPACITY));
+
+    EXPECT_THAT(this->m_loffli.pushBatch(indices.data(), CAPACITY), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index{0};
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+    std::sort(useListPoped.begin(), useListPoped.end());
+    EXPECT_THAT(useListPoped, Eq(indices));
+}
+
+TEST_F(MpmcLoFFLi_test, PushBatchWithIndexNotPoppedFailsAndPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "11d43b50-f29f-4191-8c95-1201b4ccb52a");
+    std::vector<uint32_t> indices(2U, 0U);
+    ASSERT_THAT(this->m_loffli.popBatch(indices.data(), 2U), Eq(2U));
+
+    std::vector<uint32_t> invalidBatch{indices[0], indices[1], 3U};
+    EXPECT_THAT(this->m_loffli.pushBatch(invalidBatch.data(), 3U), Eq(false));
+
+    // the valid indices of the failed batch are still owned by the caller
+    EXPECT_THAT(this->m_loffli.push(indices[0]), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(indices[1]), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, PushBatchWithDuplicateIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bbf4b67e-f818-44de-8bb5-efcf509c1b41");
+    std::vector<uint32_t> indices(2U, 0U);
+    ASSERT_THAT(this->m_loffli.popBatch(indices.data(), 2U), Eq(2U));
+
+    std::vector<uint32_t> invalidBatch{indices[0], indices[1], indices[0]};
+    EXPECT_THAT(this->m_loffli.pushBatch(invalidBatch.data(), 3U), Eq(false));
+    EXPECT_THAT(this->m_loffli.pushBatch(indices.data(), 2U), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, PushBatchWithOutOfBoundIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13f9d5e3-89bd-4620-8202-de70ba83b81e");
+    uint32_t index{0};
+    this->m_loffli.pop(index);
+
+    std::vector<uint32_t> invalidBatch{index, CAPACITY + 42};
+    EXPECT_THAT(this->m_loffli.pushBatch(invalidBatch.data(), 2U), Eq(false));
+}
 } // namespace
@@ -14,6 +14,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+#include "iceoryx_platform/mman.hpp"
 #include "iox/memory.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/posix_shared_memory_object.hpp"
@@ -162,6 +163,81 @@ TEST_F(SharedMemoryObject_Test, OpenSutMapsAllMemoryIntoProcess)
     }
 }
 
+TEST_F(SharedMemoryObject_Test, CreatingSutWithMultiplePrefaultThreadsProvidesMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87c29012-c79a-4684-b6b7-d7222bb775fd");
+    const uint64_t MEMORY_SIZE = 100000;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmPrefault")
+                   .memorySizeInBytes(MEMORY_SIZE * sizeof(uint64_t))
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .transparentHugePages(true)
+                   .prefaultThreadCount(4)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint64_t*>(sut.getBaseAddress());
+
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ASSERT_THAT(data_ptr[i], Eq(0U));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data_ptr[i] = i;
+    }
+}
+
+#if defined(__linux__)
+TEST_F(SharedMemoryObject_Test, CreatingSutBoundToNumaNodeOfCallingThreadWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5aa37974-91ba-46b3-ab52-f28ca9ab2bf2");
+    uint32_t numaNode{0U};
+    ASSERT_THAT(iox_get_numa_node(&numaNode), Eq(0));
+
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNumaBind")
+                   .memorySizeInBytes(100000)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numaPolicy(NumaPolicy::BIND)
+                   .numaNode(numaNode)
+                   .create();
+
+    EXPECT_THAT(sut.has_error(), Eq(false));
+}
+
+TEST_F(SharedMemoryObject_Test, CreatingSutInterleavedOverAllNumaNodesWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbdbf138-904b-4a17-96f2-bea291478800");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNumaInterleave")
+                   .memorySizeInBytes(100000)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numaPolicy(NumaPolicy::INTERLEAVE)
+                   .create();
+
+    EXPECT_THAT(sut.has_error(), Eq(false));
+}
+
+TEST_F(SharedMemoryObject_Test, CreatingSutBoundToInvalidNumaNodeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e83f6e43-8f2d-4926-aa7c-7b2e14ee4bda");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNumaInvalid")
+                   .memorySizeInBytes(100000)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numaPolicy(NumaPolicy::BIND)
+                   .numaNode(std::numeric_limits<uint32_t>::max())
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(true));
+    EXPECT_THAT(sut.error(), Eq(PosixSharedMemoryObjectError::UNABLE_TO_APPLY_NUMA_POLICY));
+}
+#endif
+
 #if !defined(_WIN32) && !defined(__APPLE__)
 TEST_F(SharedMemoryObject_Test, AcquiringOwnerWorks)
 {
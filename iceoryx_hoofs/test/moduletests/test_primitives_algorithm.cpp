@@ -214,6 +214,24 @@ TYPED_TEST(algorithm_test_isPowerOfTwo, ZeroIsNotPowerOfTwo)
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(0)));
 }
 
+TYPED_TEST(algorithm_test_isPowerOfTwo, NextPowerOfTwoOfPowerOfTwoIsTheValueItself)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2c65013e-8e9e-40ab-830f-5dfa175d358d");
+    using T = typename TestFixture::CurrentType;
+    EXPECT_THAT(nextPowerOfTwo(static_cast<T>(1)), Eq(static_cast<T>(1)));
+    EXPECT_THAT(nextPowerOfTwo(static_cast<T>(64)), Eq(static_cast<T>(64)));
+    EXPECT_THAT(nextPowerOfTwo(TestFixture::MAX_POWER_OF_TWO), Eq(TestFixture::MAX_POWER_OF_TWO));
+}
+
+TYPED_TEST(algorithm_test_isPowerOfTwo, NextPowerOfTwoOfOtherValuesIsTheNextGreaterPowerOfTwo)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a43d32a0-5d4e-4d10-890e-676f6d675006");
+    using T = typename TestFixture::CurrentType;
+    EXPECT_THAT(nextPowerOfTwo(static_cast<T>(0)), Eq(static_cast<T>(1)));
+    EXPECT_THAT(nextPowerOfTwo(static_cast<T>(3)), Eq(static_cast<T>(4)));
+    EXPECT_THAT(nextPowerOfTwo(static_cast<T>(65)), Eq(static_cast<T>(128)));
+}
+
 TYPED_TEST(algorithm_test_isPowerOfTwo, FourtyTwoIsNotPowerOfTwo)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0570fc10-eb72-4a34-b8a6-5084c7737866");
@@ -225,4 +243,19 @@ TYPED_TEST(algorithm_test_isPowerOfTwo, MaxValueForTypeIsNotPowerOfTwo)
     ::testing::Test::RecordProperty("TEST_ID", "2abdb27d-58de-4e3d-b8fb-8e5f1f3e6327");
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(TestFixture::MAX)));
 }
+
+TEST_F(algorithm_test, CountTrailingZerosReturnsIndexOfLeastSignificantSetBit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5814752c-f803-4a6b-9a1c-c08fa3d25e4c");
+    EXPECT_THAT(countTrailingZeros(1U), Eq(0U));
+    EXPECT_THAT(countTrailingZeros(0b1010'0000U), Eq(5U));
+    EXPECT_THAT(countTrailingZeros(1ULL << 63U), Eq(63U));
+    EXPECT_THAT(countTrailingZeros(std::numeric_limits<uint64_t>::max()), Eq(0U));
+}
+
+TEST_F(algorithm_test, CountTrailingZerosOfZeroIsNumberOfBits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "99b044c1-25c7-43e3-a65c-32eaa5fd5a0d");
+    EXPECT_THAT(countTrailingZeros(0U), Eq(64U));
+}
 } // namespace
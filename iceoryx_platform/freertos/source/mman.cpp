@@ -85,3 +85,33 @@ int munmap(void*, size_t)
 {
     return 0;
 }
+
+int iox_mlock(const void*, size_t)
+{
+    // the memory is statically allocated and never paged out
+    return 0;
+}
+
+int iox_madvise_hugepage(void*, size_t)
+{
+    FreeRTOS_errno = ENOSYS;
+    return -1;
+}
+
+int iox_mbind_node(void*, size_t, uint32_t)
+{
+    FreeRTOS_errno = ENOSYS;
+    return -1;
+}
+
+int iox_mbind_interleave(void*, size_t)
+{
+    FreeRTOS_errno = ENOSYS;
+    return -1;
+}
+
+int iox_get_numa_node(uint32_t* node)
+{
+    *node = 0U;
+    return 0;
+}
@@ -15,6 +15,9 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <errno.h>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -33,3 +36,66 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_madvise_hugepage(void* addr, size_t length)
+{
+    return madvise(addr, length, MADV_HUGEPAGE);
+}
+
+namespace
+{
+// the node masks cover the maximum number of nodes of the common kernel configurations
+constexpr uint32_t MAX_NUMBER_OF_NUMA_NODES{1024U};
+constexpr uint32_t BITS_PER_NODE_MASK_ELEMENT{sizeof(unsigned long) * 8U};
+constexpr uint32_t NODE_MASK_SIZE{MAX_NUMBER_OF_NUMA_NODES / BITS_PER_NODE_MASK_ELEMENT};
+// the kernel evaluates one bit less than the provided number of nodes
+constexpr unsigned long MAX_NODE_ARGUMENT{MAX_NUMBER_OF_NUMA_NODES + 1U};
+} // namespace
+
+int iox_mbind_node(void* addr, size_t length, uint32_t node)
+{
+    if (node >= MAX_NUMBER_OF_NUMA_NODES)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays) required by the syscall
+    unsigned long nodeMask[NODE_MASK_SIZE]{};
+    nodeMask[node / BITS_PER_NODE_MASK_ELEMENT] = 1UL << (node % BITS_PER_NODE_MASK_ELEMENT);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg) no glibc wrapper without libnuma
+    return static_cast<int>(
+        syscall(SYS_mbind, addr, length, MPOL_BIND, &nodeMask[0], MAX_NODE_ARGUMENT, MPOL_MF_MOVE));
+}
+
+int iox_mbind_interleave(void* addr, size_t length)
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays) required by the syscall
+    unsigned long nodeMask[NODE_MASK_SIZE]{};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg) no glibc wrapper without libnuma
+    if (syscall(SYS_get_mempolicy, nullptr, &nodeMask[0], MAX_NODE_ARGUMENT, nullptr, MPOL_F_MEMS_ALLOWED) != 0)
+    {
+        return -1;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg) no glibc wrapper without libnuma
+    return static_cast<int>(
+        syscall(SYS_mbind, addr, length, MPOL_INTERLEAVE, &nodeMask[0], MAX_NODE_ARGUMENT, MPOL_MF_MOVE));
+}
+
+int iox_get_numa_node(uint32_t* node)
+{
+    unsigned int cpu{0U};
+    unsigned int currentNode{0U};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg) getcpu requires glibc 2.29
+    if (syscall(SYS_getcpu, &cpu, &currentNode, nullptr) != 0)
+    {
+        return -1;
+    }
+    *node = currentNode;
+    return 0;
+}
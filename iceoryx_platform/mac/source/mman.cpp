@@ -42,3 +42,32 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_madvise_hugepage(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mbind_node(void*, size_t, uint32_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mbind_interleave(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_get_numa_node(uint32_t* node)
+{
+    *node = 0U;
+    return 0;
+}
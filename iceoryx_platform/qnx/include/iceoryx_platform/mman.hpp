@@ -16,10 +16,32 @@
 #ifndef IOX_HOOFS_QNX_PLATFORM_MMAN_HPP
 #define IOX_HOOFS_QNX_PLATFORM_MMAN_HPP
 
+#include <stdint.h>
 #include <sys/mman.h>
 
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+/// @brief locks the pages of a mapped memory region into RAM, which also prefaults them
+/// @return 0 on success, otherwise -1 and errno is set
+int iox_mlock(const void* addr, size_t length);
+
+/// @brief advises the kernel to back a mapped memory region with transparent huge pages
+/// @return 0 on success, otherwise -1 and errno is set; ENOSYS when the platform has no transparent huge pages
+int iox_madvise_hugepage(void* addr, size_t length);
+
+/// @brief binds the pages of a mapped memory region to a NUMA node; pages which are already faulted in are moved
+/// @return 0 on success, otherwise -1 and errno is set; ENOSYS when the platform has no NUMA support
+int iox_mbind_node(void* addr, size_t length, uint32_t node);
+
+/// @brief interleaves the pages of a mapped memory region over all NUMA nodes the process is allowed to use
+/// @return 0 on success, otherwise -1 and errno is set; ENOSYS when the platform has no NUMA support
+int iox_mbind_interleave(void* addr, size_t length);
+
+/// @brief acquires the NUMA node of the CPU the calling thread is currently running on; platforms without NUMA
+/// support report node 0
+/// @return 0 on success, otherwise -1 and errno is set
+int iox_get_numa_node(uint32_t* node);
+
 #endif // IOX_HOOFS_QNX_PLATFORM_MMAN_HPP
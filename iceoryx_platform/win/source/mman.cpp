@@ -220,6 +220,36 @@ int iox_shm_close(int fd)
     return 0;
 }
 
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_madvise_hugepage(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mbind_node(void*, size_t, uint32_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mbind_interleave(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_get_numa_node(uint32_t* node)
+{
+    *node = 0U;
+    return 0;
+}
+
 void internal_iox_shm_set_size(int fd, off_t length)
 {
     auto iter = handle2segment.find(fd);
@@ -32,9 +32,11 @@ inline ClientBuilder::ClientBuilder(runtime::PoshRuntime& runtime,
 template <typename Req, typename Res>
 inline expected<unique_ptr<Client<Req, Res>>, ClientBuilderError> ClientBuilder::create() noexcept
 {
-    auto* client_port_data = m_runtime.getMiddlewareClient(
+    auto port_request = runtime::PortRequest::client(
         m_service_description,
         {m_response_queue_capacity, "", m_connect_on_create, m_response_queue_full_policy, m_server_too_slow_policy});
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* client_port_data = port_request.clientPortData();
     if (client_port_data == nullptr)
     {
         return err(ClientBuilderError::OUT_OF_RESOURCES);
@@ -48,9 +50,11 @@ inline expected<unique_ptr<Client<Req, Res>>, ClientBuilderError> ClientBuilder:
 
 inline expected<unique_ptr<iox::popo::UntypedClient>, ClientBuilderError> ClientBuilder::create() noexcept
 {
-    auto* client_port_data = m_runtime.getMiddlewareClient(
+    auto port_request = runtime::PortRequest::client(
         m_service_description,
         {m_response_queue_capacity, "", m_connect_on_create, m_response_queue_full_policy, m_server_too_slow_policy});
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* client_port_data = port_request.clientPortData();
     if (client_port_data == nullptr)
     {
         return err(ClientBuilderError::OUT_OF_RESOURCES);
@@ -29,13 +29,16 @@ inline ListenerBuilder::ListenerBuilder(runtime::PoshRuntime& runtime) noexcept
 
 inline expected<unique_ptr<Listener>, ListenerBuilderError> ListenerBuilder::create() noexcept
 {
-    auto* condition_variable_data = m_runtime.getMiddlewareConditionVariable();
+    auto port_request = runtime::PortRequest::conditionVariable();
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* condition_variable_data = port_request.conditionVariableData();
 
     if (condition_variable_data == nullptr)
     {
         return err(ListenerBuilderError::OUT_OF_RESOURCES);
     }
-    return ok(unique_ptr<Listener>{new (std::nothrow) Listener{*condition_variable_data}, [&](auto* const listener) {
+    return ok(unique_ptr<Listener>{new (std::nothrow) Listener{*condition_variable_data, m_callback_workers},
+                                   [&](auto* const listener) {
                                        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory) raw pointer is required by the unique_ptr API
                                        delete listener;
                                    }});
@@ -31,8 +31,10 @@ inline PublisherBuilder::PublisherBuilder(runtime::PoshRuntime& runtime,
 template <typename T, typename H>
 inline expected<unique_ptr<Publisher<T, H>>, PublisherBuilderError> PublisherBuilder::create() noexcept
 {
-    auto* publisher_port_data = m_runtime.getMiddlewarePublisher(
+    auto port_request = runtime::PortRequest::publisher(
         m_service_description, {m_history_capacity, "", m_offer_on_create, m_subscriber_too_slow_policy});
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* publisher_port_data = port_request.publisherPortData();
     if (publisher_port_data == nullptr)
     {
         return err(PublisherBuilderError::OUT_OF_RESOURCES);
@@ -46,8 +48,10 @@ inline expected<unique_ptr<Publisher<T, H>>, PublisherBuilderError> PublisherBui
 
 inline expected<unique_ptr<UntypedPublisher>, PublisherBuilderError> PublisherBuilder::create() noexcept
 {
-    auto* publisher_port_data = m_runtime.getMiddlewarePublisher(
+    auto port_request = runtime::PortRequest::publisher(
         m_service_description, {m_history_capacity, "", m_offer_on_create, m_subscriber_too_slow_policy});
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* publisher_port_data = port_request.publisherPortData();
     if (publisher_port_data == nullptr)
     {
         return err(PublisherBuilderError::OUT_OF_RESOURCES);
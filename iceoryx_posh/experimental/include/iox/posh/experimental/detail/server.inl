@@ -33,9 +33,15 @@ inline ServerBuilder::ServerBuilder(runtime::PoshRuntime& runtime,
 template <typename Req, typename Res>
 inline expected<unique_ptr<Server<Req, Res>>, ServerBuilderError> ServerBuilder::create() noexcept
 {
-    auto* server_port_data = m_runtime.getMiddlewareServer(
-        m_service_description,
-        {m_request_queue_capacity, "", m_offer_on_create, m_request_queue_full_policy, m_client_too_slow_policy});
+    auto port_request = runtime::PortRequest::server(m_service_description,
+                                                     {m_request_queue_capacity,
+                                                      "",
+                                                      m_offer_on_create,
+                                                      m_request_queue_full_policy,
+                                                      m_client_too_slow_policy,
+                                                      m_concurrent_request_processing});
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* server_port_data = port_request.serverPortData();
     if (server_port_data == nullptr)
     {
         return err(ServerBuilderError::OUT_OF_RESOURCES);
@@ -49,9 +55,15 @@ inline expected<unique_ptr<Server<Req, Res>>, ServerBuilderError> ServerBuilder:
 
 inline expected<unique_ptr<UntypedServer>, ServerBuilderError> ServerBuilder::create() noexcept
 {
-    auto* server_port_data = m_runtime.getMiddlewareServer(
-        m_service_description,
-        {m_request_queue_capacity, "", m_offer_on_create, m_request_queue_full_policy, m_client_too_slow_policy});
+    auto port_request = runtime::PortRequest::server(m_service_description,
+                                                     {m_request_queue_capacity,
+                                                      "",
+                                                      m_offer_on_create,
+                                                      m_request_queue_full_policy,
+                                                      m_client_too_slow_policy,
+                                                      m_concurrent_request_processing});
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* server_port_data = port_request.serverPortData();
     if (server_port_data == nullptr)
     {
         return err(ServerBuilderError::OUT_OF_RESOURCES);
@@ -31,13 +31,15 @@ inline SubscriberBuilder::SubscriberBuilder(runtime::PoshRuntime& runtime,
 template <typename T, typename H>
 inline expected<unique_ptr<Subscriber<T, H>>, SubscriberBuilderError> SubscriberBuilder::create() noexcept
 {
-    auto* subscriber_port_data = m_runtime.getMiddlewareSubscriber(m_service_description,
-                                                                   {m_queue_capacity,
-                                                                    m_history_request,
-                                                                    "",
-                                                                    m_subscribe_on_create,
-                                                                    m_queue_full_policy,
-                                                                    m_requires_publisher_history_support});
+    auto port_request = runtime::PortRequest::subscriber(m_service_description,
+                                                         {m_queue_capacity,
+                                                          m_history_request,
+                                                          "",
+                                                          m_subscribe_on_create,
+                                                          m_queue_full_policy,
+                                                          m_requires_publisher_history_support});
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* subscriber_port_data = port_request.subscriberPortData();
     if (subscriber_port_data == nullptr)
     {
         return err(SubscriberBuilderError::OUT_OF_RESOURCES);
@@ -51,13 +53,15 @@ inline expected<unique_ptr<Subscriber<T, H>>, SubscriberBuilderError> Subscriber
 
 inline expected<unique_ptr<UntypedSubscriber>, SubscriberBuilderError> SubscriberBuilder::create() noexcept
 {
-    auto* subscriber_port_data = m_runtime.getMiddlewareSubscriber(m_service_description,
-                                                                   {m_queue_capacity,
-                                                                    m_history_request,
-                                                                    "",
-                                                                    m_subscribe_on_create,
-                                                                    m_queue_full_policy,
-                                                                    m_requires_publisher_history_support});
+    auto port_request = runtime::PortRequest::subscriber(m_service_description,
+                                                         {m_queue_capacity,
+                                                          m_history_request,
+                                                          "",
+                                                          m_subscribe_on_create,
+                                                          m_queue_full_policy,
+                                                          m_requires_publisher_history_support});
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* subscriber_port_data = port_request.subscriberPortData();
     if (subscriber_port_data == nullptr)
     {
         return err(SubscriberBuilderError::OUT_OF_RESOURCES);
@@ -29,7 +29,9 @@ inline WaitSetBuilder::WaitSetBuilder(runtime::PoshRuntime& runtime) noexcept
 template <uint64_t Capacity>
 inline expected<unique_ptr<WaitSet<Capacity>>, WaitSetBuilderError> WaitSetBuilder::create() noexcept
 {
-    auto* condition_variable_data = m_runtime.getMiddlewareConditionVariable();
+    auto port_request = runtime::PortRequest::conditionVariable();
+    m_runtime.createPorts(span<runtime::PortRequest>(&port_request, 1U));
+    auto* condition_variable_data = port_request.conditionVariableData();
 
     if (condition_variable_data == nullptr)
     {
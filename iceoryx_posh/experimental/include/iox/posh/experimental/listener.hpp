@@ -39,6 +39,11 @@ enum class ListenerBuilderError : uint8_t
 /// @brief A builder for the listener
 class ListenerBuilder
 {
+  public:
+    /// @brief The number of worker threads which execute the callbacks; with 0 the callbacks are executed by the
+    /// thread which waits for the events
+    IOX_BUILDER_PARAMETER(uint32_t, callback_workers, 0)
+
   public:
     /// @brief Creates a listener
     /// @return a 'listener' on success and a 'ListenerBuilderError' on failure
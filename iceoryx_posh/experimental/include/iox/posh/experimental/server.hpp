@@ -65,6 +65,10 @@ class ServerBuilder
     /// @note Corresponds with ClientOptions::responseQueueFullPolicy
     IOX_BUILDER_PARAMETER(ConsumerTooSlowPolicy, client_too_slow_policy, ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
 
+    /// @brief The option whether multiple threads may take requests and loan and send responses concurrently
+    /// @note Corresponds with ServerOptions::concurrentRequestProcessing
+    IOX_BUILDER_PARAMETER(bool, concurrent_request_processing, false)
+
   public:
     /// @brief Creates a typed server instance for the server-client messaging pattern
     /// @tparam Req type of request data
@@ -19,6 +19,9 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
+#include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/notification_attorney.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
 
 #include <memory>
 
@@ -36,6 +39,12 @@ class InterfacePort;
 
 namespace gw
 {
+/// @brief States of the gateway which can be attached to a WaitSet
+enum class GatewayState : popo::StateEnumIdentifier
+{
+    HAS_CAPRO_MESSAGE
+};
+
 /// @brief Generic gateway for communication events
 class GatewayBase
 {
@@ -56,6 +65,12 @@ class GatewayBase
     /// @param[in] msg Type of caro message
     bool getCaProMessage(CaproMessage& msg) noexcept;
 
+    /// @brief Checks whether there are CaPro messages to process
+    /// @return true if there is at least one message, false otherwise
+    bool hasCaProMessage() const noexcept;
+
+    friend class popo::NotificationAttorney;
+
   protected:
     // Needed for unit testing
     GatewayBase() noexcept = default;
@@ -63,6 +78,27 @@ class GatewayBase
 
   protected:
     popo::InterfacePort m_interfaceImpl{nullptr};
+
+  private:
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the interface port.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] gatewayState the state which should be attached
+    void enableState(popo::TriggerHandle&& triggerHandle, const GatewayState gatewayState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Returns method pointer to GatewayBase::hasCaProMessage
+    /// @param[in] gatewayState the state which is checked by the returned callback
+    popo::WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const GatewayState gatewayState) const noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] gatewayState the state which should be detached
+    void disableState(const GatewayState gatewayState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    popo::TriggerHandle m_trigger;
 };
 
 } // namespace gw
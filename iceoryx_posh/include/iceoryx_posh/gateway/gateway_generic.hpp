@@ -23,6 +23,9 @@
 #include "iceoryx_posh/gateway/gateway_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iceoryx_posh/popo/user_trigger.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
 #include "iox/atomic.hpp"
 #include "iox/duration.hpp"
 #include "iox/expected.hpp"
@@ -30,6 +33,8 @@
 #include "iox/optional.hpp"
 #include "iox/smart_lock.hpp"
 #include "iox/string.hpp"
+#include "iox/type_traits.hpp"
+#include "iox/unnamed_semaphore.hpp"
 #include "iox/vector.hpp"
 
 #include <thread>
@@ -47,6 +52,31 @@ enum class GatewayError : uint8_t
     NONEXISTANT_CHANNEL
 };
 
+/// @brief Defines how the gateway waits for discovery messages and for data to forward
+enum class GatewayMode : uint8_t
+{
+    /// @brief discovery messages and all channels are processed periodically
+    POLLING,
+    /// @brief discovery messages are processed when they arrive and only channels with data are forwarded; channels
+    /// whose iceoryx terminal cannot be attached to a WaitSet are still forwarded periodically
+    EVENT_DRIVEN
+};
+
+namespace detail
+{
+/// @brief Channels whose iceoryx terminal is a subscriber can be attached to a WaitSet with SubscriberState::HAS_DATA
+template <typename IceoryxTerminal, typename = void>
+struct IsAttachableIceoryxTerminal : std::false_type
+{
+};
+
+template <typename IceoryxTerminal>
+struct IsAttachableIceoryxTerminal<IceoryxTerminal, void_t<decltype(std::declval<const IceoryxTerminal&>().hasData())>>
+    : std::true_type
+{
+};
+} // namespace detail
+
 ///
 /// @brief A reference generic gateway implementation.
 /// @details This class can be extended to quickly implement any type of gateway, only custom initialization,
@@ -59,6 +89,10 @@ class GatewayGeneric : public gateway_t
 {
     using ChannelVector = vector<channel_t, MAX_CHANNEL_NUMBER>;
     using ConcurrentChannelVector = concurrent::smart_lock<ChannelVector>;
+    using IceoryxTerminal = std::remove_reference_t<decltype(*std::declval<channel_t>().getIceoryxTerminal())>;
+    using WaitSet = popo::WaitSet<>;
+
+    static constexpr bool HAS_ATTACHABLE_ICEORYX_TERMINAL{detail::IsAttachableIceoryxTerminal<IceoryxTerminal>::value};
 
   public:
     virtual ~GatewayGeneric() noexcept;
@@ -84,19 +118,32 @@ class GatewayGeneric : public gateway_t
     ///
     /// @brief forward Forward data between the two terminals of the channel used by the implementation.
     /// @param channel The channel to propogate data across.
+    /// @note With more than one forwarding worker in the GatewayMode::EVENT_DRIVEN this method is called concurrently
+    /// for different channels.
     ///
     virtual void forward(const channel_t& channel) noexcept = 0;
 
     uint64_t getNumberOfChannels() const noexcept;
 
   protected:
+    ///
+    /// @brief Creates the gateway
+    /// @param commInterface The interface of the gateway
+    /// @param discoveryPeriod The period in which discovery messages are processed in the GatewayMode::POLLING
+    /// @param forwardingPeriod The period in which the channels are forwarded which are not event-driven
+    /// @param mode Defines whether the gateway polls periodically or reacts to discovery messages and data
+    /// @param numberOfForwardingWorkers The number of threads which forward channels in parallel in the
+    /// GatewayMode::EVENT_DRIVEN, in the range of 1 to MAX_NUMBER_OF_FORWARDING_WORKERS_PER_GATEWAY
+    ///
     GatewayGeneric(capro::Interfaces commInterface,
                    units::Duration discoveryPeriod = 1000_ms,
-                   units::Duration forwardingPeriod = 50_ms) noexcept;
+                   units::Duration forwardingPeriod = 50_ms,
+                   GatewayMode mode = GatewayMode::POLLING,
+                   uint32_t numberOfForwardingWorkers = 1U) noexcept;
 
     ///
     /// @brief addChannel Creates a channel for the given service and stores a copy of it in an internal collection for
-    /// later access.
+    /// later access. In the GatewayMode::EVENT_DRIVEN the channel is attached to the WaitSet of the gateway.
     /// @param service The service to create a channel for.
     /// @param options The PublisherOptions or SubscriberOptions with historyCapacity and queueCapacity.
     /// @return an expected containing a copy of the added channel, otherwise an error
@@ -132,6 +179,9 @@ class GatewayGeneric : public gateway_t
 
     ///
     /// @brief discardChannel Discard the channel for the given service in the internal collection if one exists.
+    /// @note In the GatewayMode::EVENT_DRIVEN a running gateway detaches the channel from its WaitSet when the last
+    /// copy of the channel is destroyed, therefore channels must only be discarded in 'discover' or while the gateway
+    /// is not running.
     /// @param service The service whose channels hiould be discarded.
     /// @return an empty expected on success, otherwise an error
     ///
@@ -144,12 +194,34 @@ class GatewayGeneric : public gateway_t
 
     units::Duration m_discoveryPeriod;
     units::Duration m_forwardingPeriod;
+    GatewayMode m_mode;
+    uint32_t m_numberOfForwardingWorkers;
 
     std::thread m_discoveryThread;
     std::thread m_forwardingThread;
 
+    /// @note the members below are only used in the GatewayMode::EVENT_DRIVEN; the WaitSet is modified by the event
+    /// loop only, other threads request the (de)attachment of the channels via the m_channelsChanged trigger
+    popo::UserTrigger m_channelsChanged;
+    bool m_hasPolledChannels{false};
+    ChannelVector m_channelsToForward;
+    concurrent::Atomic<uint64_t> m_nextChannelToForward{0U};
+    concurrent::Atomic<bool> m_keepForwardingWorkersRunning{false};
+    optional<UnnamedSemaphore> m_forwardingWorkerWakeup;
+    optional<UnnamedSemaphore> m_forwardingWorkerFinished;
+    vector<std::thread, MAX_NUMBER_OF_FORWARDING_WORKERS_PER_GATEWAY> m_forwardingWorkers;
+    optional<WaitSet> m_waitSet;
+
     void forwardingLoop() noexcept;
     void discoveryLoop() noexcept;
+
+    void eventLoop() noexcept;
+    void attachChannels() noexcept;
+    void forwardChannels(const typename WaitSet::NotificationInfoVector& notifications,
+                         const bool forwardAllChannels) noexcept;
+    void forwardScheduledChannels() noexcept;
+    void forwardNextScheduledChannels() noexcept;
+    void forwardingWorkerLoop() noexcept;
 };
 
 } // namespace gw
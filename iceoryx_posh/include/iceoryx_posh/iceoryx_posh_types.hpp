@@ -75,7 +75,8 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+// 1x publisherPort for the complete service registry, 1x publisherPort for the service registry changes
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -88,6 +89,7 @@ constexpr uint32_t MAX_INTERFACE_NUMBER = build::IOX_MAX_INTERFACE_NUMBER;
 constexpr uint32_t MAX_INTERFACE_CAPRO_FIFO_SIZE = MAX_PUBLISHERS;
 constexpr uint32_t MAX_CHANNEL_NUMBER = MAX_PUBLISHERS + MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_GATEWAY_SERVICES = 2 * MAX_CHANNEL_NUMBER;
+constexpr uint32_t MAX_NUMBER_OF_FORWARDING_WORKERS_PER_GATEWAY = 16U;
 // Client
 constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_CLIENTS;
 constexpr uint32_t MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY = 4U;
@@ -111,11 +113,17 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_CALLBACK_WORKERS_PER_LISTENER = 16U;
 //--------- Communication Resources End---------------------
 
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = build::IOX_MAX_NUMBER_OF_MEMPOOLS;
 constexpr uint32_t MAX_SHM_SEGMENTS = build::IOX_MAX_SHM_SEGMENTS;
+constexpr uint32_t MAX_CHUNKS_PER_MEMPOOL_CACHE = 16U;
+constexpr uint32_t MAX_MEMPOOLS_PER_MEMPOOL_CACHE = 4U;
+/// @brief Maximum number of publishers with a chunk cache ('PublisherOptions::chunkCacheSize') at the same time; the
+/// caches are only acquired by publishers which request one
+constexpr uint32_t MAX_NUMBER_OF_MEMPOOL_CACHES = 64U;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
@@ -129,6 +137,9 @@ constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
 constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
 constexpr uint32_t APP_MAX_MESSAGES = 5U;
 constexpr uint32_t APP_MESSAGE_SIZE = 512U;
+/// @brief the maximum number of ports which are requested with a single IpcMessageType::CREATE_PORTS message; the
+/// requests of a larger batch are distributed over multiple messages
+constexpr uint32_t MAX_PORT_REQUESTS_PER_MESSAGE = 16U;
 
 
 // Processes
@@ -141,6 +152,10 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_CHANGES_EVENT_NAME[] = "ServiceRegistryChanges";
+/// @brief number of service registry changes an application can lag behind before it has to fall back to a copy of
+///        the complete service registry
+constexpr uint32_t SERVICE_REGISTRY_CHANGES_QUEUE_CAPACITY = 64U;
 
 // Resource prefix
 constexpr uint32_t RESOURCE_PREFIX_LENGTH = 13; // 'iox1_' + MAX_UINT16_SIZE + '_i_'/'_u_'
@@ -201,6 +216,22 @@ struct DefaultChunkDistributorConfig
     static constexpr uint64_t MAX_HISTORY_CAPACITY = MAX_PUBLISHER_HISTORY;
 };
 
+/// @brief Maximum time a sender sleeps on full queues with the BLOCK_PRODUCER policy before it retries the delivery;
+/// the sender is usually woken up as soon as a receiver takes a chunk from one of the queues or the queues are modified
+constexpr units::Duration CHUNK_DISTRIBUTOR_BLOCKING_WAIT_TIMEOUT = units::Duration::fromMilliseconds(100U);
+
+/// @brief Maximum number of senders which can sleep on a full queue with the BLOCK_PRODUCER policy at the same time;
+/// further senders poll the queue until it has free space again
+constexpr uint32_t MAX_WAITING_PRODUCERS_PER_CHUNK_QUEUE = 4U;
+
+/// @brief Maximum time the deregistration of a waiting sender waits for receivers which currently wake it up; a receiver
+/// which was terminated while waking up the sender would otherwise block the sender forever
+constexpr units::Duration WAITING_PRODUCER_DEREGISTRATION_TIMEOUT = units::Duration::fromMilliseconds(100U);
+
+/// @brief Maximum number of subscribers which record the latency of the received chunks with
+/// 'SubscriberOptions::recordLatency' at the same time
+constexpr uint32_t MAX_NUMBER_OF_LATENCY_HISTOGRAMS = 64U;
+
 // Default properties of ChunkQueueData
 struct DefaultChunkQueueConfig
 {
@@ -289,8 +320,18 @@ using namespace units::duration_literals;
 constexpr units::Duration PROCESS_DEFAULT_TERMINATION_DELAY = 0_s;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
+/// @brief interval of the process monitoring; the discovery runs as soon as a port notifies a request
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
 
+/// @brief the default number of threads which process the messages of the runtimes; a single thread processes the
+/// messages directly without handing them over to a worker
+/// @note the workers only pay off with multiple cores, which iox-bm-roudi-registration was not measured on yet
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS = 1U;
+/// @brief the maximum number of threads which process the messages of the runtimes
+constexpr uint32_t MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS = 8U;
+/// @brief the number of received runtime messages which can be queued for a single worker thread
+constexpr uint64_t RUNTIME_MESSAGE_WORKER_QUEUE_CAPACITY = 64U;
+
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
@@ -317,6 +358,10 @@ using namespace units::duration_literals;
 constexpr units::Duration PROCESS_WAITING_FOR_ROUDI_TIMEOUT = 60_s;
 constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL = 3 * roudi::DISCOVERY_INTERVAL;  // > DISCOVERY_INTERVAL
 constexpr units::Duration PROCESS_KEEP_ALIVE_TIMEOUT = 5 * PROCESS_KEEP_ALIVE_INTERVAL; // > PROCESS_KEEP_ALIVE_INTERVAL
+/// @brief time the service discovery waits for the complete service registry after it missed a change, before it
+/// answers a search from its outdated registry; RouDi publishes the registry in its next discovery loop
+constexpr units::Duration SERVICE_DISCOVERY_RESYNC_TIMEOUT = 10 * roudi::DISCOVERY_INTERVAL;
+constexpr units::Duration SERVICE_DISCOVERY_RESYNC_POLL_INTERVAL = 1_ms;
 } // namespace runtime
 
 namespace version
@@ -20,6 +20,10 @@
 #define IOX_POSH_GW_GATEWAY_GENERIC_INL
 
 #include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iox/logging.hpp"
+
+#include <algorithm>
+#include <chrono>
 
 // ================================================== Public ================================================== //
 
@@ -37,14 +41,50 @@ template <typename channel_t, typename gateway_t>
 inline void GatewayGeneric<channel_t, gateway_t>::runMultithreaded() noexcept
 {
     m_isRunning.store(true);
-    m_discoveryThread = std::thread([this] { this->discoveryLoop(); });
-    m_forwardingThread = std::thread([this] { this->forwardingLoop(); });
+    if (m_mode == GatewayMode::POLLING)
+    {
+        m_discoveryThread = std::thread([this] { this->discoveryLoop(); });
+        m_forwardingThread = std::thread([this] { this->forwardingLoop(); });
+        return;
+    }
+
+    m_waitSet.emplace();
+    m_waitSet->attachState(static_cast<gateway_t&>(*this), GatewayState::HAS_CAPRO_MESSAGE)
+        .expect("Attaching the gateway to an empty WaitSet");
+    m_waitSet->attachEvent(m_channelsChanged).expect("Attaching the channel trigger to an empty WaitSet");
+
+    if (m_numberOfForwardingWorkers > 1U)
+    {
+        UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(m_forwardingWorkerWakeup)
+            .expect("Valid Semaphore");
+        UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(m_forwardingWorkerFinished)
+            .expect("Valid Semaphore");
+
+        // the event loop forwards channels as well, therefore one worker less is required
+        m_keepForwardingWorkersRunning.store(true);
+        for (uint32_t i = 1U; i < m_numberOfForwardingWorkers; ++i)
+        {
+            m_forwardingWorkers.emplace_back([this] { this->forwardingWorkerLoop(); });
+        }
+    }
+
+    m_forwardingThread = std::thread([this] { this->eventLoop(); });
 }
 
 template <typename channel_t, typename gateway_t>
 inline void GatewayGeneric<channel_t, gateway_t>::shutdown() noexcept
 {
     m_isRunning.store(false);
+    if (m_waitSet)
+    {
+        m_waitSet->markForDestruction();
+    }
     if (m_discoveryThread.joinable())
     {
         m_discoveryThread.join();
@@ -53,6 +93,19 @@ inline void GatewayGeneric<channel_t, gateway_t>::shutdown() noexcept
     {
         m_forwardingThread.join();
     }
+
+    // the workers are stopped after the event loop, which waits for them to finish the scheduled channels
+    m_keepForwardingWorkersRunning.store(false);
+    for (uint64_t i = 0U; i < m_forwardingWorkers.size(); ++i)
+    {
+        IOX_DISCARD_RESULT(m_forwardingWorkerWakeup->post());
+    }
+    for (auto& worker : m_forwardingWorkers)
+    {
+        worker.join();
+    }
+    m_forwardingWorkers.clear();
+    m_waitSet.reset();
 }
 
 template <typename channel_t, typename gateway_t>
@@ -66,11 +119,22 @@ inline uint64_t GatewayGeneric<channel_t, gateway_t>::getNumberOfChannels() cons
 template <typename channel_t, typename gateway_t>
 inline GatewayGeneric<channel_t, gateway_t>::GatewayGeneric(capro::Interfaces commInterface,
                                                             units::Duration discoveryPeriod,
-                                                            units::Duration forwardingPeriod) noexcept
+                                                            units::Duration forwardingPeriod,
+                                                            GatewayMode mode,
+                                                            uint32_t numberOfForwardingWorkers) noexcept
     : gateway_t(commInterface)
     , m_discoveryPeriod(discoveryPeriod)
     , m_forwardingPeriod(forwardingPeriod)
+    , m_mode(mode)
+    , m_numberOfForwardingWorkers(std::max(numberOfForwardingWorkers, 1U))
 {
+    if (m_numberOfForwardingWorkers > MAX_NUMBER_OF_FORWARDING_WORKERS_PER_GATEWAY)
+    {
+        m_numberOfForwardingWorkers = MAX_NUMBER_OF_FORWARDING_WORKERS_PER_GATEWAY;
+        IOX_LOG(Warn,
+                "The number of " << numberOfForwardingWorkers << " forwarding workers exceeds the maximum! Using "
+                                 << m_numberOfForwardingWorkers << " forwarding workers instead.");
+    }
 }
 
 template <typename channel_t, typename gateway_t>
@@ -109,6 +173,8 @@ GatewayGeneric<channel_t, gateway_t>::addChannel(const capro::ServiceDescription
         {
             auto channel = result.value();
             m_channels->push_back(channel);
+            // a running event-driven gateway attaches the new channel in its event loop
+            m_channelsChanged.trigger();
             return ok(channel);
         }
     }
@@ -189,6 +255,184 @@ inline void GatewayGeneric<channel_t, gateway_t>::forwardingLoop() noexcept
     };
 }
 
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::eventLoop() noexcept
+{
+    attachChannels();
+    const auto pollingPeriod = std::chrono::nanoseconds(m_forwardingPeriod.toNanoseconds());
+    auto nextPollingTime = std::chrono::steady_clock::now() + pollingPeriod;
+    while (m_isRunning.load(std::memory_order_relaxed))
+    {
+        typename WaitSet::NotificationInfoVector notifications;
+        if (m_hasPolledChannels)
+        {
+            auto timeUntilPolling = std::max(nextPollingTime - std::chrono::steady_clock::now(),
+                                             std::chrono::steady_clock::duration::zero());
+            notifications = m_waitSet->timedWait(units::Duration::fromNanoseconds(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(timeUntilPolling).count()));
+        }
+        else
+        {
+            notifications = m_waitSet->wait();
+        }
+
+        bool hasCaProMessage{false};
+        bool haveChannelsChanged{false};
+        for (const auto& notification : notifications)
+        {
+            if (notification->doesOriginateFrom(static_cast<gateway_t*>(this)))
+            {
+                hasCaProMessage = true;
+            }
+            else if (notification->doesOriginateFrom(&m_channelsChanged))
+            {
+                haveChannelsChanged = true;
+            }
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        const bool isPollingDue = m_hasPolledChannels && now >= nextPollingTime;
+        if (isPollingDue)
+        {
+            nextPollingTime = now + pollingPeriod;
+        }
+        forwardChannels(notifications, isPollingDue);
+
+        if (hasCaProMessage)
+        {
+            capro::CaproMessage msg;
+            while (this->getCaProMessage(msg))
+            {
+                discover(msg);
+            }
+        }
+
+        if (haveChannelsChanged)
+        {
+            attachChannels();
+        }
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::attachChannels() noexcept
+{
+    if constexpr (HAS_ATTACHABLE_ICEORYX_TERMINAL)
+    {
+        bool isWaitSetFull{false};
+        // channels which are already attached are skipped by the WaitSet with WaitSetError::ALREADY_ATTACHED
+        forEachChannel([&](channel_t& channel) {
+            m_waitSet->attachState(*channel.getIceoryxTerminal(), popo::SubscriberState::HAS_DATA)
+                .or_else([&](auto& error) {
+                    if (error == popo::WaitSetError::WAIT_SET_FULL)
+                    {
+                        isWaitSetFull = true;
+                    }
+                });
+        });
+
+        if (isWaitSetFull && !m_hasPolledChannels)
+        {
+            IOX_LOG(Warn,
+                    "The WaitSet of the gateway is full! The channels which could not be attached are forwarded "
+                    "periodically.");
+        }
+        m_hasPolledChannels = isWaitSetFull;
+    }
+    else
+    {
+        m_hasPolledChannels = true;
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void
+GatewayGeneric<channel_t, gateway_t>::forwardChannels(const typename WaitSet::NotificationInfoVector& notifications,
+                                                      const bool forwardAllChannels) noexcept
+{
+    forEachChannel([&](channel_t& channel) {
+        bool hasData{forwardAllChannels};
+        if constexpr (HAS_ATTACHABLE_ICEORYX_TERMINAL)
+        {
+            const auto* terminal = channel.getIceoryxTerminal().get();
+            hasData = hasData
+                      || std::any_of(notifications.begin(), notifications.end(), [&](const auto& notification) {
+                             return notification->doesOriginateFrom(terminal);
+                         });
+        }
+        if (hasData)
+        {
+            IOX_DISCARD_RESULT(m_channelsToForward.push_back(channel));
+        }
+    });
+
+    if (!m_channelsToForward.empty())
+    {
+        forwardScheduledChannels();
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::forwardScheduledChannels() noexcept
+{
+    m_nextChannelToForward.store(0U, std::memory_order_relaxed);
+    const auto numberOfWakeups =
+        std::min(static_cast<uint64_t>(m_forwardingWorkers.size()), m_channelsToForward.size() - 1U);
+    for (uint64_t i = 0U; i < numberOfWakeups; ++i)
+    {
+        m_forwardingWorkerWakeup->post().or_else([](const auto& error) {
+            IOX_LOG(Error, "Could not wake up the gateway forwarding worker! Error: " << static_cast<uint32_t>(error));
+        });
+    }
+
+    forwardNextScheduledChannels();
+
+    for (uint64_t i = 0U; i < numberOfWakeups; ++i)
+    {
+        if (m_forwardingWorkerFinished->wait().has_error())
+        {
+            IOX_LOG(Error, "Could not wait for the gateway forwarding workers to finish!");
+        }
+    }
+
+    // the copies are released to not keep discarded channels alive
+    m_channelsToForward.clear();
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::forwardNextScheduledChannels() noexcept
+{
+    // the event loop and the workers take the scheduled channels one by one until all are forwarded
+    for (auto index = m_nextChannelToForward.fetch_add(1U); index < m_channelsToForward.size();
+         index = m_nextChannelToForward.fetch_add(1U))
+    {
+        forward(m_channelsToForward[index]);
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::forwardingWorkerLoop() noexcept
+{
+    while (true)
+    {
+        if (m_forwardingWorkerWakeup->wait().has_error())
+        {
+            IOX_LOG(Error, "Could not wait for the gateway channels to forward!");
+        }
+
+        if (!m_keepForwardingWorkersRunning.load())
+        {
+            return;
+        }
+
+        forwardNextScheduledChannels();
+
+        m_forwardingWorkerFinished->post().or_else([](const auto& error) {
+            IOX_LOG(Error, "Could not signal the gateway event loop! Error: " << static_cast<uint32_t>(error));
+        });
+    }
+}
+
 } // namespace gw
 } // namespace iox
 
@@ -23,6 +23,7 @@
 #include "iox/atomic.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
+#include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 
 #include <cstdint>
@@ -37,12 +38,26 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint64_t chunkSize) noexcept;
+                const uint64_t chunkSize,
+                const uint32_t cachedChunks = 0U,
+                const uint64_t spilledChunks = 0U,
+                const uint32_t allocatedChunks = 0U,
+                const uint64_t failedAllocations = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
+    /// chunks acquired by a MemPoolCache which are not included in 'm_usedChunks'
+    uint32_t m_cachedChunks{0};
+    /// chunk requests for this mempool which were served by a larger mempool since this one was exhausted
+    uint64_t m_spilledChunks{0};
+    /// chunks handed out to the user since the creation of the mempool, wraps around at 2^32; the chunks returned by
+    /// the user are not counted separately to keep the hot path free of another read-modify-write, they are
+    /// 'm_allocatedChunks' minus 'm_usedChunks' modulo 2^32
+    uint32_t m_allocatedChunks{0};
+    /// chunk requests for this mempool which could not be served, not even by a larger mempool
+    uint64_t m_failedAllocations{0};
 };
 
 class MemPool
@@ -66,10 +81,43 @@ class MemPool
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    uint32_t getCachedChunks() const noexcept;
+    uint64_t getSpilledChunks() const noexcept;
+    uint32_t getAllocatedChunks() const noexcept;
+    uint64_t getFailedAllocations() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Records that a chunk request for this mempool was served by a larger mempool
+    void increaseSpilledChunks() noexcept;
+
+    /// @brief Records that a chunk request for this mempool could not be served
+    void increaseFailedAllocations() noexcept;
+
+    /// @brief Acquires multiple chunks with a single operation on the free list. The chunks are accounted as cached
+    /// until they are handed out and reported with 'markCachedChunksAsUsed'
+    /// @param[out] chunkIndices is the memory where the indices of the acquired chunks are stored
+    /// @param[in] numberOfChunks is the maximum number of chunks to acquire
+    /// @return the number of acquired chunks
+    uint32_t getChunksForCache(not_null<freeList_t::Index_t*> chunkIndices, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Returns chunks which were acquired with 'getChunksForCache' and not yet handed out with a single
+    /// operation on the free list
+    /// @param[in] chunkIndices are the indices of the chunks to return
+    /// @param[in] numberOfChunks is the number of chunks to return
+    void freeChunksFromCache(not_null<const freeList_t::Index_t*> chunkIndices, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Updates the number of cached chunks after cached chunks were handed out to the user; the allocations
+    /// were already counted by 'getChunksForCache'
+    /// @param[in] numberOfChunks is the number of cached chunks which are in use now
+    void markCachedChunksAsUsed(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Converts an index obtained by 'getChunksForCache' to a pointer to the chunk
+    /// @param[in] index of the chunk
+    /// @return the pointer to the chunk
+    void* getChunkFromIndex(const freeList_t::Index_t index) const noexcept;
+
     /// @brief Converts an index to a chunk in the MemPool to a pointer
     /// @param[in] index of the chunk
     /// @param[in] chunkSize is the size of the chunk
@@ -86,7 +134,19 @@ class MemPool
     pointerToIndex(const void* const chunk, const uint64_t chunkSize, const void* const rawMemoryBase) noexcept;
 
   private:
-    void adjustMinFree() noexcept;
+    /// the used chunks and the allocations share one atomic to update both with a single read-modify-write on the hot
+    /// path; the used chunks occupy the lower 32 bit and never exceed the number of chunks, the allocations occupy the
+    /// upper 32 bit and wrap around
+    static constexpr uint64_t USED_CHUNKS_MASK{0xFFFFFFFFU};
+    static constexpr uint64_t ALLOCATION_SHIFT{32U};
+    static constexpr uint64_t ALLOCATED_AND_USED_CHUNK{(1ULL << ALLOCATION_SHIFT) + 1U};
+
+    static uint32_t usedChunksOf(const uint64_t chunkCounters) noexcept;
+    static uint32_t allocationsOf(const uint64_t chunkCounters) noexcept;
+
+    /// @brief Lowers the watermark of the free chunks to the value which corresponds to 'usedChunks' if it is smaller
+    /// @param[in] usedChunks is the number of used chunks right after the acquisition of chunks
+    void adjustMinFree(const uint32_t usedChunks) noexcept;
     bool isMultipleOfAlignment(const uint64_t value) const noexcept;
 
     RelativePointer<void> m_rawMemory;
@@ -96,8 +156,13 @@ class MemPool
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0U};
 
-    concurrent::Atomic<uint32_t> m_usedChunks{0U};
+    /// the chunks which are not in the free list and the allocations, both including the cached chunks; a batch for a
+    /// MemPoolCache is counted as allocated when it is acquired and the unused rest is subtracted when it is returned
+    concurrent::Atomic<uint64_t> m_chunkCounters{0U};
     concurrent::Atomic<uint32_t> m_minFree{0U};
+    concurrent::Atomic<uint32_t> m_cachedChunks{0U};
+    concurrent::Atomic<uint64_t> m_spilledChunks{0U};
+    concurrent::Atomic<uint64_t> m_failedAllocations{0U};
 
     freeList_t m_freeIndices;
 };
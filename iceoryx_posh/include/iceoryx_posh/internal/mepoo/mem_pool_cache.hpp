@@ -0,0 +1,111 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_MEM_POOL_CACHE_HPP
+#define IOX_POSH_MEPOO_MEM_POOL_CACHE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief A chunk from a MemPoolCache together with the memory for its ChunkManagement
+struct CachedChunk
+{
+    void* chunk{nullptr};
+    void* chunkManagement{nullptr};
+};
+
+/// @brief The MemPoolCache holds magazines of chunks for up to MAX_MEMPOOLS_PER_MEMPOOL_CACHE MemPools and is owned by
+///        a single port. Chunks and their ChunkManagement are acquired from the MemPools in batches and handed out
+///        without touching the shared free lists of the MemPools. This reduces the contention on the free lists when
+///        many publishers use the same MemPool. A port which alternates between a few payload sizes keeps a magazine
+///        per MemPool; only when a further MemPool is requested, the least recently used magazine is released.
+///        The cache is located in the shared memory and is not thread-safe. It must only be used by the owner of the
+///        port and by RouDi once the owner terminated, in order to return the cached chunks to the MemPools.
+class MemPoolCache
+{
+  public:
+    using Index_t = MemPool::freeList_t::Index_t;
+    static constexpr uint32_t CAPACITY{MAX_CHUNKS_PER_MEMPOOL_CACHE};
+    static constexpr uint32_t NUMBER_OF_SLOTS{MAX_MEMPOOLS_PER_MEMPOOL_CACHE};
+
+    /// @brief Creates a MemPoolCache
+    /// @param[in] batchSize is the number of chunks which are acquired from the MemPool at once; a value of '0'
+    /// disables the cache and values larger than CAPACITY are limited to CAPACITY
+    explicit MemPoolCache(const uint32_t batchSize = 0U) noexcept;
+
+    MemPoolCache(const MemPoolCache&) = delete;
+    MemPoolCache(MemPoolCache&&) = delete;
+    MemPoolCache& operator=(const MemPoolCache&) = delete;
+    MemPoolCache& operator=(MemPoolCache&&) = delete;
+    ~MemPoolCache() noexcept = default;
+
+    /// @brief Checks whether the cache is used
+    /// @return true if the batch size is larger than 0, false otherwise
+    bool isEnabled() const noexcept;
+
+    /// @brief Returns the number of chunks which are currently in the cache, summed up over all MemPools
+    uint32_t size() const noexcept;
+
+    /// @brief Takes a chunk from the magazine of the MemPool and refills the magazine if it is empty. If there is no
+    ///        magazine for the MemPool yet and all magazines are in use, the least recently used one is released first.
+    /// @param[in] memPool is the MemPool for the chunk
+    /// @param[in] chunkManagementPool is the MemPool for the ChunkManagement of the chunk
+    /// @return the chunk and the memory for its ChunkManagement or an empty optional if the MemPool is exhausted
+    /// @note only from runtime context
+    optional<CachedChunk> tryGet(MemPool& memPool, MemPool& chunkManagementPool) noexcept;
+
+    /// @brief Returns all cached chunks to the MemPools
+    /// @note from runtime context or from RouDi context once the owner of the port terminated
+    void release() noexcept;
+
+  private:
+    /// @brief The magazine of a single MemPool
+    struct Slot
+    {
+        uint32_t m_size{0U};
+        uint64_t m_lastUse{0U};
+        RelativePointer<MemPool> m_memPool;
+        RelativePointer<MemPool> m_chunkManagementPool;
+        // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) plain arrays which can always be accessed
+        // by RouDi, even if the owner of the port terminated in the middle of an operation
+        Index_t m_chunkIndices[CAPACITY];
+        Index_t m_chunkManagementIndices[CAPACITY];
+        // NOLINTEND(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    };
+
+    Slot& acquireSlot(MemPool& memPool, MemPool& chunkManagementPool) noexcept;
+    bool refill(Slot& slot) noexcept;
+    void release(Slot& slot) noexcept;
+
+  private:
+    uint32_t m_batchSize{0U};
+    uint64_t m_useCounter{0U};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) fixed size for shared memory
+    Slot m_slots[NUMBER_OF_SLOTS];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MEM_POOL_CACHE_HPP
@@ -20,8 +20,10 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
@@ -43,8 +45,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint64_t, 1, std::numeric_limits<uint64_t>::max() - sizeof(ChunkHeader)>;
@@ -73,6 +73,13 @@ class MemoryManager
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains a chunk from the mempools and uses the provided cache to reduce the contention on the mempools
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] cache which is used to acquire the chunk; if the cache is disabled, the chunk is directly acquired
+    /// from the mempool
+    /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings, MemPoolCache& cache) noexcept;
+
     /// @brief Release a chunk back to the mempools
     /// @param[in] chunkManagement Management for the chunk
     static void freeChunk(ChunkManagement& chunkManagement) noexcept;
@@ -95,9 +102,28 @@ class MemoryManager
                     const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
 
+    /// @brief Returns the size class of a chunk, i.e. the exponent of the smallest power of two which is greater or
+    /// equal to the chunk size
+    static uint32_t sizeClassOf(const uint64_t chunkSize) noexcept;
+    /// @brief Fills the size class index; must be called after all mempools are added
+    void generateSizeClassIndex() noexcept;
+    /// @brief Returns the index of the smallest mempool which can hold a chunk of the required size or the number of
+    /// mempools if there is no such mempool
+    uint32_t bestFittingMemPoolIndex(const uint64_t requiredChunkSize) const noexcept;
+    expected<SharedChunk, Error> getChunkImpl(const ChunkSettings& chunkSettings, MemPoolCache* const cache) noexcept;
+
   private:
+    /// one size class for each power of two which fits into a uint64_t
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{65U};
+
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::NO_FALLBACK};
+
+    /// maps a size class to the index of the first mempool which might be able to hold chunks of that size class;
+    /// this mempool or one of its successors with a chunk size of the same size class is the best fitting one
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) fixed size lookup table
+    uint32_t m_sizeClassIndex[NUMBER_OF_SIZE_CLASSES]{};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
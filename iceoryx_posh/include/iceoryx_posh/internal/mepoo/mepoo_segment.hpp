@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/shared_memory_options.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/posix_acl.hpp"
 #include "iox/filesystem.hpp"
@@ -41,7 +42,8 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const PosixGroup& readerGroup,
                  const PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const SharedMemoryOptions& sharedMemoryOptions = SharedMemoryOptions()) noexcept;
 
     PosixGroup getWriterGroup() const noexcept;
     PosixGroup getReaderGroup() const noexcept;
@@ -52,10 +54,14 @@ class MePooSegment
 
     uint64_t getSegmentSize() const noexcept;
 
+    /// @brief The options the shared memory of the segment was created with, e.g. to acquire its NUMA placement
+    const SharedMemoryOptions& getSharedMemoryOptions() const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const DomainId domainId,
-                                                    const PosixGroup& writerGroup) noexcept;
+                                                    const PosixGroup& writerGroup,
+                                                    const SharedMemoryOptions& sharedMemoryOptions) noexcept;
 
   protected:
     PosixGroup m_readerGroup;
@@ -63,6 +69,7 @@ class MePooSegment
     uint64_t m_segmentId{0};
     uint64_t m_segmentSize{0};
     iox::mepoo::MemoryInfo m_memoryInfo;
+    SharedMemoryOptions m_sharedMemoryOptions;
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
 
@@ -42,11 +42,13 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const SharedMemoryOptions& sharedMemoryOptions) noexcept
     : m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
-    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup))
+    , m_sharedMemoryOptions(sharedMemoryOptions)
+    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup, sharedMemoryOptions))
 {
     using namespace detail;
     PosixAcl acl;
@@ -71,7 +73,10 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const DomainId domainId, const PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const DomainId domainId,
+    const PosixGroup& writerGroup,
+    const SharedMemoryOptions& sharedMemoryOptions) noexcept
 {
     return std::move(
         typename SharedMemoryObjectType::Builder()
@@ -94,6 +99,11 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
             .accessMode(AccessMode::ReadWrite)
             .openMode(OpenMode::PurgeAndCreate)
             .permissions(SEGMENT_PERMISSIONS)
+            .transparentHugePages(sharedMemoryOptions.transparentHugePages)
+            .lockMemory(sharedMemoryOptions.lockMemory)
+            .prefaultThreadCount(sharedMemoryOptions.prefaultThreadCount)
+            .numaPolicy(sharedMemoryOptions.numaPolicy)
+            .numaNode(sharedMemoryOptions.numaNode)
             .create()
             .and_then([this](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
@@ -145,6 +155,13 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentSize;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const SharedMemoryOptions&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryOptions() const noexcept
+{
+    return m_sharedMemoryOptions;
+}
+
 } // namespace mepoo
 } // namespace iox
 
@@ -85,8 +85,20 @@ class SegmentManager
 
     using SegmentMappingContainer = vector<SegmentMapping, MAX_SHM_SEGMENTS>;
 
+    /// @brief Acquires the segments a user can map. A user is allowed to have write access to more than one segment
+    /// only if each of these segments is bound to a different NUMA node, otherwise a fatal error is reported.
+    /// @param[in] user for which the segments are acquired
+    /// @return the mappings of the readable and writable segments of the user
     SegmentMappingContainer getSegmentMappings(const PosixUser& user) noexcept;
-    SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept;
+
+    /// @brief Acquires the segment a user allocates its chunks from
+    /// @param[in] user for which the segment is acquired
+    /// @param[in] preferredNumaNode if set, the writable segment which is bound to this NUMA node is preferred
+    /// @return the memory manager and id of the preferred writable segment or, if there is none, of the first
+    /// writable segment
+    SegmentUserInformation
+    getSegmentInformationWithWriteAccessForUser(const PosixUser& user,
+                                                const optional<uint32_t>& preferredNumaNode = nullopt) noexcept;
 
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
@@ -95,6 +107,9 @@ class SegmentManager
   private:
     void createSegment(const SegmentConfig::SegmentEntry& segmentEntry, const DomainId domainId) noexcept;
 
+    static bool isBoundToNumaNode(const SegmentType& segment, const uint32_t numaNode) noexcept;
+    static bool areBoundToDistinctNumaNodes(const vector<const SegmentType*, MAX_SHM_SEGMENTS>& segments) noexcept;
+
   private:
     template <typename MemoryManger, typename SegmentManager, typename PublisherPort>
     friend class roudi::MemPoolIntrospection;
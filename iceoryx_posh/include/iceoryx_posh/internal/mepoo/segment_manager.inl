@@ -58,7 +58,8 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
                                     *m_managementAllocator,
                                     readerGroup,
                                     writerGroup,
-                                    segmentEntry.m_memoryInfo);
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_sharedMemoryOptions);
 }
 
 template <typename SegmentType>
@@ -69,7 +70,7 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
     auto groupContainer = user.getGroups();
 
     SegmentManager::SegmentMappingContainer mappingContainer;
-    bool foundInWriterGroup = false;
+    vector<const SegmentType*, MAX_SHM_SEGMENTS> writableSegments;
 
     // with the groups we can get all the segments (read or write) for the user
     for (const auto& groupID : groupContainer)
@@ -78,23 +79,21 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
         {
             if (segment.getWriterGroup() == groupID)
             {
-                // a user is allowed to be only in one writer group, as we currently only support one memory manager per
-                // process
-                if (!foundInWriterGroup)
-                {
-                    mappingContainer.emplace_back(
-                        segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
-                    foundInWriterGroup = true;
-                }
-                else
-                {
-                    IOX_REPORT_FATAL(PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT);
-                    return SegmentManager::SegmentMappingContainer();
-                }
+                mappingContainer.emplace_back(
+                    segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
+                writableSegments.emplace_back(&segment);
             }
         }
     }
 
+    // a user is allowed to be only in one writer group, unless each of its writable segments is bound to another NUMA
+    // node; this lets the publishers choose the segment which is local to their thread
+    if (writableSegments.size() > 1U && !areBoundToDistinctNumaNodes(writableSegments))
+    {
+        IOX_REPORT_FATAL(PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT);
+        return SegmentManager::SegmentMappingContainer();
+    }
+
     for (const auto& groupID : groupContainer)
     {
         for (const auto& segment : m_segmentContainer)
@@ -116,7 +115,8 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
 
 template <typename SegmentType>
 inline typename SegmentManager<SegmentType>::SegmentUserInformation
-SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept
+SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(
+    const PosixUser& user, const optional<uint32_t>& preferredNumaNode) noexcept
 {
     auto groupContainer = user.getGroups();
 
@@ -129,9 +129,20 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const P
         {
             if (segment.getWriterGroup() == groupID)
             {
-                segmentInfo.m_memoryManager = segment.getMemoryManager();
-                segmentInfo.m_segmentID = segment.getSegmentId();
-                return segmentInfo;
+                // the first writable segment is used when there is no segment on the preferred NUMA node
+                const bool isFirstWritableSegment = !segmentInfo.m_memoryManager.has_value();
+                const bool isOnPreferredNumaNode =
+                    preferredNumaNode.has_value() && isBoundToNumaNode(segment, preferredNumaNode.value());
+                if (isFirstWritableSegment || isOnPreferredNumaNode)
+                {
+                    segmentInfo.m_memoryManager = segment.getMemoryManager();
+                    segmentInfo.m_segmentID = segment.getSegmentId();
+                }
+
+                if (!preferredNumaNode.has_value() || isOnPreferredNumaNode)
+                {
+                    return segmentInfo;
+                }
             }
         }
     }
@@ -139,6 +150,36 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const P
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline bool SegmentManager<SegmentType>::isBoundToNumaNode(const SegmentType& segment,
+                                                           const uint32_t numaNode) noexcept
+{
+    const auto& sharedMemoryOptions = segment.getSharedMemoryOptions();
+    return sharedMemoryOptions.numaPolicy == NumaPolicy::BIND && sharedMemoryOptions.numaNode == numaNode;
+}
+
+template <typename SegmentType>
+inline bool SegmentManager<SegmentType>::areBoundToDistinctNumaNodes(
+    const vector<const SegmentType*, MAX_SHM_SEGMENTS>& segments) noexcept
+{
+    for (uint64_t i = 0U; i < segments.size(); ++i)
+    {
+        const auto& sharedMemoryOptions = segments[i]->getSharedMemoryOptions();
+        if (sharedMemoryOptions.numaPolicy != NumaPolicy::BIND)
+        {
+            return false;
+        }
+        for (uint64_t j = i + 1U; j < segments.size(); ++j)
+        {
+            if (isBoundToNumaNode(*segments[j], sharedMemoryOptions.numaNode))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
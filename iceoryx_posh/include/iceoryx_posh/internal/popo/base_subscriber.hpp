@@ -24,9 +24,12 @@
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/expected.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
 #include "iox/unique_ptr.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -127,6 +130,20 @@ class BaseSubscriber
     /// port
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief small helper method which forwards to the 'tryGetChunks' method of the port
+    /// @param[in] maxNumberOfChunks is the maximum number of chunks to take
+    /// @param[in] onChunk is called with the ChunkHeader of each chunk; it must not call into the subscriber
+    expected<uint64_t, ChunkReceiveResult>
+    takeChunks(const uint64_t maxNumberOfChunks,
+               const function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept;
+
+    /// @brief takes the chunks batch-wise from the port and calls 'onChunk' for each of them once its batch was taken,
+    /// therefore 'onChunk' is allowed to release the chunk; at most MAX_SUBSCRIBER_QUEUE_CAPACITY chunks are taken to
+    /// prevent that a fast publisher keeps the caller busy forever
+    /// @param[in] onChunk is called with the ChunkHeader of each chunk
+    expected<uint64_t, ChunkReceiveResult>
+    takeAllChunks(const function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
@@ -164,6 +181,8 @@ class BaseSubscriber
     port_t& port() noexcept;
 
   protected:
+    static constexpr uint64_t TAKE_ALL_BATCH_SIZE{64U};
+
     port_t m_port{nullptr};
     TriggerHandle m_trigger;
 };
@@ -99,6 +99,51 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscriber<po
     return m_port.tryGetChunk();
 }
 
+template <typename port_t>
+inline expected<uint64_t, ChunkReceiveResult>
+BaseSubscriber<port_t>::takeChunks(const uint64_t maxNumberOfChunks,
+                                   const function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept
+{
+    return m_port.tryGetChunks(maxNumberOfChunks, onChunk);
+}
+
+template <typename port_t>
+inline expected<uint64_t, ChunkReceiveResult>
+BaseSubscriber<port_t>::takeAllChunks(const function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept
+{
+    uint64_t numberOfTakenChunks{0U};
+    vector<const mepoo::ChunkHeader*, TAKE_ALL_BATCH_SIZE> chunkHeaders;
+    while (numberOfTakenChunks < MAX_SUBSCRIBER_QUEUE_CAPACITY)
+    {
+        const auto maxNumberOfChunks =
+            algorithm::minVal(TAKE_ALL_BATCH_SIZE, MAX_SUBSCRIBER_QUEUE_CAPACITY - numberOfTakenChunks);
+        auto result = m_port.tryGetChunks(maxNumberOfChunks, [&](const mepoo::ChunkHeader* chunkHeader) {
+            chunkHeaders.push_back(chunkHeader);
+        });
+        if (result.has_error())
+        {
+            if (numberOfTakenChunks == 0U)
+            {
+                return err(result.error());
+            }
+            break;
+        }
+
+        for (auto chunkHeader : chunkHeaders)
+        {
+            onChunk(chunkHeader);
+        }
+        chunkHeaders.clear();
+
+        numberOfTakenChunks += result.value();
+        if (result.value() < maxNumberOfChunks)
+        {
+            break;
+        }
+    }
+    return ok(numberOfTakenChunks);
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
 {
@@ -22,10 +22,12 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 #include <algorithm>
-#include <iterator>
+#include <mutex>
 #include <thread>
 
 namespace iox
@@ -50,17 +52,26 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
-/// @todo iox-#1713 There are currently some challenges:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
-/// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
-/// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
-/// terminated user application. Even if access from middleware and user threads do not overlap, the history
-/// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
-/// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
-/// A perfect job for our future selves
+/// The stored queues are an exception to this. The sender accesses them lock-free via the active snapshot of the
+/// queue container while adding and removing queues is serialized by the lock and published as a new snapshot. The
+/// modifying side never waits for the sender. If the sender has not yet released the previous snapshot, the
+/// modification stays pending and is published later with publishPendingQueues. A removed queue must not be given
+/// back while isQueueAccessibleBySender returns true since a sender which is only stopped or preempted would access
+/// it once it continues. Only when the sender is detached from its owner or when the sender heartbeat shows that the
+/// process monitoring considers the sending application as dead, the snapshot is reclaimed without the sender.
+/// Therefore, sending chunks never blocks on adding or removing queues and a sender which was terminated while
+/// delivering a chunk cannot deadlock RouDi.
+/// With the WAIT_FOR_CONSUMER policy, a sender which faces full queues with the BLOCK_PRODUCER policy registers its
+/// wake-up semaphore in each of them and sleeps once for all of them instead of spinning. It is woken up when a
+/// receiver takes a chunk from one of the queues or the queues are modified and retries at the latest after
+/// CHUNK_DISTRIBUTOR_BLOCKING_WAIT_TIMEOUT.
+/// The history is not thread safe and is updated under the inter-process lock. Without a history, the lock is never
+/// taken by the sender. The cleanup() call frees the chunks which are still held by a not properly terminated user
+/// application; it does not take the lock and the history is stored such that it can be released even if the
+/// application was terminated while updating it. The modifications of a sender which is detached from its owner do
+/// not take the lock either.
+/// @todo iox-#1713 A queue can still not be added or removed while the lock is held by an application which was
+/// terminated while updating the history and whose sender is not yet detached
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -104,6 +115,13 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in order to all the stored chunk queues with a single pass over the
+    /// queues. The consumer of a queue is notified once per batch instead of once per chunk. The chunks will be added
+    /// to the chunk history
+    /// @param[in] chunks are the SharedChunks to be delivered
+    /// @return the number of queues the chunks were delivered to
+    uint64_t deliverBatchToAllStoredQueues(const span<const mepoo::SharedChunk> chunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -116,7 +134,8 @@ class ChunkDistributor
     /// @brief Lookup for the index of a queue with a specific iox::UniqueId
     /// @param[in] uniqueQueueId is the unique ID of the queue to query the index
     /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId; if the queue is not
-    /// found at the index, the queue is searched by iteration over all stored queues
+    /// found at the index, the queue is looked up in the unique id table of the stored queues or, if the
+    /// ChunkDistributorData has no such tables, searched by iteration over all stored queues
     /// @return the index of the queue with uniqueQueueId or nullopt if the queue was not found
     optional<uint32_t> getQueueIndex(const UniqueId uniqueQueueId, const uint32_t lastKnownQueueIndex) const noexcept;
 
@@ -137,14 +156,143 @@ class ChunkDistributor
     void clearHistory() noexcept;
 
     /// @brief cleanup the used shrared memory chunks
+    /// @attention Contract is that the owner of the sender does not use it anymore; the lock is not taken
     void cleanup() noexcept;
 
+    /// @brief Detaches the sender from the application which owns it; called by RouDi before it destroys the port in
+    /// order to reclaim a queue snapshot which is still pinned by the owner when the queues are removed
+    void detachSenderFromOwner() noexcept;
+
+    /// @brief Publishes the modifications of the stored queues which are pending since the sender had not yet
+    /// released the previous queue snapshot
+    /// @return true if no modification is pending anymore, false if the sender still holds the previous snapshot
+    bool publishPendingQueues() noexcept;
+
+    /// @brief Checks whether the sender might still access a queue; this is the case while the queue is in the active
+    /// snapshot, e.g. when its removal is pending, or in the previous snapshot which is still pinned by the sender
+    /// @param[in] queue to check
+    /// @return true if the queue must not be given back yet, false otherwise
+    bool isQueueAccessibleBySender(not_null<const ChunkQueueData_t* const> queue) const noexcept;
+
   protected:
+    using QueueContainer_t = typename MemberType_t::QueueContainer_t;
+
+    /// @brief Pins the active queue snapshot for the lifetime of the guard. The snapshot is not modified while it is
+    /// pinned and the queues it contains stay valid
+    class QueueSnapshotGuard
+    {
+      public:
+        explicit QueueSnapshotGuard(const MemberType_t& members) noexcept;
+        QueueSnapshotGuard(const QueueSnapshotGuard&) = delete;
+        QueueSnapshotGuard(QueueSnapshotGuard&&) = delete;
+        QueueSnapshotGuard& operator=(const QueueSnapshotGuard&) = delete;
+        QueueSnapshotGuard& operator=(QueueSnapshotGuard&&) = delete;
+        ~QueueSnapshotGuard() noexcept;
+
+        const QueueContainer_t& queues() const noexcept;
+
+        /// @brief The table which maps the unique ids of the queues in the snapshot to their index; only available
+        /// with 'HAS_QUEUE_INDEX_TABLES'
+        const uint32_t* queueIndexTable() const noexcept;
+
+      private:
+        const MemberType_t& m_members;
+        uint32_t m_snapshot{0U};
+    };
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+  private:
+    /// @brief Registers the wake-up semaphore of the sender in the full queues it waits for and removes the
+    /// registrations on destruction. The queues must stay pinned by a QueueSnapshotGuard for the lifetime of the object
+    class WaitingSenderRegistration
+    {
+      public:
+        /// @param[in] members of the ChunkDistributor
+        /// @param[in] fallbackWait is used when a queue had no free registration slot; it is provided by the caller in
+        /// order to keep its backoff across the retries of a delivery
+        WaitingSenderRegistration(MemberType_t& members, iox::detail::adaptive_wait& fallbackWait) noexcept;
+        WaitingSenderRegistration(const WaitingSenderRegistration&) = delete;
+        WaitingSenderRegistration(WaitingSenderRegistration&&) = delete;
+        WaitingSenderRegistration& operator=(const WaitingSenderRegistration&) = delete;
+        WaitingSenderRegistration& operator=(WaitingSenderRegistration&&) = delete;
+        ~WaitingSenderRegistration() noexcept;
+
+        /// @brief Registers the sender in the queue; the delivery must be retried afterwards since a chunk which was
+        /// taken from the queue before the registration does not wake up the sender
+        /// @param[in] queue is the full queue the sender waits for
+        void registerAt(ChunkQueueData_t& queue) noexcept;
+
+        /// @brief Sleeps until a chunk was taken from one of the queues, the queues were modified or
+        /// CHUNK_DISTRIBUTOR_BLOCKING_WAIT_TIMEOUT has passed. If a queue had no free registration slot, the sender
+        /// would not be woken up by this queue and falls back to the adaptive wait
+        void wait() noexcept;
+
+      private:
+        struct Registration
+        {
+            ChunkQueueData_t* queue{nullptr};
+            uint32_t slot{0U};
+        };
+
+        MemberType_t& m_members;
+        vector<Registration, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> m_registrations;
+        iox::detail::adaptive_wait& m_fallbackWait;
+        bool m_isRegisteredAtAllQueues{true};
+    };
+
+    /// @brief Returns the stored queues, which might not yet be published; must only be called with the lock held
+    const QueueContainer_t& storedQueues() const noexcept;
+
+    /// @brief Takes the lock unless the sender is detached from its owner. A detached sender is only accessed by
+    /// RouDi, which serializes the modifications, and the lock might be held by an owner which was terminated
+    std::unique_lock<const MemberType_t> lockUnlessDetached() const noexcept;
+
+    /// @brief Applies the modification to the stored queues and tries to publish them as new active snapshot; must
+    /// only be called with the lock held
+    /// @param[in] modification which is applied to the stored queues
+    void modifyQueues(const function_ref<void(QueueContainer_t&)> modification) noexcept;
+
+    /// @brief Publishes the stored queues in the inactive snapshot if they have pending modifications and the
+    /// inactive snapshot is not pinned by the sender anymore; must only be called with the lock held
+    /// @return true if no modification is pending anymore
+    bool tryPublishQueues() noexcept;
+
+    /// @brief Checks whether the owner does not use the sender anymore, i.e. the sender is detached from its owner or
+    /// the process monitoring considers the owner as dead
+    bool isSenderGone() const noexcept;
+
+    /// @brief Fills the unique id table of a snapshot with the queues of the snapshot; must only be called with
+    /// 'HAS_QUEUE_INDEX_TABLES', with the lock held and for a snapshot which is not pinned by a sender
+    /// @param[in] snapshot is the index of the snapshot to update
+    void rebuildQueueIndexTable(const uint32_t snapshot) noexcept;
+
+    /// @brief Adds the chunk to the history; must only be called with the lock held
+    /// @param[in] chunk to add to the chunk history
+    void addToHistory(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief The slot of the history ring buffer which stores the chunk with the provided age index, starting with
+    /// the oldest chunk at index 0
+    uint64_t historySlot(const uint64_t index) const noexcept;
+
+    /// @brief Releases all chunks of the history and resets it
+    void releaseHistory() noexcept;
+
+    static optional<uint32_t> findQueueIndex(const QueueSnapshotGuard& snapshot,
+                                             const UniqueId uniqueQueueId,
+                                             const uint32_t lastKnownQueueIndex) noexcept;
+
+    /// @brief Looks up a queue of a snapshot by its unique id. Unlike the address of a queue, the unique id is never
+    /// reused, therefore a new queue which took over the memory of a removed one is not mistaken for it
+    /// @return the queue or a nullptr if it is not in the snapshot
+    static ChunkQueueData_t* findQueueById(const QueueContainer_t& queues, const UniqueId uniqueQueueId) noexcept;
+
+    /// @brief The slot in the unique id table at which the lookup of a queue starts
+    static uint32_t queueIndexTableSlot(const UniqueId uniqueQueueId) noexcept;
+
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
@@ -46,28 +46,291 @@ ChunkDistributor<ChunkDistributorDataType>::getMembers() noexcept
     return m_chunkDistrubutorDataPtr;
 }
 
+template <typename ChunkDistributorDataType>
+inline ChunkDistributor<ChunkDistributorDataType>::QueueSnapshotGuard::QueueSnapshotGuard(
+    const MemberType_t& members) noexcept
+    : m_members(members)
+{
+    // the snapshot is only pinned when it is still the active one after the reader counter was incremented;
+    // otherwise the modifying side might already reuse it
+    bool isPinned{false};
+    do
+    {
+        m_snapshot = m_members.m_activeQueueSnapshot.load();
+        m_members.m_queueSnapshotReaders[m_snapshot].fetch_add(1U);
+        isPinned = (m_members.m_activeQueueSnapshot.load() == m_snapshot);
+        if (!isPinned)
+        {
+            m_members.m_queueSnapshotReaders[m_snapshot].fetch_sub(1U);
+        }
+    } while (!isPinned);
+}
+
+template <typename ChunkDistributorDataType>
+inline ChunkDistributor<ChunkDistributorDataType>::QueueSnapshotGuard::~QueueSnapshotGuard() noexcept
+{
+    // the counter does not drop below zero since a modification might have reclaimed the snapshot of a sender which
+    // is detached or considered dead
+    auto readers = m_members.m_queueSnapshotReaders[m_snapshot].load(std::memory_order_relaxed);
+    while (readers > 0U
+           && !m_members.m_queueSnapshotReaders[m_snapshot].compare_exchange_weak(
+               readers, readers - 1U, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributor<ChunkDistributorDataType>::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::QueueSnapshotGuard::queues() const noexcept
+{
+    return m_members.m_queueSnapshots[m_snapshot];
+}
+
+template <typename ChunkDistributorDataType>
+inline const uint32_t* ChunkDistributor<ChunkDistributorDataType>::QueueSnapshotGuard::queueIndexTable() const noexcept
+{
+    return &m_members.m_queueIndexTables.m_tables[m_snapshot][0];
+}
+
+template <typename ChunkDistributorDataType>
+inline ChunkDistributor<ChunkDistributorDataType>::WaitingSenderRegistration::WaitingSenderRegistration(
+    MemberType_t& members, iox::detail::adaptive_wait& fallbackWait) noexcept
+    : m_members(members)
+    , m_fallbackWait(fallbackWait)
+{
+    // wake-ups of a previous wait are outdated since the delivery is retried after the registration anyway
+    bool hasFatalError = false;
+    while (!hasFatalError
+           && m_members.m_senderWakeUpSemaphore->tryWait()
+                  .or_else([&](auto) {
+                      IOX_REPORT_FATAL(PoshError::POPO__CHUNK_DISTRIBUTOR_SEMAPHORE_CORRUPTED_IN_WAIT);
+                      hasFatalError = true;
+                  })
+                  .value())
+    {
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline ChunkDistributor<ChunkDistributorDataType>::WaitingSenderRegistration::~WaitingSenderRegistration() noexcept
+{
+    for (auto& registration : m_registrations)
+    {
+        registration.queue->m_waitingProducers.deregisterProducer(registration.slot);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::WaitingSenderRegistration::registerAt(ChunkQueueData_t& queue) noexcept
+{
+    auto slot = queue.m_waitingProducers.registerProducer(*m_members.m_senderWakeUpSemaphore);
+    if (slot.has_value())
+    {
+        m_registrations.emplace_back(Registration{&queue, slot.value()});
+    }
+    else
+    {
+        m_isRegisteredAtAllQueues = false;
+    }
+
+    // pairs with the fence of the receiver after taking a chunk; either the retry of the delivery sees the free space
+    // or the receiver sees the registration
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::WaitingSenderRegistration::wait() noexcept
+{
+    if (!m_isRegisteredAtAllQueues)
+    {
+        m_fallbackWait.wait();
+        return;
+    }
+
+    if (m_members.m_senderWakeUpSemaphore->timedWait(CHUNK_DISTRIBUTOR_BLOCKING_WAIT_TIMEOUT).has_error())
+    {
+        IOX_REPORT_FATAL(PoshError::POPO__CHUNK_DISTRIBUTOR_SEMAPHORE_CORRUPTED_IN_WAIT);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributor<ChunkDistributorDataType>::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::storedQueues() const noexcept
+{
+    return getMembers()->m_queues;
+}
+
+template <typename ChunkDistributorDataType>
+inline std::unique_lock<const typename ChunkDistributor<ChunkDistributorDataType>::MemberType_t>
+ChunkDistributor<ChunkDistributorDataType>::lockUnlessDetached() const noexcept
+{
+    std::unique_lock<const MemberType_t> lock(*getMembers(), std::defer_lock);
+    if (!getMembers()->m_isSenderDetached.load(std::memory_order_relaxed))
+    {
+        lock.lock();
+    }
+    return lock;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::modifyQueues(
+    const function_ref<void(QueueContainer_t&)> modification) noexcept
+{
+    modification(getMembers()->m_queues);
+    getMembers()->m_hasPendingQueues.store(true, std::memory_order_relaxed);
+
+    if (!tryPublishQueues())
+    {
+        IOX_LOG(Debug,
+                "The sender still uses the previous queue snapshot; the modification of the queues is published "
+                "once the snapshot is released.");
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::tryPublishQueues() noexcept
+{
+    auto* members = getMembers();
+    if (!members->m_hasPendingQueues.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    const auto activeSnapshot = members->m_activeQueueSnapshot.load(std::memory_order_relaxed);
+    const auto nextSnapshot = (activeSnapshot + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    // the inactive snapshot is reused only after the grace period of the sender; a sender which is stopped, debugged
+    // or preempted still holds it and would access the queues of the new snapshot in the middle of the copy
+    if (members->m_queueSnapshotReaders[nextSnapshot].load() > 0U)
+    {
+        if (!isSenderGone())
+        {
+            return false;
+        }
+        // all readers are threads of the owner, which does not use the sender anymore
+        members->m_queueSnapshotReaders[nextSnapshot].store(0U);
+    }
+
+    members->m_queueSnapshots[nextSnapshot] = members->m_queues;
+    if constexpr (MemberType_t::HAS_QUEUE_INDEX_TABLES)
+    {
+        rebuildQueueIndexTable(nextSnapshot);
+    }
+    members->m_activeQueueSnapshot.store(nextSnapshot);
+    members->m_hasPendingQueues.store(false, std::memory_order_relaxed);
+
+    // a sender which waits for full queues sleeps with the previous snapshot pinned; it is woken up to release the
+    // snapshot and to re-evaluate the queues it has to deliver to
+    if (members->m_senderWakeUpSemaphore.has_value() && members->m_queueSnapshotReaders[activeSnapshot].load() > 0U)
+    {
+        members->m_senderWakeUpSemaphore->post().or_else(
+            [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CHUNK_DISTRIBUTOR_SEMAPHORE_CORRUPTED_IN_WAIT); });
+    }
+
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isSenderGone() const noexcept
+{
+    if (getMembers()->m_isSenderDetached.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    const auto* heartbeat = getMembers()->m_senderHeartbeat.get();
+    return heartbeat != nullptr
+           && heartbeat->elapsed_milliseconds_since_last_beat() > runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::publishPendingQueues() noexcept
+{
+    if (!getMembers()->m_hasPendingQueues.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    auto lock = lockUnlessDetached();
+    return tryPublishQueues();
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isQueueAccessibleBySender(
+    not_null<const ChunkQueueData_t* const> queue) const noexcept
+{
+    auto lock = lockUnlessDetached();
+
+    const auto* members = getMembers();
+    const auto contains = [&](const QueueContainer_t& queues) {
+        return std::find_if(queues.begin(), queues.end(), [&](const RelativePointer<ChunkQueueData_t>& storedQueue) {
+                   return storedQueue.get() == queue;
+               })
+               != queues.end();
+    };
+
+    // a queue whose removal is still pending is in the active snapshot
+    const auto activeSnapshot = members->m_activeQueueSnapshot.load(std::memory_order_relaxed);
+    if (contains(members->m_queueSnapshots[activeSnapshot]))
+    {
+        return true;
+    }
+
+    const auto previousSnapshot = (activeSnapshot + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+    return members->m_queueSnapshotReaders[previousSnapshot].load() > 0U && !isSenderGone()
+           && contains(members->m_queueSnapshots[previousSnapshot]);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::detachSenderFromOwner() noexcept
+{
+    // the lock is not taken since the owner might have terminated while holding it; the heartbeat is only accessed
+    // by RouDi, which serializes the modifications and the destruction of the ports
+    getMembers()->m_senderHeartbeat = nullptr;
+    getMembers()->m_isSenderDetached.store(true, std::memory_order_relaxed);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::rebuildQueueIndexTable(const uint32_t snapshot) noexcept
+{
+    auto* members = getMembers();
+    auto& table = members->m_queueIndexTables.m_tables[snapshot];
+    std::fill(std::begin(table), std::end(table), MemberType_t::INVALID_QUEUE_INDEX);
+
+    constexpr uint32_t SLOT_MASK{MemberType_t::QUEUE_INDEX_TABLE_CAPACITY - 1U};
+    const auto& queues = members->m_queueSnapshots[snapshot];
+    for (uint32_t index = 0U; index < queues.size(); ++index)
+    {
+        // the table is at most half full, there is always a free slot
+        auto slot = queueIndexTableSlot(queues[index]->m_uniqueId);
+        while (table[slot] != MemberType_t::INVALID_QUEUE_INDEX)
+        {
+            slot = (slot + 1U) & SLOT_MASK;
+        }
+        table[slot] = index;
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_t* const> queueToAdd,
                                                         const uint64_t requestedHistory) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    auto lock = lockUnlessDetached();
 
+    const auto& queues = storedQueues();
     const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const RelativePointer<ChunkQueueData_t> queue) { return queue.get() == queueToAdd; });
+        std::find_if(queues.begin(), queues.end(), [&](const RelativePointer<ChunkQueueData_t> queue) {
+            return queue.get() == queueToAdd;
+        });
 
     // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    if (alreadyKnownReceiver == queues.end())
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (queues.size() < queues.capacity())
         {
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
-            // pushing will be fine
-            getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
-
-            const auto currChunkHistorySize = getMembers()->m_history.size();
+            const auto currChunkHistorySize = getMembers()->m_historySize;
 
             if (requestedHistory > getMembers()->m_historyCapacity)
             {
@@ -76,15 +339,23 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                             << requestedHistory << ". Capacity is " << getMembers()->m_historyCapacity << ".");
             }
 
+            // the history is delivered before the queue is visible for the sender; this ensures that the new queue
+            // does not get a chunk twice, once from the history and once from the sender
             // if the current history is large enough we send the requested number of chunks, else we send the
             // total history
             const auto startIndex =
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
             for (auto i = startIndex; i < currChunkHistorySize; ++i)
             {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                pushToQueue(queueToAdd, getMembers()->m_history[historySlot(i)].cloneToSharedChunk());
             }
 
+            modifyQueues([&](QueueContainer_t& nextQueues) {
+                // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
+                // pushing will be fine
+                nextQueues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            });
+
             return ok();
         }
         else
@@ -104,15 +375,18 @@ template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueData_t* const> queueToRemove) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    auto lock = lockUnlessDetached();
 
-    const auto iter = std::find(getMembers()->m_queues.begin(),
-                                getMembers()->m_queues.end(),
-                                static_cast<ChunkQueueData_t* const>(queueToRemove));
-    if (iter != getMembers()->m_queues.end())
+    const auto& queues = storedQueues();
+    const auto iter = std::find(queues.begin(), queues.end(), static_cast<ChunkQueueData_t* const>(queueToRemove));
+    if (iter != queues.end())
     {
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        modifyQueues([&](QueueContainer_t& nextQueues) {
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be
+            // ignored
+            nextQueues.erase(
+                std::find(nextQueues.begin(), nextQueues.end(), static_cast<ChunkQueueData_t* const>(queueToRemove)));
+        });
 
         return ok();
     }
@@ -125,31 +399,33 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    auto lock = lockUnlessDetached();
 
-    getMembers()->m_queues.clear();
+    if (!storedQueues().empty())
+    {
+        modifyQueues([](QueueContainer_t& nextQueues) { nextQueues.clear(); });
+    }
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    QueueSnapshotGuard snapshot(*getMembers());
 
-    return !getMembers()->m_queues.empty();
+    return !snapshot.queues().empty();
 }
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    using QueueContainer = decltype(getMembers()->m_queues);
-    QueueContainer fullQueuesAwaitingDelivery;
+    vector<UniqueId, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> fullQueuesAwaitingDelivery;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        QueueSnapshotGuard snapshot(*getMembers());
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
         // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        for (auto& queue : snapshot.queues())
         {
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
@@ -161,63 +437,55 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
             {
                 if (isBlockingQueue)
                 {
-                    fullQueuesAwaitingDelivery.emplace_back(queue);
+                    fullQueuesAwaitingDelivery.emplace_back(queue->m_uniqueId);
                 }
                 else
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                     ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    getMembers()->m_numberOfLostChunks.fetch_add(1U, std::memory_order_relaxed);
                 }
             }
         }
     }
 
-    // busy waiting until every queue is served
-    iox::detail::adaptive_wait adaptiveWait;
+    // retry until every queue is served; in between the sender sleeps until a chunk was taken from a full queue
+    iox::detail::adaptive_wait fallbackWait;
     while (!fullQueuesAwaitingDelivery.empty())
     {
-        adaptiveWait.wait();
         {
-            // create intersection of current queues and fullQueuesAwaitingDelivery
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            QueueContainer remainingQueues;
-            using QueueContainerValue = typename QueueContainer::value_type;
-            auto greaterThan = [](const QueueContainerValue& a, const QueueContainerValue& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-            std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic pop
-#endif
-
-            std::set_intersection(getMembers()->m_queues.begin(),
-                                  getMembers()->m_queues.end(),
-                                  fullQueuesAwaitingDelivery.begin(),
-                                  fullQueuesAwaitingDelivery.end(),
-                                  std::back_inserter(remainingQueues),
-                                  greaterThan);
+            // the subscribers might have unsubscribed in the meantime; only the queues which are still stored are
+            // served. They are matched by their unique id since the memory of a removed queue can be reused by a new one
+            QueueSnapshotGuard snapshot(*getMembers());
+            auto remainingQueues = fullQueuesAwaitingDelivery;
             fullQueuesAwaitingDelivery.clear();
 
-            // deliver to remaining queues
-            for (auto& queue : remainingQueues)
+            // the sender is registered at each queue before the retry and sleeps once for all queues which are still
+            // full. The snapshot stays pinned while sleeping since the queues must not be released
+            WaitingSenderRegistration registration(*getMembers(), fallbackWait);
+            for (const auto& uniqueQueueId : remainingQueues)
             {
-                if (pushToQueue(queue.get(), chunk))
+                auto* queue = findQueueById(snapshot.queues(), uniqueQueueId);
+                if (queue == nullptr)
+                {
+                    continue;
+                }
+
+                registration.registerAt(*queue);
+                if (pushToQueue(queue, chunk))
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                 }
                 else
                 {
-                    fullQueuesAwaitingDelivery.push_back(queue);
+                    fullQueuesAwaitingDelivery.push_back(uniqueQueueId);
                 }
             }
+
+            if (!fullQueuesAwaitingDelivery.empty())
+            {
+                registration.wait();
+            }
         }
     }
 
@@ -226,6 +494,122 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverBatchToAllStoredQueues(
+    const span<const mepoo::SharedChunk> chunks) noexcept
+{
+    if (chunks.empty())
+    {
+        return 0U;
+    }
+
+    // a full blocking queue and the index of the first chunk which was not yet delivered to it
+    struct PendingDelivery
+    {
+        UniqueId queueId;
+        uint64_t nextChunk{0U};
+    };
+    vector<PendingDelivery, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> pendingDeliveries;
+
+    uint64_t numberOfQueuesTheChunksWereDeliveredTo{0U};
+    {
+        QueueSnapshotGuard snapshot(*getMembers());
+
+        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+        // send all chunks to a queue before notifying its consumer once
+        for (auto& queue : snapshot.queues())
+        {
+            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+            ChunkQueuePusher_t pusher(queue.get());
+            uint64_t nextChunk{0U};
+            for (; nextChunk < chunks.size(); ++nextChunk)
+            {
+                if (!pusher.pushWithoutNotification(chunks[nextChunk]))
+                {
+                    if (isBlockingQueue)
+                    {
+                        break;
+                    }
+                    pusher.lostAChunk();
+                    getMembers()->m_numberOfLostChunks.fetch_add(1U, std::memory_order_relaxed);
+                }
+            }
+            pusher.notifyConsumer();
+
+            if (nextChunk < chunks.size())
+            {
+                pendingDeliveries.emplace_back(PendingDelivery{queue->m_uniqueId, nextChunk});
+            }
+            else
+            {
+                ++numberOfQueuesTheChunksWereDeliveredTo;
+            }
+        }
+    }
+
+    // the remaining chunks of a full queue are delivered in order; in between the sender sleeps until a chunk was
+    // taken from one of the full queues, see 'deliverToAllStoredQueues'
+    iox::detail::adaptive_wait fallbackWait;
+    while (!pendingDeliveries.empty())
+    {
+        QueueSnapshotGuard snapshot(*getMembers());
+        WaitingSenderRegistration registration(*getMembers(), fallbackWait);
+
+        uint64_t index{0U};
+        while (index < pendingDeliveries.size())
+        {
+            auto& pending = pendingDeliveries[index];
+            // the subscriber might have unsubscribed in the meantime; there is no need to deliver to a dead queue
+            auto* queue = findQueueById(snapshot.queues(), pending.queueId);
+            if (queue == nullptr)
+            {
+                pendingDeliveries.erase(pendingDeliveries.begin() + index);
+                continue;
+            }
+
+            registration.registerAt(*queue);
+            ChunkQueuePusher_t pusher(queue);
+            const auto firstChunk = pending.nextChunk;
+            while (pending.nextChunk < chunks.size() && pusher.pushWithoutNotification(chunks[pending.nextChunk]))
+            {
+                ++pending.nextChunk;
+            }
+            if (pending.nextChunk != firstChunk)
+            {
+                pusher.notifyConsumer();
+            }
+
+            if (pending.nextChunk == chunks.size())
+            {
+                ++numberOfQueuesTheChunksWereDeliveredTo;
+                pendingDeliveries.erase(pendingDeliveries.begin() + index);
+            }
+            else
+            {
+                ++index;
+            }
+        }
+
+        if (!pendingDeliveries.empty())
+        {
+            registration.wait();
+        }
+    }
+
+    // the history capacity is constant, therefore the lock is only needed if there is a history
+    if (0U < getMembers()->m_historyCapacity)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (const auto& chunk : chunks)
+        {
+            addToHistory(chunk);
+        }
+    }
+
+    return numberOfQueuesTheChunksWereDeliveredTo;
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
@@ -239,19 +623,20 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
                                                            const uint32_t lastKnownQueueIndex,
                                                            mepoo::SharedChunk chunk [[maybe_unused]]) noexcept
 {
+    iox::detail::adaptive_wait fallbackWait;
     bool retry{false};
     do
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        QueueSnapshotGuard snapshot(*getMembers());
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+        auto queueIndex = findQueueIndex(snapshot, uniqueQueueId, lastKnownQueueIndex);
 
         if (!queueIndex.has_value())
         {
             return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
         }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+        auto& queue = snapshot.queues()[queueIndex.value()];
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
@@ -262,11 +647,18 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
         {
             if (isBlockingQueue)
             {
-                retry = true;
+                WaitingSenderRegistration registration(*getMembers(), fallbackWait);
+                registration.registerAt(*queue.get());
+                retry = !pushToQueue(queue.get(), chunk);
+                if (retry)
+                {
+                    registration.wait();
+                }
             }
             else
             {
                 ChunkQueuePusher_t(queue.get()).lostAChunk();
+                getMembers()->m_numberOfLostChunks.fetch_add(1U, std::memory_order_relaxed);
             }
         }
     } while (retry);
@@ -279,45 +671,114 @@ inline optional<uint32_t>
 ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    QueueSnapshotGuard snapshot(*getMembers());
 
-    auto& queues = getMembers()->m_queues;
+    return findQueueIndex(snapshot, uniqueQueueId, lastKnownQueueIndex);
+}
 
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const QueueSnapshotGuard& snapshot,
+                                                           const UniqueId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) noexcept
+{
+    const auto& queues = snapshot.queues();
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
     {
         return lastKnownQueueIndex;
     }
 
-    uint32_t index{0};
+    // the last known index is stale since queues were added or removed
+    if constexpr (MemberType_t::HAS_QUEUE_INDEX_TABLES)
+    {
+        // probe the unique id table until the queue or a free slot is found
+        constexpr uint32_t SLOT_MASK{MemberType_t::QUEUE_INDEX_TABLE_CAPACITY - 1U};
+        const auto* table = snapshot.queueIndexTable();
+        for (auto slot = queueIndexTableSlot(uniqueQueueId); table[slot] != MemberType_t::INVALID_QUEUE_INDEX;
+             slot = (slot + 1U) & SLOT_MASK)
+        {
+            const auto index = table[slot];
+            if (queues[index]->m_uniqueId == uniqueQueueId)
+            {
+                return index;
+            }
+        }
+    }
+    else
+    {
+        uint32_t index{0};
+        for (auto& queue : queues)
+        {
+            if (queue->m_uniqueId == uniqueQueueId)
+            {
+                return index;
+            }
+            ++index;
+        }
+    }
+    return nullopt;
+}
+
+template <typename ChunkDistributorDataType>
+inline typename ChunkDistributor<ChunkDistributorDataType>::ChunkQueueData_t*
+ChunkDistributor<ChunkDistributorDataType>::findQueueById(const QueueContainer_t& queues,
+                                                          const UniqueId uniqueQueueId) noexcept
+{
     for (auto& queue : queues)
     {
         if (queue->m_uniqueId == uniqueQueueId)
         {
-            return index;
+            return queue.get();
         }
-        ++index;
     }
-    return nullopt;
+    return nullptr;
 }
 
 template <typename ChunkDistributorDataType>
-inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
+inline uint32_t ChunkDistributor<ChunkDistributorDataType>::queueIndexTableSlot(const UniqueId uniqueQueueId) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    // the unique ids are consecutive numbers; the multiplicative hashing spreads them over the table
+    constexpr uint64_t GOLDEN_RATIO_MULTIPLIER{0x9E3779B97F4A7C15U};
+    const auto hash = static_cast<uint64_t>(uniqueQueueId) * GOLDEN_RATIO_MULTIPLIER;
+    return static_cast<uint32_t>(hash >> 32U) & (MemberType_t::QUEUE_INDEX_TABLE_CAPACITY - 1U);
+}
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
+{
+    // the history capacity is constant, therefore the lock is only needed if there is a history
     if (0u < getMembers()->m_historyCapacity)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
-        {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
-        }
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
-        // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        addToHistory(chunk);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::addToHistory(mepoo::SharedChunk chunk) noexcept
+{
+    auto* members = getMembers();
+    if (members->m_historySize >= members->m_historyCapacity)
+    {
+        // the oldest chunk is taken out of its slot before the slot is reused; the chunk is released when it goes out
+        // of scope
+        auto& slot = members->m_history[members->m_historyStart];
+        auto oldestChunk = slot.releaseToSharedChunk();
+        slot = mepoo::ShmSafeUnmanagedChunk(chunk);
+        members->m_historyStart = historySlot(1U);
+    }
+    else
+    {
+        members->m_history[historySlot(members->m_historySize)] = mepoo::ShmSafeUnmanagedChunk(chunk);
+        ++members->m_historySize;
     }
+    members->m_historySynchronizer.clear(std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::historySlot(const uint64_t index) const noexcept
+{
+    return (getMembers()->m_historyStart + index) % getMembers()->m_historyCapacity;
 }
 
 template <typename ChunkDistributorDataType>
@@ -325,7 +786,7 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noe
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    return getMembers()->m_history.size();
+    return getMembers()->m_historySize;
 }
 
 template <typename ChunkDistributorDataType>
@@ -339,30 +800,32 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    for (auto& unmanagedChunk : getMembers()->m_history)
+    releaseHistory();
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseHistory() noexcept
+{
+    auto* members = getMembers();
+    for (auto& unmanagedChunk : members->m_history)
     {
-        unmanagedChunk.releaseToSharedChunk();
+        if (!unmanagedChunk.isLogicalNullptr())
+        {
+            unmanagedChunk.releaseToSharedChunk();
+        }
     }
 
-    getMembers()->m_history.clear();
+    members->m_historyStart = 0U;
+    members->m_historySize = 0U;
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
-    if (getMembers()->tryLock())
-    {
-        clearHistory();
-        getMembers()->unlock();
-    }
-    else
-    {
-        /// @todo iox-#1711 currently we have a deadlock / mutex destroy vulnerability if the ThreadSafePolicy is used
-        /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
-        /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
-        /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
-        IOX_REPORT_FATAL(PoshError::POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION);
-    }
+    // the lock is not taken since the owner might have terminated while holding it; the slots of the history are
+    // released independent of the state of the ring, see 'ChunkDistributorData::m_history'
+    getMembers()->m_historySynchronizer.test_and_set(std::memory_order_acquire);
+    releaseHistory();
 }
 
 } // namespace popo
@@ -20,20 +20,59 @@
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/atomic.hpp"
 #include "iox/logging.hpp"
 #include "iox/mutex.hpp"
+#include "iox/optional.hpp"
 #include "iox/relative_pointer.hpp"
+#include "iox/type_traits.hpp"
 #include "iox/vector.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <limits>
 #include <mutex>
+#include <type_traits>
 
 namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief Checks whether the ChunkDistributorDataProperties request the unique id tables of the queues with
+/// 'static constexpr bool HAS_QUEUE_INDEX_TABLES = true'
+template <typename ChunkDistributorDataProperties, typename = void>
+struct HasQueueIndexTables : std::false_type
+{
+};
+
+template <typename ChunkDistributorDataProperties>
+struct HasQueueIndexTables<ChunkDistributorDataProperties,
+                           void_t<decltype(ChunkDistributorDataProperties::HAS_QUEUE_INDEX_TABLES)>>
+    : bool_constant<ChunkDistributorDataProperties::HAS_QUEUE_INDEX_TABLES>
+{
+};
+
+/// @brief The open addressing tables of the queue snapshots which map the unique id of a queue to its index in the
+/// snapshot; empty if the ChunkDistributorDataProperties do not request them
+template <uint32_t NumberOfSnapshots, uint32_t Capacity, bool HasQueueIndexTables>
+struct QueueIndexTables
+{
+};
+
+template <uint32_t NumberOfSnapshots, uint32_t Capacity>
+struct QueueIndexTables<NumberOfSnapshots, Capacity, true>
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) fixed size for shared memory
+    uint32_t m_tables[NumberOfSnapshots][Capacity];
+};
+} // namespace internal
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 struct ChunkDistributorData : public LockingPolicy
 {
@@ -48,16 +87,70 @@ struct ChunkDistributorData : public LockingPolicy
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
+
+    /// The stored queues which are maintained under the lock; they are published to the sender as snapshot
     QueueContainer_t m_queues;
 
-    /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
-    /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
-    /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
-    /// crash.
-    using HistoryContainer_t =
-        vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
-    HistoryContainer_t m_history;
+    /// The stored queues are published in two snapshots in order to deliver chunks without taking the lock. The
+    /// sender pins the active snapshot by incrementing its reader counter. A modification copies the stored queues
+    /// into the inactive snapshot and makes it the active one, but only if the inactive snapshot is not pinned by
+    /// the sender anymore. Otherwise the modification stays pending and is published by a later modification or by
+    /// 'publishPendingQueues', i.e. the modifying side never waits for the sender. A queue is accessed by the sender
+    /// as long as it is in a pinned snapshot and must not be given back before
+    static constexpr uint32_t NUMBER_OF_QUEUE_SNAPSHOTS{2U};
+    // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) fixed number of snapshots
+    QueueContainer_t m_queueSnapshots[NUMBER_OF_QUEUE_SNAPSHOTS];
+    mutable concurrent::Atomic<uint64_t> m_queueSnapshotReaders[NUMBER_OF_QUEUE_SNAPSHOTS];
+    // NOLINTEND(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    concurrent::Atomic<uint32_t> m_activeQueueSnapshot{0U};
+    /// set while the stored queues differ from the active snapshot; read without the lock to skip senders without
+    /// pending modifications
+    concurrent::Atomic<bool> m_hasPendingQueues{false};
+
+    /// The heartbeat of the application which owns the sender; it is only set by RouDi for monitored applications.
+    /// A snapshot which is still pinned by the sender is reclaimed when the heartbeat is older than
+    /// runtime::PROCESS_KEEP_ALIVE_TIMEOUT, i.e. when the process monitoring considers the application as dead.
+    /// RouDi clears the heartbeat when it destroys the port, before the heartbeat can be reused by another application
+    RelativePointer<runtime::Heartbeat> m_senderHeartbeat;
+
+    /// Set by RouDi when it destroys the port; the owner does not use the sender anymore, a snapshot it might still
+    /// have pinned is reclaimed and the lock is not taken anymore since the owner might have terminated while holding it
+    concurrent::Atomic<bool> m_isSenderDetached{false};
+
+    /// If the properties request it, each snapshot has an open addressing table which maps the unique id of a queue
+    /// to its index in the snapshot. This is only done for the server, which delivers each response to a single
+    /// queue. The table is rebuilt together with the snapshot and has at least twice the capacity of the queue
+    /// container, therefore the lookup of a queue by its unique id stays O(1) independent of the number of stored
+    /// queues. The unique ids are never reused, which makes them the generation counter for a stale last known queue
+    /// index. Without the tables, a queue with a stale last known index is searched by iteration.
+    static constexpr bool HAS_QUEUE_INDEX_TABLES{internal::HasQueueIndexTables<ChunkDistributorDataProperties_t>::value};
+    static constexpr uint32_t QUEUE_INDEX_TABLE_CAPACITY{
+        nextPowerOfTwo(2U * ChunkDistributorDataProperties_t::MAX_QUEUES)};
+    static constexpr uint32_t INVALID_QUEUE_INDEX{std::numeric_limits<uint32_t>::max()};
+    internal::QueueIndexTables<NUMBER_OF_QUEUE_SNAPSHOTS, QUEUE_INDEX_TABLE_CAPACITY, HAS_QUEUE_INDEX_TABLES>
+        m_queueIndexTables;
+
+    /// The history is a ring buffer of ShmSafeUnmanagedChunk since RouDi must release the chunks when the application
+    /// crashed, also while it was updating the history. Each chunk is stored in exactly one slot, which is written
+    /// with a single 64 bit store like in the UsedChunkList, and the oldest chunk is taken out of its slot before the
+    /// slot is reused. The cleanup releases every slot which is not a logical nullptr without relying on the ring
+    /// indices or the lock; a crash in the middle of an update leaks at most one chunk but never releases one twice
+    static_assert(ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY > 0U,
+                  "The history must have at least one slot; use a history capacity of 0 to disable it");
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) fixed size for shared memory
+    mepoo::ShmSafeUnmanagedChunk m_history[ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY];
+    uint64_t m_historyStart{0U};
+    uint64_t m_historySize{0U};
+    concurrent::AtomicFlag m_historySynchronizer = ATOMIC_FLAG_INIT;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// number of chunks which could not be delivered to a queue, read by the port introspection in RouDi
+    concurrent::Atomic<uint64_t> m_numberOfLostChunks{0U};
+
+    /// The sender sleeps on this semaphore while it waits for full queues with the BLOCK_PRODUCER policy; it is
+    /// registered in each of these queues and posted when a chunk was taken from one of them or when the queues are
+    /// modified. Only created with the WAIT_FOR_CONSUMER policy since other senders never wait
+    optional<build::InterProcessSemaphore> m_senderWakeUpSemaphore;
 };
 
 } // namespace popo
@@ -33,6 +33,10 @@ constexpr T min(const T left, const T right) noexcept
 }
 } // namespace internal
 
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint32_t
+    ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::INVALID_QUEUE_INDEX;
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
     const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
@@ -40,6 +44,29 @@ inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, Chunk
     , m_historyCapacity(internal::min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
     , m_consumerTooSlowPolicy(policy)
 {
+    for (auto& readers : m_queueSnapshotReaders)
+    {
+        readers.store(0U, std::memory_order_relaxed);
+    }
+
+    if constexpr (HAS_QUEUE_INDEX_TABLES)
+    {
+        for (auto& table : m_queueIndexTables.m_tables)
+        {
+            std::fill(std::begin(table), std::end(table), INVALID_QUEUE_INDEX);
+        }
+    }
+
+    if (m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER)
+    {
+        build::InterProcessSemaphore::Builder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(m_senderWakeUpSemaphore)
+            .or_else(
+                [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CHUNK_DISTRIBUTOR_DATA_FAILED_TO_CREATE_SEMAPHORE); });
+    }
+
     if (m_historyCapacity != historyCapacity)
     {
         IOX_LOG(Warn, "Chunk history too large, reducing from " << historyCapacity << " to " << m_historyCapacity);
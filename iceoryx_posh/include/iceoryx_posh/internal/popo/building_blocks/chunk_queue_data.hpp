@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/waiting_producer_registry.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/atomic.hpp"
 #include "iox/detail/unique_id.hpp"
@@ -44,12 +45,17 @@ struct ChunkQueueData : public LockingPolicy
     UniqueId m_uniqueId{};
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
-    VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
+    using Queue_t = VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY>;
+    Queue_t m_queue;
     concurrent::Atomic<bool> m_queueHasLostChunks{false};
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// senders which wait for free space in a full queue with the BLOCK_PRODUCER policy register their wake-up
+    /// semaphore here; the receiver posts them when a chunk was taken from the queue
+    WaitingProducerRegistry m_waitingProducers;
 };
 
 } // namespace popo
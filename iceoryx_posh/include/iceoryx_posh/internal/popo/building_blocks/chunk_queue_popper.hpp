@@ -96,7 +96,17 @@ class ChunkQueuePopper
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief converts a chunk which was popped from the queue to a SharedChunk
+    /// @param[in] unmanagedChunk which was popped from the queue
+    /// @return the SharedChunk or a nullopt if the chunk has an incompatible chunk header version and was dropped
+    optional<mepoo::SharedChunk> toCompatibleChunk(mepoo::ShmSafeUnmanagedChunk unmanagedChunk) noexcept;
+
+    /// @brief wakes up producers which wait for free space in a queue with the BLOCK_PRODUCER policy
+    /// @param[in] numberOfFreedSlots is the number of chunks which were popped; nobody is woken up if it is zero
+    void wakeUpWaitingProducers(const uint64_t numberOfFreedSlots) noexcept;
+
   private:
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
@@ -21,6 +21,8 @@
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/logging.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
@@ -53,20 +55,9 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
-        auto chunk = retVal.value().releaseToSharedChunk();
-
-        auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
-        if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
-        {
-            IOX_LOG(Error,
-                    "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
-                                                                 << mepoo::ChunkHeader::CHUNK_HEADER_VERSION
-                                                                 << "'! Dropping chunk!");
-            IOX_REPORT(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
-                       iox::er::RUNTIME_ERROR);
-            return nullopt_t();
-        }
-        return make_optional<mepoo::SharedChunk>(chunk);
+        wakeUpWaitingProducers(1U);
+
+        return toCompatibleChunk(retVal.value());
     }
     else
     {
@@ -74,6 +65,26 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     }
 }
 
+template <typename ChunkQueueDataType>
+inline optional<mepoo::SharedChunk>
+ChunkQueuePopper<ChunkQueueDataType>::toCompatibleChunk(mepoo::ShmSafeUnmanagedChunk unmanagedChunk) noexcept
+{
+    auto chunk = unmanagedChunk.releaseToSharedChunk();
+
+    auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+    if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        IOX_LOG(Error,
+                "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
+                                                             << mepoo::ChunkHeader::CHUNK_HEADER_VERSION
+                                                             << "'! Dropping chunk!");
+        IOX_REPORT(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                   iox::er::RUNTIME_ERROR);
+        return nullopt_t();
+    }
+    return make_optional<mepoo::SharedChunk>(chunk);
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -123,6 +134,25 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
+        wakeUpWaitingProducers(1U);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::wakeUpWaitingProducers(const uint64_t numberOfFreedSlots) noexcept
+{
+    // only senders of queues with the BLOCK_PRODUCER policy wait for free space, other queues skip the fence
+    if (numberOfFreedSlots == 0U || getMembers()->m_queueFullPolicy != QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        return;
+    }
+
+    // pairs with the fence of the sender after its registration; either the sender sees the free space when it
+    // retries the delivery or its registration is seen here
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_waitingProducers.hasRegisteredProducers())
+    {
+        getMembers()->m_waitingProducers.wakeUpAll();
     }
 }
 
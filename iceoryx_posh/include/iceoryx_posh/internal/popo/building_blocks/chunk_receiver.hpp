@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/expected.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
 
 namespace iox
@@ -78,6 +79,18 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get multiple received chunks at once. The chunks are stored in the list of used chunks with a
+    /// single synchronization and waiting producers are woken up once for the whole batch
+    /// The ownerhip of the SharedChunks remains in the ChunkReceiver for being able to cleanup if the user process
+    /// disappears
+    /// @param[in] maxNumberOfChunks is the maximum number of chunks to get
+    /// @param[in] onChunk is called with the ChunkHeader of each received chunk and must not call into the receiver
+    /// @return the number of received chunks, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    expected<uint64_t, ChunkReceiveResult>
+    tryGetBatch(const uint64_t maxNumberOfChunks,
+                const function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -88,6 +101,12 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     void releaseAll() noexcept;
 
   private:
+    /// @brief Records the latency of a chunk in the latency histogram if the chunk carries a send timestamp
+    /// @param[in] chunkHeader of the received chunk
+    /// @param[in][out] receiveTimestamp is taken from the steady clock on the first stamped chunk if it is '0', which
+    /// lets a batch of chunks share a single timestamp
+    void recordLatency(const mepoo::ChunkHeader* const chunkHeader, uint64_t& receiveTimestamp) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
@@ -20,6 +20,8 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace popo
@@ -81,6 +83,8 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
         // if the application holds too many chunks, don't provide more
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
         {
+            uint64_t receiveTimestamp{0U};
+            recordLatency(sharedChunk.getChunkHeader(), receiveTimestamp);
             return ok(const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
         }
         else
@@ -93,6 +97,54 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
     return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline expected<uint64_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetBatch(const uint64_t maxNumberOfChunks,
+                                                  const function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept
+{
+    bool hasSpaceForChunks{false};
+    uint64_t numberOfPoppedChunks{0U};
+    uint64_t numberOfReceivedChunks{0U};
+    uint64_t receiveTimestamp{0U};
+
+    // the chunks are only taken from the queue when there is space in the used chunk list, therefore no chunk is
+    // dropped if the application holds too many chunks
+    getMembers()->m_chunksInUse.insertBatch([&]() -> optional<mepoo::SharedChunk> {
+        hasSpaceForChunks = true;
+        while (numberOfReceivedChunks < maxNumberOfChunks)
+        {
+            auto unmanagedChunk = getMembers()->m_queue.pop();
+            if (!unmanagedChunk.has_value())
+            {
+                break;
+            }
+            ++numberOfPoppedChunks;
+
+            auto chunk = this->toCompatibleChunk(unmanagedChunk.value());
+            if (chunk.has_value())
+            {
+                ++numberOfReceivedChunks;
+                recordLatency(chunk->getChunkHeader(), receiveTimestamp);
+                onChunk(chunk->getChunkHeader());
+                return chunk;
+            }
+        }
+        return nullopt;
+    });
+
+    this->wakeUpWaitingProducers(numberOfPoppedChunks);
+
+    if (numberOfReceivedChunks > 0U)
+    {
+        return ok(numberOfReceivedChunks);
+    }
+    if (!hasSpaceForChunks && !this->empty())
+    {
+        return err(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+    return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -111,6 +163,35 @@ inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
     this->clear();
 }
 
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::recordLatency(const mepoo::ChunkHeader* const chunkHeader,
+                                                                uint64_t& receiveTimestamp) noexcept
+{
+    auto* latencyHistogram = getMembers()->m_latencyHistogram.get();
+    if (latencyHistogram == nullptr)
+    {
+        return;
+    }
+
+    const auto sendTimestamp = chunkHeader->sendTimestamp();
+    if (sendTimestamp == 0U)
+    {
+        return;
+    }
+
+    if (receiveTimestamp == 0U)
+    {
+        receiveTimestamp = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    if (receiveTimestamp >= sendTimestamp)
+    {
+        latencyHistogram->record(receiveTimestamp - sendTimestamp);
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
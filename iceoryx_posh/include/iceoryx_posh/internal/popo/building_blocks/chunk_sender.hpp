@@ -28,6 +28,7 @@
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -114,6 +115,12 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send allocated chunks in order to all connected ChunkQueuePopper with a single delivery pass
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send; the ownership of the pointers is transferred to
+    /// this method
+    /// @return the number of receiver the chunks were send to
+    uint64_t sendBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -125,6 +132,15 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                      const UniqueId uniqueQueueId,
                      const uint32_t lastKnownQueueIndex) noexcept;
 
+    /// @brief Does all that is required to send an allocated chunk except for the delivery, which is done afterwards
+    /// with 'deliverToQueue'. This allows to deliver the chunk without holding a lock which serializes the access to
+    /// the sender, since the delivery might block on a full queue
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
+    /// method
+    /// @return the chunk to deliver or nullopt if the chunk is not in use
+    /// @note This method does not add the chunk to the history
+    optional<mepoo::SharedChunk> prepareSendToQueue(mepoo::ChunkHeader* const chunkHeader) noexcept;
+
     /// @brief Push an allocated chunk to the history without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -133,9 +149,9 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
 
-    /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
-    /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
-    /// chunks in the system
+    /// @brief Release all the chunks that are currently held, including the ones in the mempool cache. Caution: Only
+    /// call this if the user process is no more running E.g. This cleans up chunks that were held by a user process
+    /// that died unexpectetly, for avoiding lost chunks in the system
     void releaseAll() noexcept;
 
   private:
@@ -145,6 +161,14 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Updates the send statistics which are read by the port introspection
+    /// @param[in] lastChunkHeader of the last chunk that was sent
+    /// @param[in] numberOfChunks that were sent
+    /// @param[in] numberOfUserPayloadBytes accumulated user-payload size of the sent chunks
+    void updateStatistics(const mepoo::ChunkHeader* const lastChunkHeader,
+                          const uint64_t numberOfChunks,
+                          const uint64_t numberOfUserPayloadBytes) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
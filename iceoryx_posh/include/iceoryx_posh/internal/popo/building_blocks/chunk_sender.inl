@@ -20,6 +20,10 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/vector.hpp"
+
+#include <chrono>
 
 namespace iox
 {
@@ -106,8 +110,11 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     //   - there is a valid chunk
     //   - there is no other owner
     //   - the new user-payload still fits in it
-    const auto chunkSettingsResult =
-        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    const auto chunkSettingsResult = mepoo::ChunkSettings::create(userPayloadSize,
+                                                                  userPayloadAlignment,
+                                                                  userHeaderSize,
+                                                                  userHeaderAlignment,
+                                                                  getMembers()->m_stampSendTimestamp);
     if (chunkSettingsResult.has_error())
     {
         return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
@@ -140,7 +147,10 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto* memPoolCache = getMembers()->m_memPoolCache.get();
+        auto getChunkResult = (memPoolCache != nullptr)
+                                  ? getMembers()->m_memoryMgr->getChunk(chunkSettings, *memPoolCache)
+                                  : getMembers()->m_memoryMgr->getChunk(chunkSettings);
 
         if (getChunkResult.has_error())
         {
@@ -186,6 +196,7 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(chunk);
+        updateStatistics(chunkHeader, 1U, chunkHeader->userPayloadSize());
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
@@ -195,25 +206,80 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    uint64_t numberOfReceiverTheChunksWereDelivered{0};
+    // the sender cannot hold more chunks than this at once, therefore a valid batch is never split
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    uint64_t numberOfUserPayloadBytes{0U};
+    auto deliverChunks = [&] {
+        if (!chunks.empty())
+        {
+            numberOfReceiverTheChunksWereDelivered = algorithm::maxVal(
+                numberOfReceiverTheChunksWereDelivered,
+                this->deliverBatchToAllStoredQueues(span<const mepoo::SharedChunk>(chunks.data(), chunks.size())));
+            updateStatistics(chunks.back().getChunkHeader(), chunks.size(), numberOfUserPayloadBytes);
+            numberOfUserPayloadBytes = 0U;
+
+            getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+            getMembers()->m_lastChunkUnmanaged = chunks.back();
+            chunks.clear();
+        }
+    };
+
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (auto* const chunkHeader : chunkHeaders)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeader, chunk))
+        {
+            chunks.emplace_back(chunk);
+            numberOfUserPayloadBytes += chunkHeader->userPayloadSize();
+            if (chunks.size() == chunks.capacity())
+            {
+                deliverChunks();
+            }
+        }
+    }
+    deliverChunks();
+    // END of critical section
+
+    return numberOfReceiverTheChunksWereDelivered;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) noexcept
+{
+    auto chunk = prepareSendToQueue(chunkHeader);
+    if (!chunk.has_value())
+    {
+        return false;
+    }
+
+    return !this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk.value()).has_error();
+}
+
+template <typename ChunkSenderDataType>
+inline optional<mepoo::SharedChunk>
+ChunkSender<ChunkSenderDataType>::prepareSendToQueue(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
-        auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk);
+        updateStatistics(chunkHeader, 1U, chunkHeader->userPayloadSize());
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
 
-        return !deliveryResult.has_error();
+        return chunk;
     }
     // END of critical section
 
-    return false;
+    return nullopt;
 }
 
 template <typename ChunkSenderDataType>
@@ -224,6 +290,7 @@ inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader*
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         this->addToHistoryWithoutDelivery(chunk);
+        updateStatistics(chunkHeader, 1U, chunkHeader->userPayloadSize());
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
@@ -250,6 +317,11 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    auto* memPoolCache = getMembers()->m_memPoolCache.get();
+    if (memPoolCache != nullptr)
+    {
+        memPoolCache->release();
+    }
 }
 
 template <typename ChunkSenderDataType>
@@ -259,6 +331,12 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        if (getMembers()->m_stampSendTimestamp)
+        {
+            const auto now = std::chrono::steady_clock::now().time_since_epoch();
+            chunk.getChunkHeader()->setSendTimestamp(
+                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()));
+        }
         return true;
     }
     else
@@ -268,6 +346,38 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::updateStatistics(const mepoo::ChunkHeader* const lastChunkHeader,
+                                                               const uint64_t numberOfChunks,
+                                                               const uint64_t numberOfUserPayloadBytes) noexcept
+{
+    // the sender is the only writer of the statistics, therefore a load and a store are sufficient and the send path
+    // does not pay for read-modify-write operations
+    auto& statistics = getMembers()->m_statistics;
+
+    // the send timestamp of a stamped chunk is reused to not read the clock twice per chunk; unstamped chunks still
+    // have a send time for the statistics
+    auto sendTimestamp = lastChunkHeader->sendTimestamp();
+    if (sendTimestamp == 0U)
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        sendTimestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+    const auto lastSendTimestamp = statistics.m_lastSendTimestampInNanoseconds.load(std::memory_order_relaxed);
+    statistics.m_lastSendTimestampInNanoseconds.store(sendTimestamp, std::memory_order_relaxed);
+    if (lastSendTimestamp != 0U && sendTimestamp > lastSendTimestamp)
+    {
+        statistics.m_lastSendIntervalInNanoseconds.store(sendTimestamp - lastSendTimestamp, std::memory_order_relaxed);
+    }
+    statistics.m_lastUserPayloadSize.store(lastChunkHeader->userPayloadSize(), std::memory_order_relaxed);
+    statistics.m_lastChunkSize.store(lastChunkHeader->chunkSize(), std::memory_order_relaxed);
+    statistics.m_numberOfSentUserPayloadBytes.store(
+        statistics.m_numberOfSentUserPayloadBytes.load(std::memory_order_relaxed) + numberOfUserPayloadBytes,
+        std::memory_order_relaxed);
+    statistics.m_numberOfSentChunks.store(
+        statistics.m_numberOfSentChunks.load(std::memory_order_relaxed) + numberOfChunks, std::memory_order_relaxed);
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -18,11 +18,13 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iox/atomic.hpp"
 #include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -30,21 +32,43 @@ namespace iox
 {
 namespace popo
 {
+/// @brief Counters of the sent chunks which are read by the port introspection in RouDi. The sender is the only writer
+/// and updates them with relaxed loads and stores to keep the overhead on the send path low. The last send timestamp
+/// and interval are recorded independently of whether the sender stamps the send timestamp into the chunks.
+struct ChunkSenderStatistics
+{
+    concurrent::Atomic<uint64_t> m_numberOfSentChunks{0U};
+    concurrent::Atomic<uint64_t> m_numberOfSentUserPayloadBytes{0U};
+    concurrent::Atomic<uint64_t> m_lastUserPayloadSize{0U};
+    concurrent::Atomic<uint64_t> m_lastChunkSize{0U};
+    concurrent::Atomic<uint64_t> m_lastSendTimestampInNanoseconds{0U};
+    concurrent::Atomic<uint64_t> m_lastSendIntervalInNanoseconds{0U};
+};
+
 template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
 struct ChunkSenderData : public ChunkDistributorDataType
 {
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const bool stampSendTimestamp = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
 
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    /// the chunk cache which is acquired by RouDi from the port pool; only set if the publisher requested it with
+    /// 'PublisherOptions::chunkCacheSize'
+    RelativePointer<mepoo::MemPoolCache> m_memPoolCache;
+    ChunkSenderStatistics m_statistics;
+    /// if set, the chunks reserve space for the send timestamp behind the user-payload and the send time is stamped
+    /// into it to let the receivers record the latency
+    const bool m_stampSendTimestamp{false};
 };
 
 } // namespace popo
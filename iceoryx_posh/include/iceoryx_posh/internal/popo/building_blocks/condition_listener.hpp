@@ -21,6 +21,7 @@
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
+#include "iox/duration.hpp"
 
 namespace iox
 {
@@ -49,6 +50,16 @@ class ConditionListener
     ///         returns an empty vector.
     void destroy() volatile noexcept;
 
+    /// @brief Sets the time for which wait() and timedWait() poll for notifications before they block on the
+    /// semaphore. While polling, the notifiers do not post the semaphore which saves the syscalls and the
+    /// scheduler wakeup at the cost of a busy CPU core.
+    /// @param[in] spinDuration the time to poll; zero disables polling
+    void setSpinDuration(const units::Duration& spinDuration) noexcept;
+
+    /// @brief Returns the time for which wait() and timedWait() poll for notifications before they block
+    /// @return the spin duration
+    units::Duration spinDuration() const noexcept;
+
     /// @brief returns a sorted vector of indices of active notifications; blocking if ConditionVariableData was
     /// not notified unless destroy() was called before. The indices of active notifications are
     /// never empty unless destroy() was called, then it's always empty.
@@ -70,14 +81,20 @@ class ConditionListener
     ConditionVariableData* getMembers() volatile noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
+    /// @brief resets the active notifications and appends their indices in ascending order to the vector
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
     void resetSemaphore() noexcept;
+    bool hasActiveNotifications() const noexcept;
+    /// @brief polls for active notifications until the spin duration elapsed
+    /// @return true if there are active notifications or destroy() was called, otherwise false
+    bool spinUntilNotified(const units::Duration& spinDuration) noexcept;
 
     NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     concurrent::Atomic<bool> m_toBeDestroyed{false};
+    concurrent::Atomic<uint64_t> m_spinDurationInNanoseconds{0U};
 };
 
 } // namespace popo
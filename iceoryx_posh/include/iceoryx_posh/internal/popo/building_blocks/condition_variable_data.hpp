@@ -19,8 +19,10 @@
 
 #include "iceoryx_posh/iceoryx_posh_deployment.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier_data.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/atomic.hpp"
+#include "iox/relative_pointer.hpp"
 #include "iox/spin_semaphore.hpp"
 #include "iox/unnamed_semaphore.hpp"
 
@@ -30,6 +32,12 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    /// @brief the active notifications are stored as one bit per notifier, which lets the listener skip all words
+    /// without a notification instead of checking every notifier
+    static constexpr uint64_t BITS_PER_NOTIFICATION_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + BITS_PER_NOTIFICATION_WORD - 1U)
+                                                           / BITS_PER_NOTIFICATION_WORD};
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -42,8 +50,18 @@ struct ConditionVariableData
     optional<build::InterProcessSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     concurrent::Atomic<bool> m_toBeDestroyed{false};
-    concurrent::Atomic<bool> m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    concurrent::Atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     concurrent::Atomic<bool> m_wasNotified{false};
+    /// @brief set while the listener has a spin duration; the notifiers only synchronize with a spinning listener if it
+    /// is set and post the semaphore unconditionally otherwise
+    concurrent::Atomic<bool> m_isSpinEnabled{false};
+    /// @brief set while the listener polls the active notifications before it falls back to the semaphore; the
+    /// notifiers skip the semaphore post in the meantime
+    concurrent::Atomic<bool> m_listenerIsSpinning{false};
+
+    /// @brief set by the PortPool; used to notify RouDi that the condition variable can be destroyed
+    RelativePointer<DiscoveryNotifierData> m_discoveryNotifierDataPtr;
+    uint64_t m_discoveryNotificationIndex{0U};
 };
 
 } // namespace popo
@@ -0,0 +1,68 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_LISTENER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_LISTENER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier_data.hpp"
+#include "iox/duration.hpp"
+#include "iox/function_ref.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief DiscoveryListener is used by RouDi to wait for the notifications of the DiscoveryNotifier and to collect the
+///        indices of the notified ports and condition variables
+class DiscoveryListener
+{
+  public:
+    explicit DiscoveryListener(DiscoveryNotifierData& discoveryNotifierDataRef) noexcept;
+
+    DiscoveryListener(const DiscoveryListener& rhs) = delete;
+    DiscoveryListener(DiscoveryListener&& rhs) noexcept = delete;
+    DiscoveryListener& operator=(const DiscoveryListener& rhs) = delete;
+    DiscoveryListener& operator=(DiscoveryListener&& rhs) noexcept = delete;
+    ~DiscoveryListener() noexcept = default;
+
+    /// @brief Blocks until a notifier was notified, wakeUp was called or the time has passed
+    /// @param[in] timeToWait the maximum time to wait
+    /// @return true when the listener was woken up before the time has passed, false otherwise
+    /// @note the notifications are not reset by this call, they have to be collected with forEachNotification
+    bool timedWait(const units::Duration& timeToWait) noexcept;
+
+    /// @brief Unblocks a timedWait without a notification
+    void wakeUp() noexcept;
+
+    /// @brief Resets the notifications in the range [begin, begin + count[ and calls the callback for each of them
+    /// @param[in] begin the first index of the range
+    /// @param[in] count the number of indices in the range
+    /// @param[in] callback which is called with the offset of the notified index relative to begin
+    void forEachNotification(const uint64_t begin,
+                             const uint64_t count,
+                             const function_ref<void(const uint64_t)> callback) noexcept;
+
+  private:
+    void resetSemaphore() noexcept;
+
+  private:
+    DiscoveryNotifierData* m_discoveryNotifierDataPtr{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_LISTENER_HPP
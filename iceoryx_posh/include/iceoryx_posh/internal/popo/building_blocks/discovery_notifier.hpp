@@ -0,0 +1,50 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier_data.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief DiscoveryNotifier notifies RouDi that the port or condition variable with the given index has a request
+///        for the discovery
+class DiscoveryNotifier
+{
+  public:
+    DiscoveryNotifier(DiscoveryNotifierData& discoveryNotifierDataRef, const uint64_t index) noexcept;
+
+    DiscoveryNotifier(const DiscoveryNotifier& rhs) = delete;
+    DiscoveryNotifier(DiscoveryNotifier&& rhs) noexcept = delete;
+    DiscoveryNotifier& operator=(const DiscoveryNotifier& rhs) = delete;
+    DiscoveryNotifier& operator=(DiscoveryNotifier&& rhs) noexcept = delete;
+    ~DiscoveryNotifier() noexcept = default;
+
+    /// @brief Marks the index as notified and wakes up RouDi if it waits for notifications
+    void notify() noexcept;
+
+  private:
+    DiscoveryNotifierData* m_discoveryNotifierDataPtr{nullptr};
+    uint64_t m_notificationIndex{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
@@ -0,0 +1,58 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_DATA_HPP
+
+#include "iceoryx_posh/iceoryx_posh_deployment.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/atomic.hpp"
+#include "iox/optional.hpp"
+#include "iox/spin_semaphore.hpp"
+#include "iox/unnamed_semaphore.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Shared memory data with which the ports and condition variables notify RouDi about a request for the
+///        discovery, e.g. an offer or a subscription. Every notifier has its own bit in the notification bitmap, which
+///        lets RouDi process only the notified ports instead of polling all of them.
+struct DiscoveryNotifierData
+{
+    /// @brief number of notifiers, large enough for all ports and condition variables of the port pool
+    static constexpr uint64_t CAPACITY = static_cast<uint64_t>(MAX_PUBLISHERS) + MAX_SUBSCRIBERS + MAX_SERVERS
+                                         + MAX_CLIENTS + MAX_INTERFACE_NUMBER + MAX_NUMBER_OF_CONDITION_VARIABLES;
+    static constexpr uint64_t BITS_PER_NOTIFICATION_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(CAPACITY + BITS_PER_NOTIFICATION_WORD - 1U)
+                                                           / BITS_PER_NOTIFICATION_WORD};
+
+    DiscoveryNotifierData() noexcept;
+
+    DiscoveryNotifierData(const DiscoveryNotifierData& rhs) = delete;
+    DiscoveryNotifierData(DiscoveryNotifierData&& rhs) = delete;
+    DiscoveryNotifierData& operator=(const DiscoveryNotifierData& rhs) = delete;
+    DiscoveryNotifierData& operator=(DiscoveryNotifierData&& rhs) = delete;
+    ~DiscoveryNotifierData() noexcept = default;
+
+    optional<build::InterProcessSemaphore> m_semaphore;
+    concurrent::Atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_DATA_HPP
@@ -0,0 +1,88 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include "iox/atomic.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Lock-free log-linear histogram for latencies in nanoseconds which can be placed in shared memory. The values
+/// are sorted into power of two ranges which are split into SUB_BUCKETS_PER_RANGE linear buckets. This bounds the
+/// relative error of a percentile to 1/SUB_BUCKETS_PER_RANGE while the memory footprint stays constant. Values beyond
+/// the largest range are counted in the last bucket.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint64_t SUB_BUCKET_BITS{3U};
+    static constexpr uint64_t SUB_BUCKETS_PER_RANGE{1U << SUB_BUCKET_BITS};
+    /// @brief the largest range ends at 2^(NUMBER_OF_RANGES + SUB_BUCKET_BITS - 1) nanoseconds, which is about 17s
+    static constexpr uint64_t NUMBER_OF_RANGES{32U};
+    static constexpr uint64_t NUMBER_OF_BUCKETS{NUMBER_OF_RANGES * SUB_BUCKETS_PER_RANGE};
+
+    /// @brief Counts of the buckets at a point in time, which are used to calculate the percentiles
+    struct Snapshot
+    {
+        /// @brief Calculates a percentile of the recorded values
+        /// @param[in] percentile in the range [0.0, 1.0], e.g. 0.99 for the p99
+        /// @return the upper bound of the bucket which contains the percentile or '0' if there are no values
+        uint64_t percentile(const double percentile) const noexcept;
+
+        uint64_t m_numberOfValues{0U};
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) fixed size for shared memory
+        uint64_t m_buckets[NUMBER_OF_BUCKETS]{};
+    };
+
+    LatencyHistogram() noexcept;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+    ~LatencyHistogram() noexcept = default;
+
+    /// @brief Records a value; safe to be called concurrently to 'drain' from another process
+    /// @param[in] latencyInNanoseconds is the value to record
+    void record(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief Moves the counts of all buckets into a snapshot and resets them. Every recorded value ends up in exactly
+    /// one snapshot, therefore periodically draining the histogram yields the distribution of each period.
+    /// @return the snapshot with the values recorded since the last call
+    Snapshot drain() noexcept;
+
+    /// @brief Calculates the bucket a value is sorted into
+    /// @param[in] latencyInNanoseconds is the value to sort
+    /// @return the index of the bucket
+    static uint64_t bucketIndex(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief The largest value which is sorted into a bucket
+    /// @param[in] index of the bucket
+    /// @return the upper bound of the bucket
+    static uint64_t bucketUpperBound(const uint64_t index) noexcept;
+
+  private:
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) fixed size for shared memory
+    concurrent::Atomic<uint64_t> m_buckets[NUMBER_OF_BUCKETS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
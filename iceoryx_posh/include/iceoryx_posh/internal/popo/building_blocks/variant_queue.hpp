@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_VARIANT_QUEUE_HPP
 
 #include "iox/assertions.hpp"
+#include "iox/detail/mpmc_bounded_lockfree_queue.hpp"
 #include "iox/detail/mpmc_resizeable_lockfree_queue.hpp"
 #include "iox/detail/spsc_fifo.hpp"
 #include "iox/detail/spsc_sofi.hpp"
@@ -42,12 +43,14 @@ enum class VariantQueueTypes : uint64_t
     FiFo_SingleProducerSingleConsumer = 0,
     SoFi_SingleProducerSingleConsumer = 1,
     FiFo_MultiProducerSingleConsumer = 2,
-    SoFi_MultiProducerSingleConsumer = 3
+    SoFi_MultiProducerSingleConsumer = 3,
+    FiFo_MultiProducerSingleConsumer_FixedCapacity = 4,
+    SoFi_MultiProducerSingleConsumer_FixedCapacity = 5
 };
 
-// remark: we need to consider to support the non-resizable queue as well
-//         since it should have performance benefits if resize is not actually needed
-//         for now we just use the most general variant, which allows resizing
+// remark: the multi producer queues are available in a resizeable and a fixed capacity flavor; the capacity of the
+//         fixed capacity queues can only be set while they are empty and is not changed afterwards, they avoid the
+//         overhead of the resizeable queue and are therefore preferred, see 'VariantQueue::fixedCapacityQueueType'
 
 /// @brief wrapper of multiple fifo's
 /// @param[in] ValueType type which should be stored
@@ -74,12 +77,20 @@ class VariantQueue
     using fifo_t = variant<concurrent::SpscFifo<ValueType, Capacity>,
                            concurrent::SpscSofi<ValueType, Capacity>,
                            concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>,
-                           concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>>;
+                           concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>,
+                           concurrent::MpmcBoundedLockFreeQueue<ValueType, Capacity>,
+                           concurrent::MpmcBoundedLockFreeQueue<ValueType, Capacity>>;
 
     /// @brief Constructor of a VariantQueue
     /// @param[in] type type of the underlying queue
     explicit VariantQueue(const VariantQueueTypes type) noexcept;
 
+    /// @brief Selects the queue type for a queue whose capacity is set with 'setCapacity' right after the construction
+    /// and not changed afterwards. A resizeable multi producer queue type is replaced by its fixed capacity counterpart
+    /// @param[in] type of the queue which is requested
+    /// @return the queue type which shall be used to construct the VariantQueue
+    static constexpr VariantQueueTypes fixedCapacityQueueType(const VariantQueueTypes type) noexcept;
+
     /// @brief pushs an element into the fifo
     /// @param[in] value value which should be added in the fifo
     /// @return if the underlying queue has an overflow the optional will contain
@@ -107,6 +118,7 @@ class VariantQueue
     ///         this call
     /// @note depending on the internal queue used, concurrent pushes and pops are possible
     ///       (for FiFo_MultiProducerSingleConsumer and SoFi_MultiProducerSingleConsumer)
+    /// @note the fixed capacity queues only accept a new capacity while they are empty
     /// @concurrent not thread safe
     bool setCapacity(const uint64_t newCapacity) noexcept;
 
@@ -48,9 +48,36 @@ inline VariantQueue<ValueType, Capacity>::VariantQueue(const VariantQueueTypes t
         m_fifo.template emplace<concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>>();
         break;
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+        [[fallthrough]];
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        m_fifo.template emplace<concurrent::MpmcBoundedLockFreeQueue<ValueType, Capacity>>();
+        break;
+    }
     }
 }
 
+template <typename ValueType, uint64_t Capacity>
+constexpr VariantQueueTypes
+VariantQueue<ValueType, Capacity>::fixedCapacityQueueType(const VariantQueueTypes type) noexcept
+{
+    switch (type)
+    {
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer:
+        return VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity;
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer:
+        return VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity;
+    case VariantQueueTypes::FiFo_SingleProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_SingleProducerSingleConsumer:
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+        break;
+    }
+
+    return type;
+}
+
 template <typename ValueType, uint64_t Capacity>
 optional<ValueType> VariantQueue<ValueType, Capacity>::push(const ValueType& value) noexcept
 {
@@ -91,6 +118,22 @@ optional<ValueType> VariantQueue<ValueType, Capacity>::push(const ValueType& val
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->push(value);
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        auto hadSpace = queue->tryPush(value);
+
+        return (hadSpace) ? nullopt : make_optional<ValueType>(value);
+    }
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->push(value);
+    }
     }
 
     return nullopt;
@@ -126,6 +169,14 @@ inline optional<ValueType> VariantQueue<ValueType, Capacity>::pop() noexcept
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->pop();
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->pop();
+    }
     }
 
     return nullopt;
@@ -158,6 +209,14 @@ inline bool VariantQueue<ValueType, Capacity>::empty() const noexcept
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->empty();
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->empty();
+    }
     }
 
     return true;
@@ -190,6 +249,14 @@ inline uint64_t VariantQueue<ValueType, Capacity>::size() noexcept
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->size();
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->size();
+    }
     }
 
     return 0U;
@@ -223,6 +290,15 @@ inline bool VariantQueue<ValueType, Capacity>::setCapacity(const uint64_t newCap
         // we may discard elements in the queue if the size is reduced and the fifo contains too many elements
         return queue->setCapacity(newCapacity);
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        // the capacity can only be set while the queue is empty
+        return queue->setCapacity(newCapacity);
+    }
     }
     return false;
 }
@@ -254,6 +330,14 @@ inline uint64_t VariantQueue<ValueType, Capacity>::capacity() const noexcept
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->capacity();
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->capacity();
+    }
     }
 
     return 0U;
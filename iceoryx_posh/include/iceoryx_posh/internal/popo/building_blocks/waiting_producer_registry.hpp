@@ -0,0 +1,105 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_WAITING_PRODUCER_REGISTRY_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_WAITING_PRODUCER_REGISTRY_HPP
+
+#include "iceoryx_posh/iceoryx_posh_deployment.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/atomic.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
+#include "iox/spin_semaphore.hpp"
+#include "iox/unnamed_semaphore.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Shared memory data of a chunk queue with the BLOCK_PRODUCER policy in which producers register their
+///        wake-up semaphore while they wait for free space in the queue. A producer which waits for several full
+///        queues registers the same semaphore in each of them and sleeps only once until any of the queues has free
+///        space again.
+/// @note The producer must register itself before it retries the push and issue a sequentially consistent fence in
+///       between, the consumer must issue one between taking a chunk and calling 'wakeUpAll'. Either the producer
+///       sees the free space or the consumer sees the registration, therefore no wake-up is lost.
+class WaitingProducerRegistry
+{
+  public:
+    static constexpr uint32_t CAPACITY{MAX_WAITING_PRODUCERS_PER_CHUNK_QUEUE};
+
+    WaitingProducerRegistry() noexcept = default;
+
+    WaitingProducerRegistry(const WaitingProducerRegistry& rhs) = delete;
+    WaitingProducerRegistry(WaitingProducerRegistry&& rhs) noexcept = delete;
+    WaitingProducerRegistry& operator=(const WaitingProducerRegistry& rhs) = delete;
+    WaitingProducerRegistry& operator=(WaitingProducerRegistry&& rhs) noexcept = delete;
+    ~WaitingProducerRegistry() noexcept = default;
+
+    /// @brief registers the wake-up semaphore of a producer
+    /// @param[in] wakeUpSemaphore which is posted by 'wakeUpAll'; it must stay valid until the producer is deregistered
+    /// @return the slot of the registration or nullopt if all slots are occupied
+    optional<uint32_t> registerProducer(build::InterProcessSemaphore& wakeUpSemaphore) noexcept;
+
+    /// @brief removes the registration of a producer; when the function returns, the wake-up semaphore of the producer
+    ///        is not accessed anymore
+    /// @param[in] slot which was returned by 'registerProducer'
+    void deregisterProducer(const uint32_t slot) noexcept;
+
+    /// @brief removes all registrations of a producer which does not deregister itself anymore, e.g. since its
+    ///        application was terminated; when the function returns, the wake-up semaphore is not accessed anymore
+    /// @param[in] wakeUpSemaphore which was registered by the producer
+    /// @note must only be called by RouDi before the memory of the wake-up semaphore is released
+    void removeProducer(const build::InterProcessSemaphore& wakeUpSemaphore) noexcept;
+
+    /// @brief posts the wake-up semaphore of every registered producer
+    void wakeUpAll() noexcept;
+
+    /// @brief checks whether producers are registered
+    /// @return true if at least one producer is registered, otherwise false
+    bool hasRegisteredProducers() const noexcept;
+
+  private:
+    enum class SlotState : uint32_t
+    {
+        FREE,
+        CLAIMED,
+        REGISTERED
+    };
+
+    static_assert(CAPACITY <= 32U, "The registered slots are tracked in a 32 bit mask");
+
+    /// @brief frees a slot which is no longer registered; waits until no consumer posts the semaphore anymore
+    void releaseSlot(const uint32_t slot) noexcept;
+
+    struct Slot
+    {
+        concurrent::Atomic<SlotState> m_state{SlotState::FREE};
+        /// number of consumers which currently post the semaphore; the slot is freed only when there is none
+        concurrent::Atomic<uint32_t> m_numberOfActiveWakeUps{0U};
+        RelativePointer<build::InterProcessSemaphore> m_wakeUpSemaphore;
+    };
+
+    Slot m_slots[CAPACITY];
+    /// one bit per registered slot; setting and clearing the bits is idempotent, therefore a slot of a terminated
+    /// producer can be removed without knowing how far its registration got
+    concurrent::Atomic<uint32_t> m_registeredSlots{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_WAITING_PRODUCER_REGISTRY_HPP
@@ -79,6 +79,9 @@ class BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief Notifies RouDi that the port has a request for the discovery, e.g. an offer or a subscription
+    void notifyDiscovery() noexcept;
+
   private:
     MemberType_t* m_basePortDataPtr;
 };
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iox/atomic.hpp"
 #include "iox/relative_pointer.hpp"
@@ -50,6 +51,10 @@ struct BasePortData
     RuntimeName_t m_runtimeName;
     UniquePortId m_uniqueId;
     concurrent::Atomic<bool> m_toBeDestroyed{false};
+
+    /// @brief set by the PortPool; used to notify RouDi about requests of the user side like offer or destroy
+    RelativePointer<DiscoveryNotifierData> m_discoveryNotifierDataPtr;
+    uint64_t m_discoveryNotificationIndex{0U};
 };
 
 } // namespace popo
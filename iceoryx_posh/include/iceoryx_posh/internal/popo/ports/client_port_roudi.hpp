@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
+#include "iox/not_null.hpp"
 #include "iox/optional.hpp"
 
 namespace iox
@@ -70,6 +71,22 @@ class ClientPortRouDi : public BasePort
     /// @attention Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief detaches the client from the application which owns it; the queues of the client are then modified without
+    /// waiting for the application
+    /// @attention Contract is that user process does not use the client anymore
+    void detachFromOwner() noexcept;
+
+    /// @brief publishes the changes of the server queues which are pending since the application had not yet released
+    /// the previous queues of the client
+    /// @return true if no change is pending anymore, false otherwise
+    bool publishPendingQueues() noexcept;
+
+    /// @brief checks whether the client might still deliver to the queue of a server, e.g. since the application has
+    /// not yet released the previous queues of the client after the queue was removed
+    /// @param[in] queue of the server
+    /// @return true if the queue must not be given back yet, false otherwise
+    bool isQueueAccessible(not_null<const ServerChunkQueueData_t* const> queue) const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -39,6 +39,8 @@ struct ServerChunkDistributorConfig
 {
     static constexpr uint32_t MAX_QUEUES = MAX_CLIENTS_PER_SERVER;
     static constexpr uint64_t MAX_HISTORY_CAPACITY = 1; // could be 0, but problem for the container then
+    /// the responses are delivered to the queue of a single client which is looked up by its unique id
+    static constexpr bool HAS_QUEUE_INDEX_TABLES = true;
 };
 
 struct ClientChunkQueueConfig
@@ -43,6 +43,23 @@ class InterfacePort : public BasePort
     /// @param[in] caProMessage
     void dispatchCaProMessage(const capro::CaproMessage& caProMessage) noexcept;
 
+    /// @brief checks whether there are CaPro messages to process
+    /// @return true if there is at least one message, false otherwise
+    bool hasCaProMessage() const noexcept;
+
+    /// @brief attach a condition variable which is notified whenever a CaPro message is dispatched
+    /// @param[in] conditionVariableDataRef reference to the condition variable data
+    /// @param[in] notificationIndex index which is used to notify the condition variable
+    void setConditionVariable(ConditionVariableData& conditionVariableDataRef,
+                              const uint64_t notificationIndex) noexcept;
+
+    /// @brief detach the condition variable
+    void unsetConditionVariable() noexcept;
+
+    /// @brief checks whether a condition variable is attached
+    /// @return true if one is attached, false otherwise
+    bool isConditionVariableSet() const noexcept;
+
   private:
     const InterfacePortData* getMembers() const noexcept;
     InterfacePortData* getMembers() noexcept;
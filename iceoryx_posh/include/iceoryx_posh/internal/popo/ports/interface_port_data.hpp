@@ -19,8 +19,12 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 #include "iox/detail/spsc_fifo.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
 
 namespace iox
 {
@@ -34,6 +38,11 @@ struct InterfacePortData : public BasePortData
 
     concurrent::SpscFifo<capro::CaproMessage, MAX_INTERFACE_CAPRO_FIFO_SIZE> m_caproMessageFiFo;
     bool m_doInitialOfferForward{true};
+
+    /// @brief guards the condition variable against concurrent (un)setting by the user and notifying by RouDi
+    ThreadSafePolicy m_conditionVariableLock;
+    RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
+    optional<uint64_t> m_conditionVariableNotificationIndex;
 };
 } // namespace popo
 } // namespace iox
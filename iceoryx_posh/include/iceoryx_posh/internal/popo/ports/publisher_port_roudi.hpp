@@ -64,6 +64,22 @@ class PublisherPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief detaches the publisher from the application which owns it; the queues of the publisher are then modified without
+    /// waiting for the application
+    /// @attention Contract is that user process does not use the publisher anymore
+    void detachFromOwner() noexcept;
+
+    /// @brief publishes the changes of the subscriber queues which are pending since the application had not yet released
+    /// the previous queues of the publisher
+    /// @return true if no change is pending anymore, false otherwise
+    bool publishPendingQueues() noexcept;
+
+    /// @brief checks whether the publisher might still deliver to the queue of a subscriber, e.g. since the application has
+    /// not yet released the previous queues of the publisher after the queue was removed
+    /// @param[in] queue of the subscriber
+    /// @return true if the queue must not be given back yet, false otherwise
+    bool isQueueAccessible(not_null<const PublisherPortData::ChunkQueueData_t* const> queue) const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -44,6 +44,8 @@ struct ServerPortData : public BasePortData
     ServerChunkReceiverData_t m_chunkReceiverData;
     concurrent::Atomic<bool> m_offeringRequested{false};
     concurrent::Atomic<bool> m_offered{false};
+    /// the user side of the port serializes the access to the request and response chunks for worker threads
+    const bool m_concurrentRequestProcessing{false};
 
     static constexpr uint64_t HISTORY_REQUEST_OF_ZERO{0U};
 };
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
+#include "iox/not_null.hpp"
 #include "iox/optional.hpp"
 
 namespace iox
@@ -67,6 +68,22 @@ class ServerPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief detaches the server from the application which owns it; the queues of the server are then modified without
+    /// waiting for the application
+    /// @attention Contract is that user process does not use the server anymore
+    void detachFromOwner() noexcept;
+
+    /// @brief publishes the changes of the client queues which are pending since the application had not yet released
+    /// the previous queues of the server
+    /// @return true if no change is pending anymore, false otherwise
+    bool publishPendingQueues() noexcept;
+
+    /// @brief checks whether the server might still deliver to the queue of a client, e.g. since the application has
+    /// not yet released the previous queues of the server after the queue was removed
+    /// @param[in] queue of the client
+    /// @return true if the queue must not be given back yet, false otherwise
+    bool isQueueAccessible(not_null<const ClientChunkQueueData_t* const> queue) const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
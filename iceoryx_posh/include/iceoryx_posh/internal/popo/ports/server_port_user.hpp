@@ -28,6 +28,8 @@
 #include "iox/into.hpp"
 #include "iox/optional.hpp"
 
+#include <mutex>
+
 namespace iox
 {
 namespace popo
@@ -92,7 +94,10 @@ inline log::LogStream& operator<<(log::LogStream& stream, ServerSendError value)
 /// is divided in the three parts ServerPortData, ServerPortRouDi and ServerPortUser. The ServerPortUser
 /// uses the functionality of a ChunkSender and ChunReceiver for receiving requests and sending responses.
 /// Additionally it provides the offer / stopOffer API which controls whether the server is discoverable
-/// for client ports
+/// for client ports. With ServerOptions::concurrentRequestProcessing, taking and releasing requests and allocating,
+/// releasing and sending responses is serialized by a process local mutex, so that a pool of worker threads can
+/// process the requests of the server concurrently; the delivery of a response to the client queue is done without
+/// the mutex
 class ServerPortUser : public BasePort
 {
   public:
@@ -102,8 +107,10 @@ class ServerPortUser : public BasePort
 
     ServerPortUser(const ServerPortUser& other) = delete;
     ServerPortUser& operator=(const ServerPortUser&) = delete;
-    ServerPortUser(ServerPortUser&& rhs) noexcept = default;
-    ServerPortUser& operator=(ServerPortUser&& rhs) noexcept = default;
+    /// @note the mutex for the concurrent request processing is not moved, the port must not be in use while it
+    /// is moved
+    ServerPortUser(ServerPortUser&& rhs) noexcept;
+    ServerPortUser& operator=(ServerPortUser&& rhs) noexcept;
     ~ServerPortUser() = default;
 
     /// @brief Tries to get the next request from the queue. If there is a new one, the ChunkHeader of the oldest
@@ -176,8 +183,13 @@ class ServerPortUser : public BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief Locks the mutex for the concurrent request processing if it is enabled for this port
+    /// @return the lock which is owned if the concurrent request processing is enabled
+    std::unique_lock<std::mutex> lockForConcurrentRequestProcessing() noexcept;
+
     ChunkSender<ServerChunkSenderData_t> m_chunkSender;
     ChunkReceiver<ServerChunkReceiverData_t> m_chunkReceiver;
+    std::mutex m_concurrentRequestProcessingMutex;
 };
 
 } // namespace popo
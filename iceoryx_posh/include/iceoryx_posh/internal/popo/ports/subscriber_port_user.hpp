@@ -24,6 +24,7 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iox/expected.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
 
@@ -67,6 +68,15 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
+    /// @brief Tries to get multiple chunks from the queue at once. The chunks are taken in the order of the queue
+    /// @param[in] maxNumberOfChunks is the maximum number of chunks to get
+    /// @param[in] onChunk is called with the ChunkHeader of each chunk; it must not call into the SubscriberPortUser
+    /// @return the number of chunks, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    expected<uint64_t, ChunkReceiveResult>
+    tryGetChunks(const uint64_t maxNumberOfChunks,
+                 const function_ref<void(const mepoo::ChunkHeader*)> onChunk) noexcept;
+
     /// @brief Release a chunk that was obtained with tryGetChunk
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
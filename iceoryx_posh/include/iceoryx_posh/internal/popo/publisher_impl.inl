@@ -20,6 +20,7 @@
 #define IOX_POSH_POPO_TYPED_PUBLISHER_IMPL_INL
 
 #include "iceoryx_posh/internal/popo/publisher_impl.hpp"
+#include "iox/vector.hpp"
 
 #include <cstdint>
 
@@ -98,6 +99,26 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(const span<Sample<T, H>> samples) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (auto& sample : samples)
+    {
+        auto userPayload = sample.release(); // release the Samples ownership of the chunk before publishing
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+    }
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
@@ -20,6 +20,8 @@
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -54,11 +56,32 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take multiple samples from the top of the receive queue at once.
+    /// @param samples to which the samples taken are appended; its free capacity is the maximum number of samples to
+    ///        take
+    /// @return The number of samples taken or a ChunkReceiveResult.
+    ///
+    template <uint64_t Capacity>
+    expected<uint64_t, ChunkReceiveResult> takeBatch(vector<Sample<const T, const H>, Capacity>& samples) noexcept;
+
+    ///
+    /// @brief Take all samples from the receive queue and call the callback with each of them.
+    /// @param callback is called with each sample taken; the sample is released when it goes out of scope unless the
+    ///        callback takes the ownership
+    /// @return The number of samples taken or a ChunkReceiveResult.
+    ///
+    expected<uint64_t, ChunkReceiveResult>
+    takeAll(const function_ref<void(Sample<const T, const H>&&)> callback) noexcept;
+
   protected:
     using PortType = typename BaseSubscriberType::PortType;
     using BaseSubscriberType::port;
 
     SubscriberImpl(PortType&& port) noexcept;
+
+  private:
+    Sample<const T, const H> makeSample(const mepoo::ChunkHeader* const receivedChunkHeader) noexcept;
 };
 
 } // namespace popo
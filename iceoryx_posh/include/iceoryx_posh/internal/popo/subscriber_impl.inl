@@ -45,12 +45,38 @@ inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T,
     {
         return err(result.error());
     }
-    auto userPayloadPtr = static_cast<const T*>(result.value()->userPayload());
+    return ok(makeSample(result.value()));
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+template <uint64_t Capacity>
+inline expected<uint64_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::takeBatch(vector<Sample<const T, const H>, Capacity>& samples) noexcept
+{
+    return BaseSubscriberType::takeChunks(samples.capacity() - samples.size(),
+                                          [&](const mepoo::ChunkHeader* chunkHeader) {
+                                              samples.emplace_back(makeSample(chunkHeader));
+                                          });
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+inline expected<uint64_t, ChunkReceiveResult> SubscriberImpl<T, H, BaseSubscriberType>::takeAll(
+    const function_ref<void(Sample<const T, const H>&&)> callback) noexcept
+{
+    return BaseSubscriberType::takeAllChunks(
+        [&](const mepoo::ChunkHeader* chunkHeader) { callback(makeSample(chunkHeader)); });
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+inline Sample<const T, const H>
+SubscriberImpl<T, H, BaseSubscriberType>::makeSample(const mepoo::ChunkHeader* const receivedChunkHeader) noexcept
+{
+    auto userPayloadPtr = static_cast<const T*>(receivedChunkHeader->userPayload());
     auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this](const T* userPayload) {
         auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
         this->port().releaseChunk(chunkHeader);
     });
-    return ok<Sample<const T, const H>>(std::move(samplePtr));
+    return Sample<const T, const H>(std::move(samplePtr));
 }
 
 template <typename T, typename H, typename BaseSubscriberType>
@@ -22,6 +22,8 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iox/expected.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/span.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox
@@ -57,6 +59,25 @@ class UntypedSubscriberImpl : public BaseSubscriberType
     ///
     expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take multiple chunks from the top of the receive queue at once.
+    /// @param userPayloads is filled with the user-payload pointers of the chunks taken; its size is the maximum
+    ///        number of chunks to take
+    /// @return The number of chunks taken.
+    /// @details No automatic cleanup of the associated chunks is performed
+    ///          and must be manually done by calling 'release' for each chunk
+    ///
+    expected<uint64_t, ChunkReceiveResult> takeBatch(span<const void*> userPayloads) noexcept;
+
+    ///
+    /// @brief Take all chunks from the receive queue and call the callback with each of them.
+    /// @param callback is called with the user-payload pointer of each chunk taken; it is allowed to call 'release'
+    /// @return The number of chunks taken.
+    /// @details No automatic cleanup of the associated chunks is performed
+    ///          and must be manually done by calling 'release' for each chunk
+    ///
+    expected<uint64_t, ChunkReceiveResult> takeAll(const function_ref<void(const void*)> callback) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -48,6 +48,25 @@ inline expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<BaseSubsc
     return ok(result.value()->userPayload());
 }
 
+template <typename BaseSubscriberType>
+inline expected<uint64_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriberType>::takeBatch(span<const void*> userPayloads) noexcept
+{
+    uint64_t index{0U};
+    return BaseSubscriber::takeChunks(userPayloads.size(), [&](const mepoo::ChunkHeader* chunkHeader) {
+        userPayloads[index] = chunkHeader->userPayload();
+        ++index;
+    });
+}
+
+template <typename BaseSubscriberType>
+inline expected<uint64_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriberType>::takeAll(const function_ref<void(const void*)> callback) noexcept
+{
+    return BaseSubscriber::takeAllChunks(
+        [&](const mepoo::ChunkHeader* chunkHeader) { callback(chunkHeader->userPayload()); });
+}
+
 template <typename BaseSubscriberType>
 inline void UntypedSubscriberImpl<BaseSubscriberType>::release(const void* const userPayload) noexcept
 {
@@ -21,6 +21,8 @@
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/atomic.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
 
 #include <cstdint>
 
@@ -53,6 +55,13 @@ class UsedChunkList
     /// @note only from runtime context
     bool insert(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Inserts multiple SharedChunks into the list with a single synchronization for all of them
+    /// @param[in] nextChunk is called as long as the list has free space and provides the next chunk to store in the
+    /// list or a nullopt if there are no more chunks
+    /// @return the number of inserted chunks
+    /// @note only from runtime context
+    uint32_t insertBatch(const function_ref<optional<mepoo::SharedChunk>()> nextChunk) noexcept;
+
     /// @brief Removes a chunk from the list
     /// @param[in] chunkHeader to look for a corresponding SharedChunk
     /// @param[out] chunk which is removed
@@ -67,6 +76,7 @@ class UsedChunkList
 
   private:
     void init() noexcept;
+    bool insertWithoutSynchronization(const mepoo::SharedChunk& chunk) noexcept;
 
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
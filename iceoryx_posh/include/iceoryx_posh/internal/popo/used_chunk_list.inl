@@ -37,6 +37,39 @@ UsedChunkList<Capacity>::UsedChunkList() noexcept
 
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
+{
+    if (insertWithoutSynchronization(chunk))
+    {
+        m_synchronizer.clear(std::memory_order_release);
+        return true;
+    }
+    return false;
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::insertBatch(const function_ref<optional<mepoo::SharedChunk>()> nextChunk) noexcept
+{
+    uint32_t numberOfInsertedChunks{0U};
+    while (m_freeListHead != INVALID_INDEX)
+    {
+        auto chunk = nextChunk();
+        if (!chunk.has_value())
+        {
+            break;
+        }
+        insertWithoutSynchronization(chunk.value());
+        ++numberOfInsertedChunks;
+    }
+
+    if (numberOfInsertedChunks > 0U)
+    {
+        m_synchronizer.clear(std::memory_order_release);
+    }
+    return numberOfInsertedChunks;
+}
+
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::insertWithoutSynchronization(const mepoo::SharedChunk& chunk) noexcept
 {
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
@@ -53,7 +86,6 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
         // set freeListHead to the next free entry
         m_freeListHead = nextFree;
 
-        m_synchronizer.clear(std::memory_order_release);
         return true;
     }
     else
@@ -93,6 +93,12 @@ inline WaitSet<Capacity>::~WaitSet() noexcept
 {
     removeAllTriggers();
     m_conditionVariableDataPtr->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    if (m_conditionVariableDataPtr->m_discoveryNotifierDataPtr)
+    {
+        DiscoveryNotifier(*m_conditionVariableDataPtr->m_discoveryNotifierDataPtr.get(),
+                          m_conditionVariableDataPtr->m_discoveryNotificationIndex)
+            .notify();
+    }
 }
 
 template <uint64_t Capacity>
@@ -333,6 +339,18 @@ inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::wai
     return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.wait(); });
 }
 
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::setSpinDuration(const units::Duration spinDuration) noexcept
+{
+    m_conditionListener.setSpinDuration(spinDuration);
+}
+
+template <uint64_t Capacity>
+inline units::Duration WaitSet<Capacity>::spinDuration() const noexcept
+{
+    return m_conditionListener.spinDuration();
+}
+
 template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
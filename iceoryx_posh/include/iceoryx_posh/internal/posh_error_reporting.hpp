@@ -93,7 +93,8 @@ namespace iox
     error(POPO__BASE_SERVER_OVERRIDING_WITH_STATE_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION) \
     error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER) \
-    error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
+    error(POPO__CHUNK_DISTRIBUTOR_DATA_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__CHUNK_DISTRIBUTOR_SEMAPHORE_CORRUPTED_IN_WAIT) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER) \
     error(POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER) \
@@ -116,8 +117,15 @@ namespace iox
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY) \
     error(POPO__CONDITION_NOTIFIER_INDEX_TOO_LARGE) \
     error(POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__DISCOVERY_NOTIFIER_DATA_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__DISCOVERY_NOTIFIER_INDEX_TOO_LARGE) \
+    error(POPO__DISCOVERY_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__DISCOVERY_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT) \
+    error(POPO__DISCOVERY_LISTENER_SEMAPHORE_CORRUPTED_IN_WAKE_UP) \
+    error(POPO__DISCOVERY_LISTENER_SEMAPHORE_CORRUPTED_IN_RESET) \
     error(POPO__NOTIFICATION_INFO_TYPE_INCONSISTENCY_IN_GET_ORIGIN) \
     error(POPO__TYPED_UNIQUE_ID_OVERFLOW) \
+    error(POPO__WAITING_PRODUCER_REGISTRY_SEMAPHORE_CORRUPTED_IN_WAKE_UP) \
     error(MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE) \
     error(MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL) \
     error(MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE) \
@@ -80,13 +80,18 @@ class MemPoolIntrospection
     static void prepareIntrospectionSample(MemPoolIntrospectionInfo& sample,
                                            const PosixGroup& readerGroup,
                                            const PosixGroup& writerGroup,
+                                           const mepoo::SharedMemoryOptions& sharedMemoryOptions,
                                            uint32_t id) noexcept;
 
     /// @brief copy data fro internal struct into interface struct
-    void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
+    void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest, const uint32_t id) noexcept;
 
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
+    /// the allocation counters of the mempools wrap around at 2^32 and are extended to 64 bit with every sample; a
+    /// wrap around is detected as long as there are less than 2^32 allocations between two samples
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) indexed by the segment id and the mempool
+    uint64_t m_allocatedChunks[MAX_SHM_SEGMENTS + 1U][MAX_NUMBER_OF_MEMPOOLS]{};
     concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
         concurrent::detail::PeriodicTaskManualStart, "MemPoolIntr", *this, &MemPoolIntrospection::send};
 };
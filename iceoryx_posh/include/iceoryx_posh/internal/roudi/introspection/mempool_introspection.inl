@@ -21,6 +21,8 @@
 #include "iox/thread.hpp"
 #include "mempool_introspection.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -71,13 +73,19 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
     MemPoolIntrospectionInfo& sample,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
+    const mepoo::SharedMemoryOptions& sharedMemoryOptions,
     uint32_t id) noexcept
 {
     sample.m_readerGroupName.assign("");
     sample.m_readerGroupName.append(TruncateToCapacity, readerGroup.getName());
     sample.m_writerGroupName.assign("");
     sample.m_writerGroupName.append(TruncateToCapacity, writerGroup.getName());
+    sample.m_numaPolicy = sharedMemoryOptions.numaPolicy;
+    sample.m_numaNode = sharedMemoryOptions.numaNode;
     sample.m_id = id;
+    sample.m_timestampInNanoseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
 }
 
 
@@ -108,8 +116,9 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
             prepareIntrospectionSample(memPoolIntrospectionInfo,
                                        PosixGroup::getGroupOfCurrentProcess(),
                                        PosixGroup::getGroupOfCurrentProcess(),
+                                       mepoo::SharedMemoryOptions(),
                                        id);
-            copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
+            copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo, id);
             ++id;
 
             // User shm segments
@@ -118,9 +127,12 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                 if (sample->emplace_back())
                 {
                     auto& memPoolIntrospectionInfo = sample->back();
-                    prepareIntrospectionSample(
-                        memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
-                    copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
+                    prepareIntrospectionSample(memPoolIntrospectionInfo,
+                                               segment.getReaderGroup(),
+                                               segment.getWriterGroup(),
+                                               segment.getSharedMemoryOptions(),
+                                               id);
+                    copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo, id);
                 }
                 else
                 {
@@ -151,7 +163,8 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 inline void
 MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolInfo(const MemoryManager& memoryManager,
-                                                                                    MemPoolInfoContainer& dest) noexcept
+                                                                                    MemPoolInfoContainer& dest,
+                                                                                    const uint32_t id) noexcept
 {
     auto numOfMemPools = memoryManager.getNumberOfMemPools();
     dest = MemPoolInfoContainer(numOfMemPools, MemPoolInfo());
@@ -161,9 +174,17 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
         auto& dst = dest[i];
         dst.m_usedChunks = src.m_usedChunks;
         dst.m_minFreeChunks = src.m_minFreeChunks;
+        dst.m_cachedChunks = src.m_cachedChunks;
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - sizeof(mepoo::ChunkHeader);
+        dst.m_spilledChunks = src.m_spilledChunks;
+        auto& allocatedChunks = m_allocatedChunks[id][i];
+        allocatedChunks += static_cast<uint32_t>(src.m_allocatedChunks - static_cast<uint32_t>(allocatedChunks));
+        dst.m_allocatedChunks = allocatedChunks;
+        // the used and the allocated chunks are sampled together, therefore the used chunks never exceed the allocated
+        dst.m_freedChunks = allocatedChunks - src.m_usedChunks;
+        dst.m_failedAllocations = src.m_failedAllocations;
     }
 }
 
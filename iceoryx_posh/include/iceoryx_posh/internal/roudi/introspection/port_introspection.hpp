@@ -28,6 +28,7 @@
 #include "iox/fixed_position_container.hpp"
 #include "iox/function.hpp"
 
+#include <chrono>
 #include <mutex>
 
 #include <map>
@@ -79,6 +80,9 @@ class PortIntrospection
                 , process(portData.m_runtimeName)
                 , service(portData.m_serviceDescription)
                 , options(portData.m_options)
+                , lastNumberOfSentChunks(
+                      portData.m_chunkSenderData.m_statistics.m_numberOfSentChunks.load(std::memory_order_relaxed))
+                , lastThroughputTimestamp(std::chrono::steady_clock::now())
             {
             }
 
@@ -87,6 +91,10 @@ class PortIntrospection
             capro::ServiceDescription service;
             popo::PublisherOptions options;
 
+            /// number of sent chunks and time at the last throughput sample, used to calculate the send rate
+            uint64_t lastNumberOfSentChunks{0U};
+            std::chrono::steady_clock::time_point lastThroughputTimestamp;
+
             /// map from indices to ConnectionContainer indices
             std::map<int, ConnectionContainerIndexType> connectionMap;
             int index{-1};
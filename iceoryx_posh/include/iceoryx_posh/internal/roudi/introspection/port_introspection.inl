@@ -593,10 +593,57 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void
-PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortThroughputIntrospectionTopic& topic
-                                                                         [[maybe_unused]]) noexcept
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo iox-#402 re-add port throughput
+    constexpr double NANOSECS_PER_MINUTE{static_cast<double>(units::Duration::NANOSECS_PER_SEC)
+                                         * units::Duration::SECS_PER_MINUTE};
+
+    std::lock_guard<std::mutex> lock(m_mutex); // we need to lock the internal data structs
+
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& pub : m_publisherMap)
+    {
+        auto& innerPublisherMap = pub.second;
+        for (auto& pair : innerPublisherMap)
+        {
+            auto m_publisherIndex = pair.second;
+            if (m_publisherIndex >= 0)
+            {
+                auto publisherInfo = m_publisherContainer.iter_from_index(m_publisherIndex);
+                const auto& chunkSenderData = publisherInfo->portData->m_chunkSenderData;
+                const auto& statistics = chunkSenderData.m_statistics;
+
+                PortThroughputData throughputData;
+                PublisherPort port(publisherInfo->portData);
+                throughputData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+                throughputData.m_sampleSize = statistics.m_lastUserPayloadSize.load(std::memory_order_relaxed);
+                throughputData.m_chunkSize = statistics.m_lastChunkSize.load(std::memory_order_relaxed);
+                throughputData.m_lastSendIntervalInNanoseconds =
+                    statistics.m_lastSendIntervalInNanoseconds.load(std::memory_order_relaxed);
+                throughputData.m_numberOfSentChunks = statistics.m_numberOfSentChunks.load(std::memory_order_relaxed);
+                throughputData.m_numberOfSentBytes =
+                    statistics.m_numberOfSentUserPayloadBytes.load(std::memory_order_relaxed);
+                throughputData.m_numberOfLostChunks =
+                    chunkSenderData.m_numberOfLostChunks.load(std::memory_order_relaxed);
+                throughputData.m_isField = chunkSenderData.m_historyCapacity > 0U;
+
+                const auto elapsedNanoseconds =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - publisherInfo->lastThroughputTimestamp)
+                        .count();
+                if (elapsedNanoseconds > 0)
+                {
+                    const auto chunksInInterval =
+                        throughputData.m_numberOfSentChunks - publisherInfo->lastNumberOfSentChunks;
+                    throughputData.m_chunksPerMinute = static_cast<double>(chunksInInterval) * NANOSECS_PER_MINUTE
+                                                       / static_cast<double>(elapsedNanoseconds);
+                }
+                publisherInfo->lastNumberOfSentChunks = throughputData.m_numberOfSentChunks;
+                publisherInfo->lastThroughputTimestamp = now;
+
+                topic.m_throughputList.emplace_back(throughputData);
+            }
+        }
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -622,6 +669,16 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
                     // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
                     // subscriberData.fifoSize = port.getDeliveryFiFoSize();
                     subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+
+                    auto* latencyHistogram = subscriberInfo.portData->m_chunkReceiverData.m_latencyHistogram.get();
+                    if (latencyHistogram != nullptr)
+                    {
+                        const auto latencies = latencyHistogram->drain();
+                        subscriberData.numberOfLatencySamples = latencies.m_numberOfValues;
+                        subscriberData.latencyP50InNanoseconds = latencies.percentile(0.5);
+                        subscriberData.latencyP99InNanoseconds = latencies.percentile(0.99);
+                        subscriberData.latencyP999InNanoseconds = latencies.percentile(0.999);
+                    }
                 }
                 else
                 {
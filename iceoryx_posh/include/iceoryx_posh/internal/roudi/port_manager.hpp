@@ -61,8 +61,17 @@ class PortManager
     /// @todo iox-#518 Remove this later
     void stopPortIntrospection() noexcept;
 
+    /// @brief Processes the requests of the ports and condition variables which notified the discovery since the
+    ///        last call, e.g. an offer, a subscription or the destruction of a port
     void doDiscovery() noexcept;
 
+    /// @brief Returns the data with which the ports and condition variables notify about requests for the discovery
+    popo::DiscoveryNotifierData& discoveryNotifierData() noexcept;
+
+    /// @brief Detaches all ports and condition variables from the discovery notifier; must be called once the
+    ///        discovery has stopped since the ports are still shut down afterwards
+    void stopDiscoveryNotifications() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -149,10 +158,35 @@ class PortManager
 
     void destroyServerPort(popo::ServerPortData* const clientPortData) noexcept;
 
+    /// @brief removes the registrations of a sender from the queues of all receivers in which it waits for free space;
+    /// must be called before the sender is released since a receiver would otherwise post the released semaphore
+    /// @param[in] senderWakeUpSemaphore of the sender which is destroyed
+    void removeWaitingSenderFromAllQueues(const optional<build::InterProcessSemaphore>& senderWakeUpSemaphore) noexcept;
+
     void handleServerPorts() noexcept;
 
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
 
+    /// @brief publishes the queue changes of the publishers, clients and servers which were postponed since their
+    /// applications had not yet released the previous queues
+    void publishPendingQueueChanges() noexcept;
+
+    /// @brief gives the destroyed subscriber, client and server ports back to the port pool once no sender can access
+    /// their queues anymore
+    void releaseDestroyedPorts() noexcept;
+
+    bool isQueueOfSubscriberAccessible(const SubscriberPortType::MemberType_t& subscriberPortData) const noexcept;
+
+    bool isQueueOfClientAccessible(const popo::ClientPortData& clientPortData) const noexcept;
+
+    bool isQueueOfServerAccessible(const popo::ServerPortData& serverPortData) const noexcept;
+
+    void releaseSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+
+    void releaseClientPort(popo::ClientPortData* const clientPortData) noexcept;
+
+    void releaseServerPort(popo::ServerPortData* const serverPortData) noexcept;
+
     void handleInterfaces() noexcept;
 
     void handleConditionVariables() noexcept;
@@ -190,8 +224,14 @@ class PortManager
 
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
+    bool isServiceDiscoveryPort(const PublisherPortRouDiType::MemberType_t& publisherPortData) const noexcept;
+
     void publishServiceRegistry() noexcept;
 
+    void publishServiceRegistryChange(const uint64_t previousSequenceNumber,
+                                      const ServiceRegistryChange::Kind kind,
+                                      const capro::ServiceDescription& service) noexcept;
+
     const ServiceRegistry& serviceRegistry() const noexcept;
 
   private:
@@ -201,6 +241,16 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryChangesPublisherPortData;
+    /// the complete registry is only published for subscribers which joined the service discovery or missed a change;
+    /// initially it is requested to provide the first registry via the history of the service registry port
+    bool m_isServiceRegistrySnapshotRequested{true};
+    optional<uint64_t> m_publishedServiceRegistrySequenceNumber;
+    /// the queue of a destroyed subscriber, client or server might still be accessed by a sender whose application
+    /// has not yet released the previous queues; such a port is given back to the port pool in a later discovery run
+    vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> m_destroyedSubscriberPorts;
+    vector<popo::ClientPortData*, MAX_CLIENTS> m_destroyedClientPorts;
+    vector<popo::ServerPortData*, MAX_SERVERS> m_destroyedServerPorts;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -18,7 +18,10 @@
 #define IOX_POSH_ROUDI_PORT_POOL_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_cache.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
@@ -57,6 +60,29 @@ struct PortPoolData
     using ClientContainer = FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS>;
     ClientContainer m_clientPortMembers;
 
+    /// @brief the latency histograms of the subscribers which requested 'SubscriberOptions::recordLatency'
+    using LatencyHistogramContainer = FixedPositionContainer<popo::LatencyHistogram, MAX_NUMBER_OF_LATENCY_HISTOGRAMS>;
+    LatencyHistogramContainer m_latencyHistograms;
+
+    /// @brief the chunk caches of the publishers which requested 'PublisherOptions::chunkCacheSize'
+    using MemPoolCacheContainer = FixedPositionContainer<mepoo::MemPoolCache, MAX_NUMBER_OF_MEMPOOL_CACHES>;
+    MemPoolCacheContainer m_memPoolCaches;
+
+    /// @brief the ports and condition variables notify RouDi about requests for the discovery; each container
+    ///        occupies a range of notification indices which is as large as its capacity
+    popo::DiscoveryNotifierData m_discoveryNotifierData;
+
+    static constexpr uint64_t PUBLISHER_NOTIFICATION_OFFSET{0U};
+    static constexpr uint64_t SUBSCRIBER_NOTIFICATION_OFFSET{PUBLISHER_NOTIFICATION_OFFSET + MAX_PUBLISHERS};
+    static constexpr uint64_t SERVER_NOTIFICATION_OFFSET{SUBSCRIBER_NOTIFICATION_OFFSET + MAX_SUBSCRIBERS};
+    static constexpr uint64_t CLIENT_NOTIFICATION_OFFSET{SERVER_NOTIFICATION_OFFSET + MAX_SERVERS};
+    static constexpr uint64_t INTERFACE_NOTIFICATION_OFFSET{CLIENT_NOTIFICATION_OFFSET + MAX_CLIENTS};
+    static constexpr uint64_t CONDITION_VARIABLE_NOTIFICATION_OFFSET{INTERFACE_NOTIFICATION_OFFSET
+                                                                     + MAX_INTERFACE_NUMBER};
+    static_assert(CONDITION_VARIABLE_NOTIFICATION_OFFSET + MAX_NUMBER_OF_CONDITION_VARIABLES
+                      == popo::DiscoveryNotifierData::CAPACITY,
+                  "Every port and condition variable requires a notification index!");
+
     const roudi::UniqueRouDiId m_uniqueRouDiId;
 };
 
@@ -24,13 +24,16 @@
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 #include "iox/list.hpp"
 #include "iox/posix_user.hpp"
+#include "iox/span.hpp"
 
 #include <cstdint>
 #include <ctime>
+#include <mutex>
 
 namespace iox
 {
@@ -44,6 +47,10 @@ class ProcessManagerInterface
     virtual ~ProcessManagerInterface() noexcept = default;
 };
 
+/// @brief Manages the registered processes and creates their ports. The process list and the port manager are
+/// protected by separate locks, therefore the ports of one process can be created while another process registers.
+/// @note The messages of one process must not be processed concurrently, e.g. a port request must not overtake the
+/// registration of the same process
 class ProcessManager : public ProcessManagerInterface
 {
   public:
@@ -146,6 +153,12 @@ class ProcessManager : public ProcessManagerInterface
 
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Adds the requested ports to the internal process object and sends all of them with a single response to
+    /// the OS process; a port which could not be created is reported as error without affecting the other ports
+    /// @param[in] name is the name of the runtime requesting the ports
+    /// @param[in] requests describe the ports to create
+    void addPortsForProcess(const RuntimeName_t& name, const span<const runtime::PortRequest> requests) noexcept;
+
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
     void run() noexcept;
@@ -157,8 +170,72 @@ class ProcessManager : public ProcessManagerInterface
 
 
   private:
+    /// @brief The data of a registered process which is required to create its ports without holding the lock of the
+    /// process list
+    struct PortOwner
+    {
+        RuntimeName_t name;
+        PosixUser user;
+    };
+
+    /// @note the lock of the process list must be held
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
+    /// @brief Looks up the data which is required to create the ports of a process
+    /// @return the data or nullopt if the process is not registered
+    optional<PortOwner> findPortOwner(const RuntimeName_t& name) noexcept;
+
+    /// @brief Sends a message to the process. If the process was removed while its ports were created, the orphaned
+    /// ports are deleted instead
+    void sendToPortOwner(const PortOwner& owner, const runtime::IpcMessage& message) noexcept;
+
+    /// @brief Sends the port to the process as serialized relative pointer or the error if the port creation failed
+    void sendPortToProcess(
+        const PortOwner& owner,
+        const runtime::IpcMessageType ackType,
+        const expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>& port) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireSubscriberForProcess(const PortOwner& owner,
+                                const capro::ServiceDescription& service,
+                                const popo::SubscriberOptions& subscriberOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquirePublisherForProcess(const PortOwner& owner,
+                               const capro::ServiceDescription& service,
+                               const popo::PublisherOptions& publisherOptions,
+                               const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireClientForProcess(const PortOwner& owner,
+                            const capro::ServiceDescription& service,
+                            const popo::ClientOptions& clientOptions,
+                            const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireServerForProcess(const PortOwner& owner,
+                            const capro::ServiceDescription& service,
+                            const popo::ServerOptions& serverOptions,
+                            const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    acquireConditionVariableForProcess(const PortOwner& owner) noexcept;
+
+    /// @brief Returns the heartbeat of a monitored process, which is stored in the chunk senders of its ports so that
+    /// a queue snapshot pinned by a dead process can be reclaimed
+    /// @param [in] process for which the heartbeat is returned
+    /// @return the heartbeat or a nullptr if the process is not monitored
+    /// @note the lock of the process list must be held
+    runtime::Heartbeat* heartbeatOfProcess(const Process& process) noexcept;
+
+    /// @brief Returns the heartbeat of the process which owns a newly created port; the heartbeat is resolved instead
+    /// of being stored in the PortOwner since the monitoring might have removed the process in the meantime
+    /// @param [in] owner of the port
+    /// @return the heartbeat or a nullptr if the process is not monitored or not registered anymore
+    /// @note the locks of the process list and the port manager must be held
+    runtime::Heartbeat* heartbeatOfPortOwner(const PortOwner& owner) noexcept;
+
     void monitorProcesses() noexcept;
     void discoveryUpdate() noexcept override;
 
@@ -222,6 +299,9 @@ class ProcessManager : public ProcessManagerInterface
                            ShutdownPolicy shutdownPolicy) noexcept;
 
     RouDiMemoryInterface& m_roudiMemoryInterface;
+    /// @note when both locks are required, the lock of the process list must be acquired first
+    mutable std::mutex m_processListMutex;
+    std::mutex m_portManagerMutex;
     PortManager& m_portManager;
     const DomainId m_domainId;
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
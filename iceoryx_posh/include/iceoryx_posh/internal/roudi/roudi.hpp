@@ -22,16 +22,17 @@
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
-#include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
 #include "iceoryx_posh/roudi/roudi_config.hpp"
 #include "iox/atomic.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/posix_user.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/scope_guard.hpp"
-#include "iox/smart_lock.hpp"
+#include "iox/unnamed_semaphore.hpp"
+#include "iox/vector.hpp"
 
 #include <cstdint>
 #include <thread>
@@ -80,6 +81,12 @@ class RouDi
                                               iox_uid_t& userId,
                                               int64_t& transmissionTimestamp) noexcept;
 
+    /// @brief Deserializes a single port request of a IpcMessageType::CREATE_PORTS message
+    /// @param [in] message is the IpcMessageType::CREATE_PORTS message
+    /// @param [in] index of the first entry of the port request in the message
+    /// @return the port request or nullopt if the entries could not be deserialized
+    optional<runtime::PortRequest> parsePortRequest(const runtime::IpcMessage& message, const uint32_t index) noexcept;
+
     /// @brief Handles the registration request from process
     /// @param [in] name of the process which wants to register at roudi; this is equal to the IPC channel name
     /// @param [in] pid is the host system process id
@@ -99,16 +106,35 @@ class RouDi
     static uint64_t getUniqueSessionIdForProcess() noexcept;
 
   private:
+    /// @brief A thread which processes the runtime messages dispatched by the thread receiving them
+    struct RuntimeMessageWorker
+    {
+        concurrent::MpmcLockFreeQueue<runtime::IpcMessage, RUNTIME_MESSAGE_WORKER_QUEUE_CAPACITY> messages;
+        optional<UnnamedSemaphore> wakeupSemaphore;
+        std::thread thread;
+    };
+
     void processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterface) noexcept;
 
+    /// @brief Hands the message over to the worker which is responsible for the sending runtime; all messages of a
+    /// runtime are processed by the same worker to preserve their order
+    void dispatchRuntimeMessage(runtime::IpcMessage&& message) noexcept;
+
+    void processDispatchedRuntimeMessages(const uint32_t workerIndex) noexcept;
+
+    void processRuntimeMessage(const runtime::IpcMessage& message) noexcept;
+
+    void stopRuntimeMessageWorkers() noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
     const config::RouDiConfig m_roudiConfig;
     concurrent::Atomic<bool> m_runMonitoringAndDiscoveryThread;
     concurrent::Atomic<bool> m_runHandleRuntimeMessageThread;
+    concurrent::Atomic<bool> m_runRuntimeMessageWorkers{true};
 
-    popo::UserTrigger m_discoveryLoopTrigger;
+    concurrent::Atomic<bool> m_discoveryLoopTriggered{false};
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
@@ -125,11 +151,12 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    ProcessManager m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
     std::thread m_handleRuntimeMessageThread;
+    vector<RuntimeMessageWorker, MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS> m_runtimeMessageWorkers;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
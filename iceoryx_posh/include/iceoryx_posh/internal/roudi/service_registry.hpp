@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/expected.hpp"
 #include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
@@ -32,6 +33,29 @@ namespace iox
 {
 namespace roudi
 {
+/// @brief A single modification of the ServiceRegistry. RouDi publishes these changes in addition to the complete
+///        registry in order to let the applications update their copy of the registry incrementally.
+struct ServiceRegistryChange
+{
+    enum class Kind : uint8_t
+    {
+        ADD_PUBLISHER,
+        REMOVE_PUBLISHER,
+        ADD_SERVER,
+        REMOVE_SERVER,
+    };
+
+    /// @brief the sequence number of the registry after the change was applied
+    uint64_t sequenceNumber{0U};
+    Kind kind{Kind::ADD_PUBLISHER};
+    capro::ServiceDescription serviceDescription;
+};
+
+/// @brief The ServiceRegistry stores the offered services. Besides the entries it maintains an open addressing hash
+///        index on the complete service description and secondary hash indices on the service, instance and event
+///        id. This makes registration and searches with at least one non-wildcard id independent of the number of
+///        entries. Since a copy of the ServiceRegistry is published to the applications, the indices only consist of
+///        plain indices and are therefore relocatable.
 class ServiceRegistry
 {
   public:
@@ -56,6 +80,8 @@ class ServiceRegistry
         ReferenceCounter_t serverCount{0U};
     };
 
+    ServiceRegistry() noexcept;
+
     /// @brief Adds a given publisher service description to registry
     /// @param[in] serviceDescription, service to be added
     /// @return ServiceRegistryError, error wrapped in expected
@@ -86,6 +112,8 @@ class ServiceRegistry
     /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
     /// @param[in] event, string or wildcard (= iox::nullopt) to search for
     /// @param[in] callable, callable to apply to each matching entry
+    /// @note When at least one id is not a wildcard, the matching entries are visited in the order they were added.
+    ///       When all ids are wildcards, the entries are visited in the same order as with forEach.
     void find(const optional<capro::IdString_t>& service,
               const optional<capro::IdString_t>& instance,
               const optional<capro::IdString_t>& event,
@@ -100,27 +128,82 @@ class ServiceRegistry
     /// @return true when the registry changed since the last call, false otherwise
     bool hasDataChangedSinceLastCall() noexcept;
 
+    /// @brief Returns the sequence number of the registry which is incremented with every modification
+    /// @return the current sequence number, 0 for a registry which was never modified
+    uint64_t sequenceNumber() const noexcept;
+
+    /// @brief Applies a change of another registry, e.g. the one of RouDi, to this copy of the registry
+    /// @param[in] change, the change to apply
+    /// @return true when the change was applied, false when it does not directly follow the current state of the
+    ///         registry, i.e. its sequence number is not the successor of the current sequence number
+    bool applyChange(const ServiceRegistryChange& change) noexcept;
+
   private:
     using Entry_t = optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
+    using Hash_t = uint32_t;
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
 
+    /// @brief the ids of a service description, used to address the secondary indices
+    static constexpr uint32_t SERVICE_ID{0U};
+    static constexpr uint32_t INSTANCE_ID{1U};
+    static constexpr uint32_t EVENT_ID{2U};
+    static constexpr uint32_t NUMBER_OF_IDS{3U};
+
+    /// @brief number of slots of the open addressing hash index, this keeps the load factor at or below 0.5
+    static constexpr uint32_t LOOKUP_CAPACITY = iox::nextPowerOfTwo(2U * CAPACITY);
+    /// @brief number of buckets of each secondary index
+    static constexpr uint32_t NUMBER_OF_BUCKETS = iox::nextPowerOfTwo(CAPACITY);
+
+    /// @brief the index information of an entry, stored at the same index as the entry itself
+    struct IndexNode
+    {
+        Hash_t keyHash{0U};
+        // NOLINTJUSTIFICATION the ServiceRegistry is copied to shared memory and must be trivially relocatable
+        // NOLINTBEGIN(*avoid-c-arrays)
+        Hash_t idHashes[NUMBER_OF_IDS]{};
+        uint32_t next[NUMBER_OF_IDS]{};
+        uint32_t previous[NUMBER_OF_IDS]{};
+        // NOLINTEND(*avoid-c-arrays)
+    };
+
+    /// @brief a bucket of a secondary index, a doubly linked list of all entries with the same id hash
+    struct Bucket
+    {
+        uint32_t head{NO_INDEX};
+        uint32_t tail{NO_INDEX};
+        uint32_t size{0U};
+    };
+
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
-    // store the last known free Index (if any is known)
-    // we could use a queue (or stack) here since they are not optimal
-    // for the filling pattern of a vector (prefer entries close to the front)
-    uint32_t m_freeIndex{NO_INDEX};
+    // NOLINTJUSTIFICATION the ServiceRegistry is copied to shared memory and must be trivially relocatable
+    // NOLINTBEGIN(*avoid-c-arrays)
+    IndexNode m_indexNodes[CAPACITY];
+    uint32_t m_lookup[LOOKUP_CAPACITY];
+    Bucket m_buckets[NUMBER_OF_IDS][NUMBER_OF_BUCKETS];
+    // NOLINTEND(*avoid-c-arrays)
+
+    // indices of the slots which were occupied by previously removed entries, the most recently freed slot is reused
+    // first
+    vector<uint32_t, CAPACITY> m_freeIndices;
 
     bool m_dataChanged{true}; // initially true in order to also get notified of the empty registry
+    uint64_t m_sequenceNumber{0U};
 
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
-
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
                               ReferenceCounter_t ServiceDescriptionEntry::*count);
+
+    void remove(const uint32_t index) noexcept;
+
+    void changed() noexcept;
+
+    void addToIndices(const uint32_t index) noexcept;
+    void removeFromIndices(const uint32_t index) noexcept;
 };
 
 } // namespace roudi
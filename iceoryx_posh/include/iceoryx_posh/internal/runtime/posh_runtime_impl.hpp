@@ -82,6 +82,9 @@ class PoshRuntimeImpl : public PoshRuntime
     /// @copydoc PoshRuntime::getMiddlewareConditionVariable
     popo::ConditionVariableData* getMiddlewareConditionVariable() noexcept override;
 
+    /// @copydoc PoshRuntime::createPorts
+    uint64_t createPorts(const span<PortRequest> requests) noexcept override;
+
     /// @copydoc PoshRuntime::sendRequestToRouDi
     bool sendRequestToRouDi(const IpcMessage& msg,
                             IpcMessage& answer,
@@ -101,6 +104,42 @@ class PoshRuntimeImpl : public PoshRuntime
                     std::pair<IpcRuntimeInterface, optional<SharedMemoryUser>>&& interfaces) noexcept;
 
   private:
+    popo::PublisherOptions sanitizePublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept;
+
+    popo::SubscriberOptions sanitizeSubscriberOptions(const capro::ServiceDescription& service,
+                                                      const popo::SubscriberOptions& subscriberOptions) const noexcept;
+
+    popo::ClientOptions sanitizeClientOptions(const popo::ClientOptions& clientOptions) const noexcept;
+
+    popo::ServerOptions sanitizeServerOptions(const popo::ServerOptions& serverOptions) const noexcept;
+
+    void reportPublisherCreationError(const capro::ServiceDescription& service,
+                                      const IpcMessageErrorType error) const noexcept;
+
+    void reportSubscriberCreationError(const capro::ServiceDescription& service,
+                                       const IpcMessageErrorType error) const noexcept;
+
+    void reportClientCreationError(const capro::ServiceDescription& service,
+                                   const IpcMessageErrorType error) const noexcept;
+
+    void reportServerCreationError(const capro::ServiceDescription& service,
+                                   const IpcMessageErrorType error) const noexcept;
+
+    void reportConditionVariableCreationError(const IpcMessageErrorType error) const noexcept;
+
+    void reportPortCreationError(const PortRequest& request, const IpcMessageErrorType error) const noexcept;
+
+    /// @brief adds the request as type, service description, options and port config info entries to the message
+    void addPortRequestToMessage(const PortRequest& request, IpcMessage& sendBuffer) const noexcept;
+
+    /// @brief sends a single IpcMessageType::CREATE_PORTS message and stores the created ports in the requests
+    /// @return the number of successfully created ports
+    uint64_t requestPortsFromRoudi(const IpcMessage& sendBuffer, const span<PortRequest> requests) noexcept;
+
+    /// @brief fallback for a RouDi which does not support IpcMessageType::CREATE_PORTS
+    /// @return the number of successfully created ports
+    uint64_t createPortsOneByOne(const span<PortRequest> requests) noexcept;
+
     expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
     requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
@@ -43,6 +43,7 @@ struct NoUserHeader
 struct ChunkHeader
 {
     using UserPayloadOffset_t = uint32_t;
+    using SendTimestamp_t = uint64_t;
 
     /// @brief constructs and initializes a ChunkHeader
     /// @param[in] chunkSize is the size of the chunk the ChunkHeader is constructed
@@ -68,6 +69,9 @@ struct ChunkHeader
     /// @brief User-Header id for an unknown user-header
     static constexpr uint16_t UNKNOWN_USER_HEADER{0xFFFF};
 
+    /// @brief Flag of the extensions for the send timestamp which is stored behind the user-payload
+    static constexpr uint8_t SEND_TIMESTAMP_EXTENSION{0x01};
+
     /// @brief The ChunkHeader version is used to detect incompatibilities for record&replay functionality
     /// @return the ChunkHeader version
     uint8_t chunkHeaderVersion() const noexcept;
@@ -112,7 +116,8 @@ struct ChunkHeader
     /// @return the const pointer to the 'ChunkHeader' or a 'nullptr' if 'userPayload' is a 'nullptr'
     static const ChunkHeader* fromUserHeader(const void* const userHeader) noexcept;
 
-    /// @brief Calculates the used size of the chunk with the ChunkHeader, user-heander and user-payload
+    /// @brief Calculates the used size of the chunk with the ChunkHeader, user-heander, user-payload and the send
+    /// timestamp if the chunk has one
     /// @return the used size of the chunk
     uint64_t usedSizeOfChunk() const noexcept;
 
@@ -140,6 +145,11 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief The time of the steady clock in nanoseconds when the chunk was sent; only available if the publisher has
+    /// 'PublisherOptions::stampSendTimestamp' enabled
+    /// @return the send timestamp of the chunk or '0' if the chunk has no send timestamp
+    SendTimestamp_t sendTimestamp() const noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
@@ -148,6 +158,11 @@ struct ChunkHeader
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    /// @note has no effect if the chunk has no send timestamp
+    void setSendTimestamp(const SendTimestamp_t sendTimestamp) noexcept;
+
+    uint64_t sendTimestampOffset() const noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -158,8 +173,10 @@ struct ChunkHeader
 
     uint32_t m_userHeaderSize{0U};
     uint8_t m_chunkHeaderVersion{CHUNK_HEADER_VERSION};
-    // reserved for future functionality and used to indicate the padding bytes; currently not used and set to '0'
-    uint8_t m_reserved{0};
+    // the flags of the optional extensions which are stored behind the user-payload; this was the reserved byte which
+    // was always set to '0', therefore the layout is unchanged and chunks without extensions are identical to the ones
+    // of the previous releases, which is why the m_chunkHeaderVersion was not incremented
+    uint8_t m_extensions{0};
     // currently just a placeholder
     uint16_t m_userHeaderId{NO_USER_HEADER};
     popo::UniquePortId m_originId{popo::InvalidPortId};
@@ -44,11 +44,13 @@ class ChunkSettings
     /// @param[in] userPayloadAlignment is the alignment of the user-payload
     /// @param[in] userHeaderSize is the size of the user-header
     /// @param[in] userHeaderAlignment is the alignment for the user-header
+    /// @param[in] hasSendTimestamp reserves space for the send timestamp behind the user-payload
     static expected<ChunkSettings, ChunkSettings::Error>
     create(const uint64_t userPayloadSize,
            const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
            const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
-           const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+           const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT,
+           const bool hasSendTimestamp = false) noexcept;
 
     /// @brief getter method for the chunk size fulfilling the user-payload and user-header requirements
     /// @return the chunk size
@@ -70,11 +72,16 @@ class ChunkSettings
     /// @return the user-header alignment
     uint32_t userHeaderAlignment() const noexcept;
 
+    /// @brief getter method for the send timestamp extension
+    /// @return true if space for the send timestamp is reserved behind the user-payload, otherwise false
+    bool hasSendTimestamp() const noexcept;
+
   private:
     ChunkSettings(const uint64_t userPayloadSize,
                   const uint32_t userPayloadAlignment,
                   const uint32_t userHeaderSize,
                   const uint32_t userHeaderAlignment,
+                  const bool hasSendTimestamp,
                   const uint64_t requiredChunkSize) noexcept;
 
     static expected<uint64_t, ChunkSettings::Error> calculateRequiredChunkSize(const uint64_t userPayloadSize,
@@ -86,6 +93,7 @@ class ChunkSettings
     uint32_t m_userPayloadAlignment{0U};
     uint32_t m_userHeaderSize{0U};
     uint32_t m_userHeaderAlignment{0U};
+    bool m_hasSendTimestamp{false};
     uint64_t m_requiredChunkSize{0U};
 };
 
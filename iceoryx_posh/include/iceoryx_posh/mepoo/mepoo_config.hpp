@@ -29,6 +29,16 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines the behavior of the MemoryManager when the best fitting mempool for a requested chunk is exhausted
+/// NO_FALLBACK - the request fails with MEMPOOL_OUT_OF_CHUNKS
+/// NEXT_LARGER_MEMPOOL - the chunk is taken from the next larger mempool with free chunks; this wastes some memory
+/// but turns a failed loan into a successful one
+enum class MemPoolFallbackPolicy : uint8_t
+{
+    NO_FALLBACK,
+    NEXT_LARGER_MEMPOOL
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +56,7 @@ struct MePooConfig
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::NO_FALLBACK};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -18,6 +18,7 @@
 
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/shared_memory_options.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iox/posix_group.hpp"
@@ -34,11 +35,13 @@ struct SegmentConfig
         SegmentEntry(const PosixGroup::groupName_t& readerGroup,
                      const PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const SharedMemoryOptions& sharedMemoryOptions = SharedMemoryOptions()) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_sharedMemoryOptions(sharedMemoryOptions)
 
         {
         }
@@ -47,10 +50,14 @@ struct SegmentConfig
         PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        SharedMemoryOptions m_sharedMemoryOptions;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
 
+    /// @brief The options for the management segment of RouDi
+    SharedMemoryOptions m_managementSharedMemoryOptions;
+
     /// @brief Set Function for default values to be added in SegmentConfig
     SegmentConfig& setDefaults() noexcept;
 
@@ -0,0 +1,45 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_SHARED_MEMORY_OPTIONS_HPP
+#define IOX_POSH_MEPOO_SHARED_MEMORY_OPTIONS_HPP
+
+#include "iox/posix_shared_memory_object.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Defines how RouDi backs and prepares the shared memory it creates. The defaults keep the memory pageable
+/// and write zeros into it with a single thread if the platform requires it.
+struct SharedMemoryOptions
+{
+    /// @brief Advise the kernel to back the shared memory with transparent huge pages to reduce the TLB misses
+    bool transparentHugePages{false};
+    /// @brief Lock the shared memory into RAM in RouDi so that it is prefaulted and never swapped out
+    bool lockMemory{false};
+    /// @brief The number of threads which write zeros into the shared memory on creation and thereby prefault it
+    uint32_t prefaultThreadCount{1U};
+    /// @brief Defines on which NUMA nodes the pages of the shared memory are placed
+    NumaPolicy numaPolicy{NumaPolicy::DEFAULT};
+    /// @brief The NUMA node the shared memory is bound to when the numaPolicy is NumaPolicy::BIND
+    uint32_t numaNode{0U};
+};
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_SHARED_MEMORY_OPTIONS_HPP
@@ -24,10 +24,14 @@
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/atomic.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
 #include "iox/expected.hpp"
 #include "iox/function.hpp"
+#include "iox/optional.hpp"
 #include "iox/smart_lock.hpp"
+#include "iox/unnamed_semaphore.hpp"
+#include "iox/vector.hpp"
 
 #include <thread>
 
@@ -104,10 +108,21 @@ enum class ListenerError
 ///
 ///            Best practice: Detach a specific event only from one specific thread and not
 ///                           from multiple contexts.
+/// @note  By default the callbacks are executed by the encapsulated thread one after another. When the Listener is
+///        created with callback workers, the encapsulated thread only dispatches the events and the callbacks are
+///        executed concurrently by a fixed-size pool of worker threads. The callback of one specific event is never
+///        executed concurrently with itself, but the callbacks of different events may be.
 class Listener
 {
   public:
     Listener() noexcept;
+
+    /// @brief Creates a Listener which executes the callbacks with a pool of worker threads
+    /// @param[in] numberOfCallbackWorkers the number of worker threads which execute the callbacks; with 0 the
+    ///            callbacks are executed by the thread which waits for the events; values larger than
+    ///            MAX_NUMBER_OF_CALLBACK_WORKERS_PER_LISTENER are clamped
+    explicit Listener(const uint32_t numberOfCallbackWorkers) noexcept;
+
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener() noexcept;
@@ -172,9 +187,23 @@ class Listener
     /// @return size of the Listener
     uint64_t size() const noexcept;
 
+    /// @brief Returns the number of worker threads which execute the callbacks
+    /// @return the number of callback workers; 0 if the callbacks are executed by the thread which waits for the events
+    uint32_t numberOfCallbackWorkers() const noexcept;
+
+    /// @brief Sets the time for which the Listener thread polls for events before it blocks. Polling avoids the
+    ///        wakeup latency of the blocking wait at the cost of a busy CPU core.
+    /// @note This method can be called from any thread concurrently; the new duration is used the next time the
+    ///       Listener thread waits for events.
+    /// @param[in] spinDuration the time to poll; zero, the default, disables polling
+    void setSpinDuration(const units::Duration spinDuration) noexcept;
+
+    /// @brief Returns the time for which the Listener thread polls for events before it blocks
+    units::Duration spinDuration() const noexcept;
+
   protected:
     friend class iox::posh::experimental::ListenerBuilder;
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const uint32_t numberOfCallbackWorkers = 0U) noexcept;
 
   private:
     class Event_t;
@@ -213,6 +242,36 @@ class Listener
         concurrent::Atomic<uint64_t> m_indicesInUse{0U};
     } m_indexManager;
 
+    class CallbackWorkers_t
+    {
+      public:
+        CallbackWorkers_t(Listener& listener, const uint32_t numberOfWorkers) noexcept;
+        CallbackWorkers_t(const CallbackWorkers_t&) = delete;
+        CallbackWorkers_t(CallbackWorkers_t&&) = delete;
+        ~CallbackWorkers_t() noexcept;
+
+        CallbackWorkers_t& operator=(const CallbackWorkers_t&) = delete;
+        CallbackWorkers_t& operator=(CallbackWorkers_t&&) = delete;
+
+        void schedule(const uint32_t index) noexcept;
+        uint32_t numberOfWorkers() const noexcept;
+
+      private:
+        void workerLoop() noexcept;
+        void execute(const uint32_t index) noexcept;
+
+        Listener& m_listener;
+        /// @note an event is only scheduled when it has no pending notifications, therefore every index is at most
+        ///       once in the queue
+        concurrent::MpmcLockFreeQueue<uint32_t, MAX_NUMBER_OF_EVENTS> m_scheduledEvents;
+        /// @note the worker which took an index from the queue owns the event as long as it has pending
+        ///       notifications; this serializes the callback executions of an event
+        concurrent::Atomic<uint64_t> m_pendingNotifications[MAX_NUMBER_OF_EVENTS];
+        optional<UnnamedSemaphore> m_wakeupSemaphore;
+        concurrent::Atomic<bool> m_keepRunning{true};
+        vector<std::thread, MAX_NUMBER_OF_CALLBACK_WORKERS_PER_LISTENER> m_workers;
+    };
+
 
     std::thread m_thread;
     concurrent::smart_lock<internal::Event_t, std::recursive_mutex> m_events[MAX_NUMBER_OF_EVENTS];
@@ -221,6 +280,7 @@ class Listener
     concurrent::Atomic<bool> m_wasDtorCalled{false};
     ConditionVariableData* m_conditionVariableData = nullptr;
     ConditionListener m_conditionListener;
+    optional<CallbackWorkers_t> m_callbackWorkers;
 };
 
 } // namespace popo
@@ -24,6 +24,7 @@
 #include "iox/detail/serialization.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -45,6 +46,27 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The number of chunks which are acquired at once from the mempool and cached for this publisher to reduce
+    /// the contention on the mempool when many publishers use it concurrently; '0' disables the cache
+    /// @note the value is limited to iox::MAX_CHUNKS_PER_MEMPOOL_CACHE; batches are kept for up to
+    /// iox::MAX_MEMPOOLS_PER_MEMPOOL_CACHE mempools, e.g. when the publisher alternates between payload sizes; at most
+    /// iox::MAX_NUMBER_OF_MEMPOOL_CACHES publishers have a cache at the same time, further publishers work without one
+    uint32_t chunkCacheSize{0U};
+
+    /// @brief The option whether the publisher stamps the send time behind the user-payload of every sample, which lets
+    /// the subscribers record the latency for the port introspection; every chunk grows by the size of the timestamp
+    bool stampSendTimestamp{false};
+
+    /// @brief The publisher loans its chunks from the writable segment which is bound to no particular NUMA node
+    static constexpr uint32_t NO_NUMA_NODE_PREFERENCE{std::numeric_limits<uint32_t>::max()};
+    /// @brief The publisher loans its chunks from the writable segment which is bound to the NUMA node of the thread
+    /// that creates the publisher
+    static constexpr uint32_t NUMA_NODE_OF_CALLING_THREAD{NO_NUMA_NODE_PREFERENCE - 1U};
+
+    /// @brief The NUMA node of the writable segment the publisher loans its chunks from. If the user of the process
+    /// has no writable segment bound to this node, the default writable segment is used
+    uint32_t preferredNumaNode{NO_NUMA_NODE_PREFERENCE};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -50,6 +50,16 @@ struct ServerOptions
     /// @note Corresponds with ClientOptions::responseQueueFullPolicy
     ConsumerTooSlowPolicy clientTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether multiple threads of the process may take requests and loan, send and release
+    /// responses concurrently, e.g. a pool of workers which process the requests. The access to the request and
+    /// response chunks is then serialized by a mutex, the processing of the requests runs in parallel.
+    /// @note The requests are handed out in the order of the request queue but the responses of the workers may
+    /// arrive in a different order at the client; the client can match them via the sequence id
+    /// @note With 'ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER' a worker which waits for a full client queue does not
+    /// block the other workers. The waiting workers share the wake-up of the server, therefore a worker might notice
+    /// the free space in the client queue only after the next wake-up or after a short timeout
+    bool concurrentRequestProcessing{false};
+
     /// @brief serialization of the ServerOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the ServerOptions
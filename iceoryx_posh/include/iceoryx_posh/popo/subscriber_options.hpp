@@ -52,6 +52,10 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The option whether the subscriber records the latency of the received chunks which carry a send
+    /// timestamp, see 'PublisherOptions::stampSendTimestamp', for the port introspection
+    bool recordLatency{false};
+
     /// @brief serialization of the SubscriberOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
@@ -206,6 +207,14 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Sets the time for which wait() and timedWait() poll for triggers before they block. Polling avoids the
+    ///        wakeup latency of the blocking wait at the cost of a busy CPU core.
+    /// @param[in] spinDuration the time to poll; zero, the default, disables polling
+    void setSpinDuration(const units::Duration spinDuration) noexcept;
+
+    /// @brief Returns the time for which wait() and timedWait() poll for triggers before they block
+    units::Duration spinDuration() const noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/shared_memory_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iox/vector.hpp"
@@ -43,6 +44,14 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
     uint64_t m_chunkPayloadSize{0};
+    uint64_t m_spilledChunks{0};
+    /// the following counters are accumulated since the creation of the mempool; the rates are obtained from the
+    /// difference of two samples divided by the difference of their 'm_timestampInNanoseconds'
+    uint64_t m_allocatedChunks{0};
+    uint64_t m_freedChunks{0};
+    uint64_t m_failedAllocations{0};
+    /// chunks acquired by the MemPoolCaches of the ports which are not included in 'm_usedChunks'
+    uint32_t m_cachedChunks{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -55,6 +64,11 @@ struct MemPoolIntrospectionInfo
     uint32_t m_id;
     GroupName_t m_writerGroupName;
     GroupName_t m_readerGroupName;
+    /// steady clock time at which the mempools of the segment were sampled
+    uint64_t m_timestampInNanoseconds{0};
+    /// NUMA placement of the segment; RouDi's own segment is always reported with the default policy
+    NumaPolicy m_numaPolicy{NumaPolicy::DEFAULT};
+    uint32_t m_numaNode{0};
     MemPoolInfoContainer m_mempoolInfo;
 };
 
@@ -104,6 +118,9 @@ struct PortThroughputData
     uint64_t m_chunkSize{0};
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
+    uint64_t m_numberOfSentChunks{0};
+    uint64_t m_numberOfSentBytes{0};
+    uint64_t m_numberOfLostChunks{0};
     bool m_isField{false};
 };
 
@@ -123,6 +140,12 @@ struct SubscriberPortChangingData
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    // latency percentiles of the chunks received since the last sample; only recorded for subscribers with
+    // 'SubscriberOptions::recordLatency' and chunks of publishers with 'PublisherOptions::stampSendTimestamp' enabled
+    uint64_t numberOfLatencySamples{0};
+    uint64_t latencyP50InNanoseconds{0};
+    uint64_t latencyP99InNanoseconds{0};
+    uint64_t latencyP999InNanoseconds{0};
 };
 
 struct SubscriberPortChangingIntrospectionFieldTopic
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/roudi/memory/memory_provider.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/shared_memory_options.hpp"
 #include "iox/expected.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/optional.hpp"
@@ -41,10 +42,12 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param[in] domainId to tie the shared memory to
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
+    /// @param [in] sharedMemoryOptions defines how the shared memory is backed and prepared
     PosixShmMemoryProvider(const ShmName_t& shmName,
                            const DomainId domainId,
                            const AccessMode accessMode,
-                           const OpenMode openMode) noexcept;
+                           const OpenMode openMode,
+                           const mepoo::SharedMemoryOptions& sharedMemoryOptions = {}) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -67,6 +70,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     const DomainId m_domainId;
     AccessMode m_accessMode{AccessMode::ReadOnly};
     OpenMode m_openMode{OpenMode::OpenExisting};
+    mepoo::SharedMemoryOptions m_sharedMemoryOptions;
     optional<PosixSharedMemoryObject> m_shmObject;
 
     static constexpr access_rights SHM_MEMORY_PERMISSIONS =
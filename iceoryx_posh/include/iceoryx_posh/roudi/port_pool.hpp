@@ -68,6 +68,10 @@ class PortPool
     PortPoolData::InterfaceContainer& getInterfacePortDataList() noexcept;
     PortPoolData::CondVarContainer& getConditionVariableDataList() noexcept;
 
+    /// @brief Returns the data with which the ports and condition variables notify RouDi about requests for the
+    ///        discovery
+    popo::DiscoveryNotifierData& getDiscoveryNotifierData() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -129,6 +133,17 @@ class PortPool
     expected<popo::ConditionVariableData*, PortPoolError>
     addConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Detaches a port from the discovery notifier; the port does not notify the discovery anymore
+    /// @param[in] portData of the port which is destroyed by the discovery itself
+    template <typename T>
+    void detachFromDiscoveryNotifier(T& portData) noexcept;
+
+    /// @brief Detaches all ports and condition variables from the discovery notifier; called by RouDi when the
+    ///        discovery has stopped
+    /// @note the notifier is accessed via a relative pointer which becomes invalid when another RouDi in the same
+    ///       process unregisters all segments, therefore the ports must not notify during the shutdown of RouDi
+    void detachAllFromDiscoveryNotifier() noexcept;
+
     /// @brief Removes a PublisherPortData from the internal pool
     /// @param[in] portData is a  pointer to the PublisherPortData to be removed
     /// @note after this call the provided PublisherPortData is no longer available for usage
@@ -159,6 +174,10 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+  private:
+    template <typename T>
+    void attachToDiscoveryNotifier(T& data, const uint64_t notificationIndex) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
 };
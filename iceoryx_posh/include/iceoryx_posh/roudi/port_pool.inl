@@ -42,6 +42,7 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         return nullptr;
     }
 
+    attachToDiscoveryNotifier(*port, PortPoolData::SUBSCRIBER_NOTIFICATION_OFFSET + port.to_index());
     return port.to_ptr();
 }
 
@@ -66,8 +67,23 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         return nullptr;
     }
 
+    attachToDiscoveryNotifier(*port, PortPoolData::SUBSCRIBER_NOTIFICATION_OFFSET + port.to_index());
     return port.to_ptr();
 }
+
+template <typename T>
+inline void PortPool::attachToDiscoveryNotifier(T& data, const uint64_t notificationIndex) noexcept
+{
+    data.m_discoveryNotifierDataPtr = &m_portPoolData->m_discoveryNotifierData;
+    data.m_discoveryNotificationIndex = notificationIndex;
+}
+
+template <typename T>
+inline void PortPool::detachFromDiscoveryNotifier(T& portData) noexcept
+{
+    portData.m_discoveryNotifierDataPtr = nullptr;
+}
+
 } // namespace roudi
 } // namespace iox
 
@@ -48,6 +48,10 @@ struct RouDiConfig
     /// @brief Sets the delay in seconds before RouDi sends SIGKILL to application which did not respond to the initial
     /// SIGTERM signal
     units::Duration processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    /// @brief The number of threads which process the messages of the runtimes; the messages of one runtime are always
+    /// processed by the same thread in the order they were received. With a single thread the messages are processed
+    /// directly by the thread which receives them
+    uint32_t runtimeMessageWorkerCount{roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS};
 
     // have some spare chunks to still deliver introspection data in case there are multiple subscribers to the data
     // which are caching different samples; could probably be reduced to 2 with the instruction to not cache the
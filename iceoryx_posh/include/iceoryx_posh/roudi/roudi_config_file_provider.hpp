@@ -35,6 +35,9 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// INVALID_MEMPOOL_FALLBACK_POLICY - the mempool fallback policy of the segment is unknown
+/// INVALID_PREFAULT_THREAD_COUNT - the number of prefault threads is zero or exceeds the maximum
+/// INVALID_NUMA_POLICY - the NUMA policy of the segment is unknown
 enum class RouDiConfigFileParseError
 {
     FILE_OPEN_FAILED,
@@ -46,6 +49,9 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    INVALID_MEMPOOL_FALLBACK_POLICY,
+    INVALID_PREFAULT_THREAD_COUNT,
+    INVALID_NUMA_POLICY,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +64,9 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "INVALID_MEMPOOL_FALLBACK_POLICY",
+                                                                 "INVALID_PREFAULT_THREAD_COUNT",
+                                                                 "INVALID_NUMA_POLICY",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
@@ -0,0 +1,132 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+#define IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/variant.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+class ProcessManager;
+} // namespace roudi
+
+namespace runtime
+{
+class PoshRuntimeImpl;
+
+/// @brief Describes a port which shall be created by PoshRuntime::createPorts together with other ports in a single
+/// batch. After the batch was processed, the request holds the created port or nullptr if the creation failed.
+/// @code
+///     PortRequest requests[] = {PortRequest::publisher({"Radar", "FrontLeft", "Object"}),
+///                               PortRequest::subscriber({"Radar", "FrontRight", "Object"}),
+///                               PortRequest::conditionVariable()};
+///     PoshRuntime::getInstance().createPorts(iox::span<PortRequest>(requests));
+///     auto* publisherPortData = requests[0].publisherPortData();
+/// @endcode
+class PortRequest
+{
+  public:
+    /// @brief request for a publisher port, see PoshRuntime::getMiddlewarePublisher
+    static PortRequest publisher(const capro::ServiceDescription& service,
+                                 const popo::PublisherOptions& publisherOptions = {},
+                                 const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief request for a subscriber port, see PoshRuntime::getMiddlewareSubscriber
+    static PortRequest subscriber(const capro::ServiceDescription& service,
+                                  const popo::SubscriberOptions& subscriberOptions = {},
+                                  const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief request for a client port, see PoshRuntime::getMiddlewareClient
+    static PortRequest client(const capro::ServiceDescription& service,
+                              const popo::ClientOptions& clientOptions = {},
+                              const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief request for a server port, see PoshRuntime::getMiddlewareServer
+    static PortRequest server(const capro::ServiceDescription& service,
+                              const popo::ServerOptions& serverOptions = {},
+                              const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief request for a condition variable, see PoshRuntime::getMiddlewareConditionVariable
+    static PortRequest conditionVariable() noexcept;
+
+    /// @brief returns the type of the request, e.g. IpcMessageType::CREATE_PUBLISHER
+    IpcMessageType type() const noexcept;
+
+    /// @brief returns the created publisher port or nullptr if the creation failed or it is no publisher request
+    PublisherPortUserType::MemberType_t* publisherPortData() const noexcept;
+
+    /// @brief returns the created subscriber port or nullptr if the creation failed or it is no subscriber request
+    SubscriberPortUserType::MemberType_t* subscriberPortData() const noexcept;
+
+    /// @brief returns the created client port or nullptr if the creation failed or it is no client request
+    popo::ClientPortData* clientPortData() const noexcept;
+
+    /// @brief returns the created server port or nullptr if the creation failed or it is no server request
+    popo::ServerPortData* serverPortData() const noexcept;
+
+    /// @brief returns the created condition variable or nullptr if the creation failed or it is no condition
+    /// variable request
+    popo::ConditionVariableData* conditionVariableData() const noexcept;
+
+  private:
+    friend class PoshRuntimeImpl;
+    friend class roudi::ProcessManager;
+
+    struct ConditionVariableOptions
+    {
+    };
+
+    using Options_t = variant<popo::PublisherOptions,
+                              popo::SubscriberOptions,
+                              popo::ClientOptions,
+                              popo::ServerOptions,
+                              ConditionVariableOptions>;
+
+    PortRequest(const IpcMessageType type,
+                const capro::ServiceDescription& service,
+                Options_t&& options,
+                const PortConfigInfo& portConfigInfo) noexcept;
+
+    void* portDataIf(const IpcMessageType type) const noexcept;
+
+  private:
+    IpcMessageType m_type;
+    capro::ServiceDescription m_service;
+    Options_t m_options;
+    PortConfigInfo m_portConfigInfo;
+    void* m_portData{nullptr};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_REQUEST_HPP
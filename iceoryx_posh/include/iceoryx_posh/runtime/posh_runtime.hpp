@@ -30,9 +30,11 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
 #include "iox/atomic.hpp"
 #include "iox/optional.hpp"
 #include "iox/scope_guard.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -142,6 +144,12 @@ class PoshRuntime
     /// @return pointer to a created condition variable data
     virtual popo::ConditionVariableData* getMiddlewareConditionVariable() noexcept = 0;
 
+    /// @brief request the RouDi daemon to create multiple publisher, subscriber, client, server ports and condition
+    /// variables at once; up to MAX_PORT_REQUESTS_PER_MESSAGE ports are created with a single request to RouDi
+    /// @param[in,out] requests describe the ports to create and hold the created ports after the call returned
+    /// @return the number of successfully created ports
+    virtual uint64_t createPorts(const span<PortRequest> requests) noexcept = 0;
+
     /// @brief send a request to the RouDi daemon and get the response
     ///        currently each request is followed by a response
     /// @param[in] msg request message to send
@@ -83,7 +83,21 @@ class ServiceDiscovery
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
-    void update();
+    popo::Subscriber<roudi::ServiceRegistryChange> m_serviceRegistryChangesSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+        {SERVICE_REGISTRY_CHANGES_QUEUE_CAPACITY, 0U, iox::NodeName_t("Service Registry"), true}};
+
+    /// @brief Catches up with the changes of the service registry
+    /// @return true if the local registry is in sync with the one of RouDi, false if a change was missed and the
+    /// complete registry was not received yet
+    bool update();
+    void updateFromServiceRegistry();
+    bool applyServiceRegistryChanges();
+
+    /// @brief set when a gap in the sequence numbers of the changes is detected; the changes are not applied until
+    /// the complete registry with at least m_resyncSequenceNumber is received
+    bool m_isOutOfSync{false};
+    uint64_t m_resyncSequenceNumber{0U};
 };
 
 } // namespace runtime
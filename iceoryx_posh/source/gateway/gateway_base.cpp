@@ -30,8 +30,10 @@ GatewayBase::GatewayBase(const capro::Interfaces f_interface) noexcept
 
 GatewayBase::~GatewayBase() noexcept
 {
+    m_trigger.reset();
     if (m_interfaceImpl)
     {
+        m_interfaceImpl.unsetConditionVariable();
         m_interfaceImpl.destroy();
     }
 }
@@ -55,5 +57,52 @@ bool GatewayBase::getCaProMessage(CaproMessage& msg) noexcept
         return false;
     }
 }
+
+bool GatewayBase::hasCaProMessage() const noexcept
+{
+    return m_interfaceImpl.hasCaProMessage();
+}
+
+void GatewayBase::enableState(popo::TriggerHandle&& triggerHandle, const GatewayState gatewayState) noexcept
+{
+    switch (gatewayState)
+    {
+    case GatewayState::HAS_CAPRO_MESSAGE:
+        m_trigger = std::move(triggerHandle);
+        m_interfaceImpl.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+popo::WaitSetIsConditionSatisfiedCallback
+GatewayBase::getCallbackForIsStateConditionSatisfied(const GatewayState gatewayState) const noexcept
+{
+    switch (gatewayState)
+    {
+    case GatewayState::HAS_CAPRO_MESSAGE:
+        return popo::WaitSetIsConditionSatisfiedCallback(in_place, *this, &GatewayBase::hasCaProMessage);
+    }
+    return nullopt;
+}
+
+void GatewayBase::disableState(const GatewayState gatewayState) noexcept
+{
+    switch (gatewayState)
+    {
+    case GatewayState::HAS_CAPRO_MESSAGE:
+        m_trigger.reset();
+        m_interfaceImpl.unsetConditionVariable();
+        break;
+    }
+}
+
+void GatewayBase::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (m_trigger.getUniqueId() == uniqueTriggerId)
+    {
+        m_interfaceImpl.unsetConditionVariable();
+        m_trigger.invalidate();
+    }
+}
 } // namespace gw
 } // namespace iox
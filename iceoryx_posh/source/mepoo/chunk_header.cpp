@@ -24,9 +24,11 @@ namespace iox
 namespace mepoo
 {
 constexpr uint8_t ChunkHeader::CHUNK_HEADER_VERSION;
+constexpr uint8_t ChunkHeader::SEND_TIMESTAMP_EXTENSION;
 
 ChunkHeader::ChunkHeader(const uint64_t chunkSize, const ChunkSettings& chunkSettings) noexcept
     : m_userHeaderSize(chunkSettings.userHeaderSize())
+    , m_extensions(chunkSettings.hasSendTimestamp() ? SEND_TIMESTAMP_EXTENSION : 0U)
     , m_chunkSize(chunkSize)
     , m_userPayloadSize(chunkSettings.userPayloadSize())
     , m_userPayloadAlignment(chunkSettings.userPayloadAlignment())
@@ -105,6 +107,8 @@ ChunkHeader::ChunkHeader(const uint64_t chunkSize, const ChunkSettings& chunkSet
     }
 
     IOX_ENFORCE(overflowSafeUsedSizeOfChunk() <= chunkSize, "Used size of chunk would exceed the actual chunk size!");
+
+    setSendTimestamp(0U);
 }
 
 uint8_t ChunkHeader::chunkHeaderVersion() const noexcept
@@ -221,8 +225,36 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+ChunkHeader::SendTimestamp_t ChunkHeader::sendTimestamp() const noexcept
+{
+    if ((m_extensions & SEND_TIMESTAMP_EXTENSION) == 0U)
+    {
+        return 0U;
+    }
+    return *reinterpret_cast<const SendTimestamp_t*>(reinterpret_cast<uint64_t>(this) + sendTimestampOffset());
+}
+
+void ChunkHeader::setSendTimestamp(const SendTimestamp_t sendTimestamp) noexcept
+{
+    if ((m_extensions & SEND_TIMESTAMP_EXTENSION) != 0U)
+    {
+        *reinterpret_cast<SendTimestamp_t*>(reinterpret_cast<uint64_t>(this) + sendTimestampOffset()) = sendTimestamp;
+    }
+}
+
+uint64_t ChunkHeader::sendTimestampOffset() const noexcept
+{
+    // the send timestamp is always located behind the user-payload
+    return iox::align(static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize),
+                      static_cast<uint64_t>(alignof(SendTimestamp_t)));
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
+    if ((m_extensions & SEND_TIMESTAMP_EXTENSION) != 0U)
+    {
+        return sendTimestampOffset() + sizeof(SendTimestamp_t);
+    }
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
 }
 
@@ -28,11 +28,13 @@ ChunkSettings::ChunkSettings(const uint64_t userPayloadSize,
                              const uint32_t userPayloadAlignment,
                              const uint32_t userHeaderSize,
                              const uint32_t userHeaderAlignment,
+                             const bool hasSendTimestamp,
                              const uint64_t requiredChunkSize) noexcept
     : m_userPayloadSize(userPayloadSize)
     , m_userPayloadAlignment(userPayloadAlignment)
     , m_userHeaderSize(userHeaderSize)
     , m_userHeaderAlignment(userHeaderAlignment)
+    , m_hasSendTimestamp(hasSendTimestamp)
     , m_requiredChunkSize(requiredChunkSize)
 {
 }
@@ -40,7 +42,8 @@ ChunkSettings::ChunkSettings(const uint64_t userPayloadSize,
 expected<ChunkSettings, ChunkSettings::Error> ChunkSettings::create(const uint64_t userPayloadSize,
                                                                     const uint32_t userPayloadAlignment,
                                                                     const uint32_t userHeaderSize,
-                                                                    const uint32_t userHeaderAlignment) noexcept
+                                                                    const uint32_t userHeaderAlignment,
+                                                                    const bool hasSendTimestamp) noexcept
 {
     // since alignas accepts 0, we also do but we adjust it to 1 in case there are some division or modulo operations
     // with the alignment later on
@@ -71,9 +74,24 @@ expected<ChunkSettings, ChunkSettings::Error> ChunkSettings::create(const uint64
     }
     uint64_t requiredChunkSize = expectChunkSize.value();
 
+    if (hasSendTimestamp)
+    {
+        // the send timestamp is stored behind the user-payload, have a look at »Send Timestamp« in chunk_header.md
+        constexpr uint64_t SEND_TIMESTAMP_SIZE{sizeof(ChunkHeader::SendTimestamp_t)};
+        constexpr uint64_t SEND_TIMESTAMP_ALIGNMENT{alignof(ChunkHeader::SendTimestamp_t)};
+        if (requiredChunkSize > std::numeric_limits<uint64_t>::max() - SEND_TIMESTAMP_ALIGNMENT - SEND_TIMESTAMP_SIZE)
+        {
+            return err(ChunkSettings::Error::REQUIRED_CHUNK_SIZE_EXCEEDS_MAX_CHUNK_SIZE);
+        }
+        requiredChunkSize = align(requiredChunkSize, SEND_TIMESTAMP_ALIGNMENT) + SEND_TIMESTAMP_SIZE;
+    }
 
-    return ok(ChunkSettings{
-        userPayloadSize, adjustedUserPayloadAlignment, userHeaderSize, adjustedUserHeaderAlignment, requiredChunkSize});
+    return ok(ChunkSettings{userPayloadSize,
+                            adjustedUserPayloadAlignment,
+                            userHeaderSize,
+                            adjustedUserHeaderAlignment,
+                            hasSendTimestamp,
+                            requiredChunkSize});
 }
 
 expected<uint64_t, ChunkSettings::Error> ChunkSettings::calculateRequiredChunkSize(
@@ -152,5 +170,10 @@ uint32_t ChunkSettings::userHeaderAlignment() const noexcept
     return m_userHeaderAlignment;
 }
 
+bool ChunkSettings::hasSendTimestamp() const noexcept
+{
+    return m_hasSendTimestamp;
+}
+
 } // namespace mepoo
 } // namespace iox
@@ -30,15 +30,26 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint64_t chunkSize) noexcept
+                         const uint64_t chunkSize,
+                         const uint32_t cachedChunks,
+                         const uint64_t spilledChunks,
+                         const uint32_t allocatedChunks,
+                         const uint64_t failedAllocations) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_cachedChunks(cachedChunks)
+    , m_spilledChunks(spilledChunks)
+    , m_allocatedChunks(allocatedChunks)
+    , m_failedAllocations(failedAllocations)
 {
 }
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
+constexpr uint64_t MemPool::USED_CHUNKS_MASK;
+constexpr uint64_t MemPool::ALLOCATION_SHIFT;
+constexpr uint64_t MemPool::ALLOCATED_AND_USED_CHUNK;
 
 MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const greater_or_equal<uint32_t, 1> numberOfChunks,
@@ -76,11 +87,30 @@ bool MemPool::isMultipleOfAlignment(const uint64_t value) const noexcept
     return (value % CHUNK_MEMORY_ALIGNMENT == 0U);
 }
 
-void MemPool::adjustMinFree() noexcept
+uint32_t MemPool::usedChunksOf(const uint64_t chunkCounters) noexcept
 {
-    // @todo iox-#1714 rethink the concurrent change that can happen. do we need a CAS loop?
-    m_minFree.store(std::min(m_numberOfChunks - m_usedChunks.load(std::memory_order_relaxed),
-                             m_minFree.load(std::memory_order_relaxed)));
+    return static_cast<uint32_t>(chunkCounters & USED_CHUNKS_MASK);
+}
+
+uint32_t MemPool::allocationsOf(const uint64_t chunkCounters) noexcept
+{
+    return static_cast<uint32_t>(chunkCounters >> ALLOCATION_SHIFT);
+}
+
+void MemPool::adjustMinFree(const uint32_t usedChunks) noexcept
+{
+    // the number of used chunks is the one right after the own acquisition and not a reload of the counters; a
+    // concurrent acquisition therefore cannot be missed and the CAS loop ensures that a concurrent adjustment with a
+    // smaller value is not overwritten
+    const auto freeChunks = m_numberOfChunks - usedChunks;
+    auto minFree = m_minFree.load(std::memory_order_relaxed);
+    while (freeChunks < minFree)
+    {
+        if (m_minFree.compare_exchange_weak(minFree, freeChunks, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
 }
 
 void* MemPool::getChunk() noexcept
@@ -90,14 +120,12 @@ void* MemPool::getChunk() noexcept
     {
         IOX_LOG(Warn,
                 "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                                          << ", used_chunks = " << m_usedChunks.load() << " ] has no more space left");
+                                          << ", used_chunks = " << usedChunksOf(m_chunkCounters.load())
+                                          << " ] has no more space left");
         return nullptr;
     }
 
-    /// @todo iox-#1714 verify that m_usedChunk is not changed during adjustMInFree
-    ///         without changing m_minFree
-    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
-    adjustMinFree();
+    adjustMinFree(usedChunksOf(m_chunkCounters.fetch_add(ALLOCATED_AND_USED_CHUNK, std::memory_order_relaxed)) + 1U);
 
     return indexToPointer(index, m_chunkSize, m_rawMemory.get());
 }
@@ -154,7 +182,58 @@ void MemPool::freeChunk(const void* chunk) noexcept
         IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
     }
 
-    m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+    m_chunkCounters.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getChunksForCache(not_null<freeList_t::Index_t*> chunkIndices, const uint32_t numberOfChunks) noexcept
+{
+    const auto numberOfAcquiredChunks = m_freeIndices.popBatch(chunkIndices, numberOfChunks);
+    if (numberOfAcquiredChunks == 0U)
+    {
+        return 0U;
+    }
+
+    // the used chunks and the allocations are increased before and decreased after the cached chunks, this keeps the
+    // cached chunks a subset of both for every single update; the whole batch is counted as allocated at once to keep
+    // the handing out of a cached chunk free of an update of the shared counters
+    const auto chunkCounters = m_chunkCounters.fetch_add(numberOfAcquiredChunks * ALLOCATED_AND_USED_CHUNK,
+                                                         std::memory_order_relaxed);
+    adjustMinFree(usedChunksOf(chunkCounters) + numberOfAcquiredChunks);
+    m_cachedChunks.fetch_add(numberOfAcquiredChunks, std::memory_order_relaxed);
+
+    return numberOfAcquiredChunks;
+}
+
+void MemPool::freeChunksFromCache(not_null<const freeList_t::Index_t*> chunkIndices,
+                                  const uint32_t numberOfChunks) noexcept
+{
+    if (numberOfChunks == 0U)
+    {
+        return;
+    }
+
+    if (!m_freeIndices.pushBatch(chunkIndices, numberOfChunks))
+    {
+        IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    // the returned chunks were never handed out and are therefore also removed from the allocations
+    m_cachedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+    m_chunkCounters.fetch_sub(numberOfChunks * ALLOCATED_AND_USED_CHUNK, std::memory_order_relaxed);
+}
+
+void MemPool::markCachedChunksAsUsed(const uint32_t numberOfChunks) noexcept
+{
+    if (numberOfChunks > 0U)
+    {
+        m_cachedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+    }
+}
+
+void* MemPool::getChunkFromIndex(const freeList_t::Index_t index) const noexcept
+{
+    IOX_ENFORCE(index < m_numberOfChunks, "The chunk index must be smaller than the number of chunks");
+    return indexToPointer(index, m_chunkSize, m_rawMemory.get());
 }
 
 uint64_t MemPool::getChunkSize() const noexcept
@@ -169,7 +248,37 @@ uint32_t MemPool::getChunkCount() const noexcept
 
 uint32_t MemPool::getUsedChunks() const noexcept
 {
-    return m_usedChunks.load(std::memory_order_relaxed);
+    return getInfo().m_usedChunks;
+}
+
+uint32_t MemPool::getCachedChunks() const noexcept
+{
+    return m_cachedChunks.load(std::memory_order_relaxed);
+}
+
+uint64_t MemPool::getSpilledChunks() const noexcept
+{
+    return m_spilledChunks.load(std::memory_order_relaxed);
+}
+
+void MemPool::increaseSpilledChunks() noexcept
+{
+    m_spilledChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getAllocatedChunks() const noexcept
+{
+    return getInfo().m_allocatedChunks;
+}
+
+uint64_t MemPool::getFailedAllocations() const noexcept
+{
+    return m_failedAllocations.load(std::memory_order_relaxed);
+}
+
+void MemPool::increaseFailedAllocations() noexcept
+{
+    m_failedAllocations.fetch_add(1U, std::memory_order_relaxed);
 }
 
 uint32_t MemPool::getMinFree() const noexcept
@@ -179,10 +288,23 @@ uint32_t MemPool::getMinFree() const noexcept
 
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
+    // the cached chunks are not yet handed out and therefore neither counted as used nor as allocated; the cached
+    // chunks are read separately, therefore a concurrent return of cached chunks can be observed between the two reads
+    // but the used and the allocated chunks are always consistent with each other
+    const auto cachedChunks = m_cachedChunks.load(std::memory_order_relaxed);
+    const auto chunkCounters = m_chunkCounters.load(std::memory_order_relaxed);
+    const auto usedChunks = usedChunksOf(chunkCounters);
+    const auto usedChunksWithoutCache = (usedChunks > cachedChunks) ? usedChunks - cachedChunks : 0U;
+    const auto allocatedChunksWithoutCache = allocationsOf(chunkCounters) - (usedChunks - usedChunksWithoutCache);
+
+    return {usedChunksWithoutCache,
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            cachedChunks,
+            getSpilledChunks(),
+            allocatedChunksWithoutCache,
+            getFailedAllocations()};
 }
 
 } // namespace mepoo
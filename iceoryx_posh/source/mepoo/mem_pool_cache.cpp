@@ -0,0 +1,148 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool_cache.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t MemPoolCache::CAPACITY;
+constexpr uint32_t MemPoolCache::NUMBER_OF_SLOTS;
+
+MemPoolCache::MemPoolCache(const uint32_t batchSize) noexcept
+    : m_batchSize(std::min(batchSize, CAPACITY))
+{
+}
+
+bool MemPoolCache::isEnabled() const noexcept
+{
+    return m_batchSize > 0U;
+}
+
+uint32_t MemPoolCache::size() const noexcept
+{
+    uint32_t size{0U};
+    for (const auto& slot : m_slots)
+    {
+        size += slot.m_size;
+    }
+    return size;
+}
+
+optional<CachedChunk> MemPoolCache::tryGet(MemPool& memPool, MemPool& chunkManagementPool) noexcept
+{
+    if (!isEnabled())
+    {
+        return nullopt;
+    }
+
+    auto& slot = acquireSlot(memPool, chunkManagementPool);
+    slot.m_lastUse = ++m_useCounter;
+
+    if (slot.m_size == 0U && !refill(slot))
+    {
+        return nullopt;
+    }
+
+    --slot.m_size;
+    // the chunk is accounted as used as soon as it is handed out, otherwise the introspection would report it as
+    // cached while it is held by the user
+    memPool.markCachedChunksAsUsed(1U);
+    chunkManagementPool.markCachedChunksAsUsed(1U);
+
+    return CachedChunk{memPool.getChunkFromIndex(slot.m_chunkIndices[slot.m_size]),
+                       chunkManagementPool.getChunkFromIndex(slot.m_chunkManagementIndices[slot.m_size])};
+}
+
+MemPoolCache::Slot& MemPoolCache::acquireSlot(MemPool& memPool, MemPool& chunkManagementPool) noexcept
+{
+    Slot* leastRecentlyUsedSlot = &m_slots[0];
+    for (auto& slot : m_slots)
+    {
+        if (slot.m_memPool.get() == &memPool && slot.m_chunkManagementPool.get() == &chunkManagementPool)
+        {
+            return slot;
+        }
+        if (slot.m_lastUse < leastRecentlyUsedSlot->m_lastUse)
+        {
+            leastRecentlyUsedSlot = &slot;
+        }
+    }
+
+    // unused slots have never been used and are therefore preferred
+    release(*leastRecentlyUsedSlot);
+    leastRecentlyUsedSlot->m_memPool = &memPool;
+    leastRecentlyUsedSlot->m_chunkManagementPool = &chunkManagementPool;
+    return *leastRecentlyUsedSlot;
+}
+
+bool MemPoolCache::refill(Slot& slot) noexcept
+{
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    auto numberOfChunks = slot.m_memPool->getChunksForCache(&slot.m_chunkIndices[0], m_batchSize);
+    if (numberOfChunks == 0U)
+    {
+        return false;
+    }
+
+    // there are always at least as many chunk management chunks available as payload chunks, but other threads
+    // might have taken some in the meantime; return the payload chunks without a chunk management
+    const auto numberOfChunkManagements =
+        slot.m_chunkManagementPool->getChunksForCache(&slot.m_chunkManagementIndices[0], numberOfChunks);
+    if (numberOfChunkManagements < numberOfChunks)
+    {
+        slot.m_memPool->freeChunksFromCache(&slot.m_chunkIndices[numberOfChunkManagements],
+                                            numberOfChunks - numberOfChunkManagements);
+        numberOfChunks = numberOfChunkManagements;
+    }
+
+    slot.m_size = numberOfChunks;
+    // END of critical section
+
+    return slot.m_size > 0U;
+}
+
+void MemPoolCache::release() noexcept
+{
+    for (auto& slot : m_slots)
+    {
+        release(slot);
+    }
+}
+
+void MemPoolCache::release(Slot& slot) noexcept
+{
+    if (!slot.m_memPool)
+    {
+        return;
+    }
+
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    const auto numberOfChunks = slot.m_size;
+    slot.m_size = 0U;
+
+    // the chunk management must be freed before the chunk itself to maintain the invariant that there are always
+    // at least as many chunk management chunks available as payload chunks
+    slot.m_chunkManagementPool->freeChunksFromCache(&slot.m_chunkManagementIndices[0], numberOfChunks);
+    slot.m_memPool->freeChunksFromCache(&slot.m_chunkIndices[0], numberOfChunks);
+    // END of critical section
+}
+
+} // namespace mepoo
+} // namespace iox
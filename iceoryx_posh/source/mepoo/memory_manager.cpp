@@ -142,25 +142,109 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
     }
 
     generateChunkManagementPool(managementAllocator);
+    generateSizeClassIndex();
+    m_fallbackPolicy = mePooConfig.m_fallbackPolicy;
+}
+
+uint32_t MemoryManager::sizeClassOf(const uint64_t chunkSize) noexcept
+{
+    if (chunkSize <= 1U)
+    {
+        return 0U;
+    }
+
+    // the size class is the number of significant bits of 'chunkSize - 1'; this is determined by a binary search
+    // in order to have a constant number of steps
+    uint64_t value = chunkSize - 1U;
+    uint32_t sizeClass{1U};
+    for (uint32_t shift = 32U; shift > 0U; shift /= 2U)
+    {
+        if ((value >> shift) != 0U)
+        {
+            value >>= shift;
+            sizeClass += shift;
+        }
+    }
+    return sizeClass;
+}
+
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        // the smallest chunk size of the size class; all smaller mempools can be skipped
+        const uint64_t smallestChunkSize = (sizeClass == 0U) ? 0U : (1ULL << (sizeClass - 1U)) + 1U;
+        while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < smallestChunkSize)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassIndex[sizeClass] = memPoolIndex;
+    }
+}
+
+uint32_t MemoryManager::bestFittingMemPoolIndex(const uint64_t requiredChunkSize) const noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    auto memPoolIndex = m_sizeClassIndex[sizeClassOf(requiredChunkSize)];
+    // only the mempools of the same size class need to be checked
+    while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    return memPoolIndex;
 }
 
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    return getChunkImpl(chunkSettings, nullptr);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                    MemPoolCache& cache) noexcept
+{
+    return getChunkImpl(chunkSettings, &cache);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunkImpl(const ChunkSettings& chunkSettings,
+                                                                        MemPoolCache* const cache) noexcept
 {
     void* chunk{nullptr};
+    void* chunkManagementMemory{nullptr};
     MemPool* memPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
-    uint64_t aquiredChunkSize = 0U;
-
-    for (auto& memPool : m_memPoolVector)
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    const auto memPoolIndex = bestFittingMemPoolIndex(requiredChunkSize);
+    if (memPoolIndex < numberOfMemPools)
     {
-        uint64_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        auto& memPool = m_memPoolVector[memPoolIndex];
+        if (cache != nullptr && cache->isEnabled())
+        {
+            cache->tryGet(memPool, m_chunkManagementPool.front()).and_then([&](const auto& cachedChunk) {
+                chunk = cachedChunk.chunk;
+                chunkManagementMemory = cachedChunk.chunkManagement;
+            });
+        }
+        else
         {
             chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+        }
+        memPoolPointer = &memPool;
+
+        if (chunk == nullptr && m_fallbackPolicy == MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL)
+        {
+            // the cache is bypassed for the larger mempools since it would otherwise be retargeted on each spill
+            for (auto spillIndex = memPoolIndex + 1U; spillIndex < numberOfMemPools && chunk == nullptr; ++spillIndex)
+            {
+                chunk = m_memPoolVector[spillIndex].getChunk();
+                if (chunk != nullptr)
+                {
+                    memPool.increaseSpilledChunks();
+                    memPoolPointer = &m_memPoolVector[spillIndex];
+                }
+            }
         }
     }
 
@@ -186,6 +270,8 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     }
     else if (chunk == nullptr)
     {
+        memPoolPointer->increaseFailedAllocations();
+
         IOX_LOG(
             Error,
             "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
@@ -200,8 +286,12 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     }
     else
     {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
+        if (chunkManagementMemory == nullptr)
+        {
+            chunkManagementMemory = m_chunkManagementPool.front().getChunk();
+        }
+        auto chunkHeader = new (chunk) ChunkHeader(memPoolPointer->getChunkSize(), chunkSettings);
+        auto chunkManagement = new (chunkManagementMemory)
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
         return ok(SharedChunk(chunkManagement));
     }
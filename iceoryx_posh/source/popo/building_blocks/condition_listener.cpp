@@ -18,6 +18,9 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 namespace iox
 {
 namespace popo
@@ -55,9 +58,25 @@ bool ConditionListener::wasNotified() const noexcept
     return getMembers()->m_wasNotified.load(std::memory_order_relaxed);
 }
 
+void ConditionListener::setSpinDuration(const units::Duration& spinDuration) noexcept
+{
+    m_spinDurationInNanoseconds.store(spinDuration.toNanoseconds(), std::memory_order_relaxed);
+    getMembers()->m_isSpinEnabled.store(spinDuration != units::Duration::zero(), std::memory_order_relaxed);
+}
+
+units::Duration ConditionListener::spinDuration() const noexcept
+{
+    return units::Duration::fromNanoseconds(m_spinDurationInNanoseconds.load(std::memory_order_relaxed));
+}
+
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
     return waitImpl([this]() -> bool {
+        if (this->spinUntilNotified(this->spinDuration()))
+        {
+            return true;
+        }
+
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
@@ -70,7 +89,13 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
     return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+        const auto spinDuration = std::min(this->spinDuration(), timeToWait);
+        if (this->spinUntilNotified(spinDuration))
+        {
+            return true;
+        }
+
+        if (this->getMembers()->m_semaphore->timedWait(timeToWait - spinDuration).has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
         }
@@ -80,21 +105,13 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
 
 ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
 {
-    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        collectActiveNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
@@ -106,10 +123,85 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+bool ConditionListener::hasActiveNotifications() const noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    for (const auto& notifications : getMembers()->m_activeNotifications)
+    {
+        if (notifications.load(std::memory_order_relaxed) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ConditionListener::spinUntilNotified(const units::Duration& spinDuration) noexcept
+{
+    if (spinDuration == units::Duration::zero())
+    {
+        return false;
+    }
+
+    const auto spinDurationInNanoseconds = spinDuration.toNanoseconds();
+    const auto start = std::chrono::steady_clock::now();
+    // a notifier which does not observe the spinning listener yet posts the semaphore, which is harmless since the
+    // semaphore is reset on the next wait
+    getMembers()->m_listenerIsSpinning.store(true, std::memory_order_relaxed);
+
+    bool wasNotified{false};
+    while (!m_toBeDestroyed.load(std::memory_order_relaxed))
+    {
+        if (hasActiveNotifications())
+        {
+            wasNotified = true;
+            break;
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        if (static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())
+            >= spinDurationInNanoseconds)
+        {
+            break;
+        }
+    }
+
+    getMembers()->m_listenerIsSpinning.store(false, std::memory_order_relaxed);
+    // pairs with the fence of the notifier; a notifier which still observed the spinning listener skipped the
+    // semaphore post, therefore its notification must be visible here
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    return wasNotified || hasActiveNotifications() || m_toBeDestroyed.load(std::memory_order_relaxed);
+}
+
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
+{
+    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+    constexpr uint64_t BITS_PER_WORD{ConditionVariableData::BITS_PER_NOTIFICATION_WORD};
+
+    for (uint64_t word = 0U; word < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++word)
+    {
+        auto& notifications = getMembers()->m_activeNotifications[word];
+        // avoid the read-modify-write in the common case of a word without notifications
+        if (notifications.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        // the acquire pairs with the release of the notifier; the words are visited in ascending order and the bits
+        // from the least significant one, therefore the notification vector stays sorted
+        uint64_t activeBits{notifications.exchange(0U, std::memory_order_acquire)};
+        while (activeBits != 0U)
+        {
+            const uint64_t bit{countTrailingZeros(activeBits)};
+            activeNotifications.emplace_back(static_cast<Type_t>(word * BITS_PER_WORD + bit));
+            activeBits &= activeBits - 1U;
+        }
+    }
+
+    if (!activeNotifications.empty())
+    {
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    }
 }
 
 const ConditionVariableData* ConditionListener::getMembers() volatile const noexcept
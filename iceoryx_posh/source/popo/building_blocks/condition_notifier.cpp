@@ -38,8 +38,24 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    const auto word = m_notificationIndex / ConditionVariableData::BITS_PER_NOTIFICATION_WORD;
+    const auto bit = m_notificationIndex % ConditionVariableData::BITS_PER_NOTIFICATION_WORD;
+    getMembers()->m_activeNotifications[word].fetch_or(1ULL << bit, std::memory_order_release);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+
+    // an outdated value only leads to a semaphore post which is not required, which is harmless since the semaphore
+    // is reset on the next wait; the fence is therefore only paid when the listener spins at all
+    if (getMembers()->m_isSpinEnabled.load(std::memory_order_relaxed))
+    {
+        // pairs with the fence of the listener when it stops spinning; either the listener sees the notification or
+        // the notifier sees that the listener does not spin anymore and posts the semaphore
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (getMembers()->m_listenerIsSpinning.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
     getMembers()->m_semaphore->post().or_else(
         [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
 }
@@ -36,9 +36,9 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         .create(m_semaphore)
         .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE); });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
 } // namespace popo
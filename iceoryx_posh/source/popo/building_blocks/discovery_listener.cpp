@@ -0,0 +1,106 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_listener.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
+
+namespace iox
+{
+namespace popo
+{
+DiscoveryListener::DiscoveryListener(DiscoveryNotifierData& discoveryNotifierDataRef) noexcept
+    : m_discoveryNotifierDataPtr(&discoveryNotifierDataRef)
+{
+}
+
+bool DiscoveryListener::timedWait(const units::Duration& timeToWait) noexcept
+{
+    bool wasWokenUp{false};
+    m_discoveryNotifierDataPtr->m_semaphore->timedWait(timeToWait)
+        .and_then([&](auto waitState) { wasWokenUp = (waitState == SemaphoreWaitState::NO_TIMEOUT); })
+        .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__DISCOVERY_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT); });
+
+    // every notification posts the semaphore; the bits of all notifications which happened up to now are already set
+    // and are collected in one go, therefore the remaining posts would only cause spurious wake-ups
+    if (wasWokenUp)
+    {
+        resetSemaphore();
+    }
+    return wasWokenUp;
+}
+
+void DiscoveryListener::wakeUp() noexcept
+{
+    m_discoveryNotifierDataPtr->m_semaphore->post().or_else(
+        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__DISCOVERY_LISTENER_SEMAPHORE_CORRUPTED_IN_WAKE_UP); });
+}
+
+void DiscoveryListener::forEachNotification(const uint64_t begin,
+                                            const uint64_t count,
+                                            const function_ref<void(const uint64_t)> callback) noexcept
+{
+    constexpr uint64_t BITS_PER_WORD{DiscoveryNotifierData::BITS_PER_NOTIFICATION_WORD};
+    constexpr uint64_t ALL_BITS{~0ULL};
+    const uint64_t end{begin + count};
+
+    for (uint64_t word = begin / BITS_PER_WORD; word * BITS_PER_WORD < end; ++word)
+    {
+        const uint64_t firstIndexOfWord{word * BITS_PER_WORD};
+        // only the bits within the range are reset, the other bits belong to another range
+        uint64_t rangeMask{ALL_BITS};
+        if (begin > firstIndexOfWord)
+        {
+            rangeMask &= ALL_BITS << (begin - firstIndexOfWord);
+        }
+        if (end < firstIndexOfWord + BITS_PER_WORD)
+        {
+            rangeMask &= ALL_BITS >> (firstIndexOfWord + BITS_PER_WORD - end);
+        }
+
+        auto& notifications = m_discoveryNotifierDataPtr->m_activeNotifications[word];
+        // avoid the read-modify-write in the common case of a word without notifications
+        if ((notifications.load(std::memory_order_relaxed) & rangeMask) == 0U)
+        {
+            continue;
+        }
+
+        // the acquire pairs with the release of the notifier and makes the request of the port visible
+        uint64_t activeNotifications{notifications.fetch_and(~rangeMask, std::memory_order_acquire) & rangeMask};
+        while (activeNotifications != 0U)
+        {
+            callback(firstIndexOfWord + countTrailingZeros(activeNotifications) - begin);
+            activeNotifications &= activeNotifications - 1U;
+        }
+    }
+}
+
+void DiscoveryListener::resetSemaphore() noexcept
+{
+    bool hasFatalError = false;
+    while (!hasFatalError
+           && m_discoveryNotifierDataPtr->m_semaphore->tryWait()
+                  .or_else([&](auto) {
+                      IOX_REPORT_FATAL(PoshError::POPO__DISCOVERY_LISTENER_SEMAPHORE_CORRUPTED_IN_RESET);
+                      hasFatalError = true;
+                  })
+                  .value())
+    {
+    }
+}
+
+} // namespace popo
+} // namespace iox
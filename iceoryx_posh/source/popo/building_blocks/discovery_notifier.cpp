@@ -0,0 +1,49 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+DiscoveryNotifier::DiscoveryNotifier(DiscoveryNotifierData& discoveryNotifierDataRef, const uint64_t index) noexcept
+    : m_discoveryNotifierDataPtr(&discoveryNotifierDataRef)
+    , m_notificationIndex(index)
+{
+    if (index >= DiscoveryNotifierData::CAPACITY)
+    {
+        IOX_LOG(Fatal,
+                "The provided index " << index << " is too large. The index has to be in the range of [0, "
+                                      << DiscoveryNotifierData::CAPACITY << "[.");
+        IOX_REPORT_FATAL(PoshError::POPO__DISCOVERY_NOTIFIER_INDEX_TOO_LARGE);
+    }
+}
+
+void DiscoveryNotifier::notify() noexcept
+{
+    const auto word = m_notificationIndex / DiscoveryNotifierData::BITS_PER_NOTIFICATION_WORD;
+    const auto bit = m_notificationIndex % DiscoveryNotifierData::BITS_PER_NOTIFICATION_WORD;
+    // the release pairs with the acquire of the listener and publishes the request of the port
+    m_discoveryNotifierDataPtr->m_activeNotifications[word].fetch_or(1ULL << bit, std::memory_order_release);
+    m_discoveryNotifierDataPtr->m_semaphore->post().or_else(
+        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__DISCOVERY_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
+}
+
+} // namespace popo
+} // namespace iox
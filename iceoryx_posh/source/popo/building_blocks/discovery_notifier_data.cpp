@@ -0,0 +1,38 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier_data.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+
+namespace iox
+{
+namespace popo
+{
+DiscoveryNotifierData::DiscoveryNotifierData() noexcept
+{
+    build::InterProcessSemaphore::Builder()
+        .initialValue(0U)
+        .isInterProcessCapable(true)
+        .create(m_semaphore)
+        .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__DISCOVERY_NOTIFIER_DATA_FAILED_TO_CREATE_SEMAPHORE); });
+
+    for (auto& word : m_activeNotifications)
+    {
+        word.store(0U, std::memory_order_relaxed);
+    }
+}
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,129 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+uint64_t indexOfMostSignificantBit(uint64_t value) noexcept
+{
+    uint64_t index{0U};
+    for (uint64_t step = 32U; step > 0U; step /= 2U)
+    {
+        if ((value >> step) != 0U)
+        {
+            value >>= step;
+            index += step;
+        }
+    }
+    return index;
+}
+} // namespace
+
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::SUB_BUCKETS_PER_RANGE;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_RANGES;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+uint64_t LatencyHistogram::Snapshot::percentile(const double percentile) const noexcept
+{
+    if (m_numberOfValues == 0U)
+    {
+        return 0U;
+    }
+
+    const auto clampedPercentile = std::min(std::max(percentile, 0.0), 1.0);
+    auto rank = static_cast<uint64_t>(std::ceil(clampedPercentile * static_cast<double>(m_numberOfValues)));
+    rank = std::min(std::max(rank, static_cast<uint64_t>(1U)), m_numberOfValues);
+
+    uint64_t accumulatedValues{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        accumulatedValues += m_buckets[i];
+        if (accumulatedValues >= rank)
+        {
+            return bucketUpperBound(i);
+        }
+    }
+
+    return bucketUpperBound(NUMBER_OF_BUCKETS - 1U);
+}
+
+LatencyHistogram::LatencyHistogram() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(const uint64_t latencyInNanoseconds) noexcept
+{
+    m_buckets[bucketIndex(latencyInNanoseconds)].fetch_add(1U, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::drain() noexcept
+{
+    Snapshot snapshot;
+    for (uint64_t i = 0U; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        snapshot.m_buckets[i] = m_buckets[i].exchange(0U, std::memory_order_relaxed);
+        snapshot.m_numberOfValues += snapshot.m_buckets[i];
+    }
+    return snapshot;
+}
+
+uint64_t LatencyHistogram::bucketIndex(const uint64_t latencyInNanoseconds) noexcept
+{
+    // the values of the first range are sorted linearly into buckets with a width of 1
+    if (latencyInNanoseconds < SUB_BUCKETS_PER_RANGE)
+    {
+        return latencyInNanoseconds;
+    }
+
+    const auto shift = indexOfMostSignificantBit(latencyInNanoseconds) - SUB_BUCKET_BITS;
+    const auto range = shift + 1U;
+    if (range >= NUMBER_OF_RANGES)
+    {
+        return NUMBER_OF_BUCKETS - 1U;
+    }
+
+    const auto subBucket = (latencyInNanoseconds >> shift) - SUB_BUCKETS_PER_RANGE;
+    return range * SUB_BUCKETS_PER_RANGE + subBucket;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(const uint64_t index) noexcept
+{
+    const auto range = index / SUB_BUCKETS_PER_RANGE;
+    const auto subBucket = index % SUB_BUCKETS_PER_RANGE;
+    if (range == 0U)
+    {
+        return subBucket;
+    }
+
+    const auto shift = range - 1U;
+    return ((SUB_BUCKETS_PER_RANGE + subBucket + 1U) << shift) - 1U;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,123 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/waiting_producer_registry.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/detail/adaptive_wait.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t WaitingProducerRegistry::CAPACITY;
+
+optional<uint32_t> WaitingProducerRegistry::registerProducer(build::InterProcessSemaphore& wakeUpSemaphore) noexcept
+{
+    for (uint32_t slot = 0U; slot < CAPACITY; ++slot)
+    {
+        auto expectedState = SlotState::FREE;
+        if (m_slots[slot].m_state.compare_exchange_strong(expectedState, SlotState::CLAIMED))
+        {
+            m_slots[slot].m_wakeUpSemaphore = &wakeUpSemaphore;
+            m_slots[slot].m_state.store(SlotState::REGISTERED);
+            m_registeredSlots.fetch_or(1U << slot);
+            return slot;
+        }
+    }
+
+    return nullopt;
+}
+
+void WaitingProducerRegistry::deregisterProducer(const uint32_t slot) noexcept
+{
+    m_registeredSlots.fetch_and(~(1U << slot));
+    m_slots[slot].m_state.store(SlotState::CLAIMED);
+    releaseSlot(slot);
+}
+
+void WaitingProducerRegistry::removeProducer(const build::InterProcessSemaphore& wakeUpSemaphore) noexcept
+{
+    for (uint32_t slot = 0U; slot < CAPACITY; ++slot)
+    {
+        // a freed slot has no semaphore, therefore a slot which is claimed by another producer cannot refer to the
+        // semaphore of the removed producer; a claimed slot with this semaphore was left by the terminated producer
+        // during its registration or deregistration
+        if (m_slots[slot].m_state.load() == SlotState::FREE
+            || m_slots[slot].m_wakeUpSemaphore.get() != &wakeUpSemaphore)
+        {
+            continue;
+        }
+
+        deregisterProducer(slot);
+    }
+}
+
+void WaitingProducerRegistry::releaseSlot(const uint32_t slot) noexcept
+{
+    // a consumer which saw the registration might still post the semaphore; this takes only a few instructions. A
+    // consumer which was terminated meanwhile never finishes, therefore the wait is bounded
+    deadline_timer deregistrationTimeout{WAITING_PRODUCER_DEREGISTRATION_TIMEOUT};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (m_slots[slot].m_numberOfActiveWakeUps.load() > 0U)
+    {
+        if (deregistrationTimeout.hasExpired())
+        {
+            IOX_LOG(Warn,
+                    "A consumer did not finish waking up a waiting producer within "
+                        << WAITING_PRODUCER_DEREGISTRATION_TIMEOUT
+                        << "! It is considered terminated and the registration is released.");
+            m_slots[slot].m_numberOfActiveWakeUps.store(0U);
+            break;
+        }
+        adaptiveWait.wait();
+    }
+
+    m_slots[slot].m_wakeUpSemaphore = nullptr;
+    m_slots[slot].m_state.store(SlotState::FREE);
+}
+
+void WaitingProducerRegistry::wakeUpAll() noexcept
+{
+    for (auto& slot : m_slots)
+    {
+        if (slot.m_state.load() != SlotState::REGISTERED)
+        {
+            continue;
+        }
+
+        // the state is checked again after announcing the wake-up; a producer which deregisters in between waits
+        // until the semaphore is posted. If the slot was registered again in the meantime, the new producer is woken
+        // up spuriously and retries its delivery
+        slot.m_numberOfActiveWakeUps.fetch_add(1U);
+        if (slot.m_state.load() == SlotState::REGISTERED)
+        {
+            slot.m_wakeUpSemaphore->post().or_else([](auto) {
+                IOX_REPORT_FATAL(PoshError::POPO__WAITING_PRODUCER_REGISTRY_SEMAPHORE_CORRUPTED_IN_WAKE_UP);
+            });
+        }
+        slot.m_numberOfActiveWakeUps.fetch_sub(1U);
+    }
+}
+
+bool WaitingProducerRegistry::hasRegisteredProducers() const noexcept
+{
+    return m_registeredSlots.load(std::memory_order_relaxed) != 0U;
+}
+
+} // namespace popo
+} // namespace iox
@@ -15,7 +15,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iox/assertions.hpp"
+#include "iox/logging.hpp"
 
 namespace iox
 {
@@ -26,10 +28,28 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariable) noexcept
+Listener::Listener(const uint32_t numberOfCallbackWorkers) noexcept
+    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), numberOfCallbackWorkers)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariable, const uint32_t numberOfCallbackWorkers) noexcept
     : m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
+    if (numberOfCallbackWorkers > 0U)
+    {
+        auto numberOfWorkers = numberOfCallbackWorkers;
+        if (numberOfWorkers > MAX_NUMBER_OF_CALLBACK_WORKERS_PER_LISTENER)
+        {
+            numberOfWorkers = MAX_NUMBER_OF_CALLBACK_WORKERS_PER_LISTENER;
+            IOX_LOG(Warn,
+                    "The number of " << numberOfCallbackWorkers << " callback workers exceeds the maximum! Using "
+                                     << numberOfWorkers << " callback workers instead.");
+        }
+        m_callbackWorkers.emplace(*this, numberOfWorkers);
+    }
+
     m_thread = std::thread(&Listener::threadLoop, this);
 }
 
@@ -39,7 +59,15 @@ Listener::~Listener() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+    // the workers must be stopped before the events are destroyed since they could still execute callbacks
+    m_callbackWorkers.reset();
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    if (m_conditionVariableData->m_discoveryNotifierDataPtr)
+    {
+        DiscoveryNotifier(*m_conditionVariableData->m_discoveryNotifierDataPtr.get(),
+                          m_conditionVariableData->m_discoveryNotificationIndex)
+            .notify();
+    }
 }
 
 uint64_t Listener::size() const noexcept
@@ -47,6 +75,21 @@ uint64_t Listener::size() const noexcept
     return m_indexManager.indicesInUse();
 }
 
+uint32_t Listener::numberOfCallbackWorkers() const noexcept
+{
+    return m_callbackWorkers.has_value() ? m_callbackWorkers->numberOfWorkers() : 0U;
+}
+
+void Listener::setSpinDuration(const units::Duration spinDuration) noexcept
+{
+    m_conditionListener.setSpinDuration(spinDuration);
+}
+
+units::Duration Listener::spinDuration() const noexcept
+{
+    return m_conditionListener.spinDuration();
+}
+
 void Listener::threadLoop() noexcept
 {
     while (m_wasDtorCalled.load(std::memory_order_relaxed) == false)
@@ -55,7 +98,14 @@ void Listener::threadLoop() noexcept
 
         for (auto& id : activateNotificationIds)
         {
-            m_events[id]->executeCallback();
+            if (m_callbackWorkers.has_value())
+            {
+                m_callbackWorkers->schedule(static_cast<uint32_t>(id));
+            }
+            else
+            {
+                m_events[id]->executeCallback();
+            }
         }
     }
 }
@@ -105,6 +155,107 @@ uint64_t Listener::IndexManager_t::indicesInUse() const noexcept
 // END IndexManager_t
 /////////////////////
 
+//////////////////////////
+// BEGIN CallbackWorkers_t
+//////////////////////////
+Listener::CallbackWorkers_t::CallbackWorkers_t(Listener& listener, const uint32_t numberOfWorkers) noexcept
+    : m_listener(listener)
+{
+    for (auto& pendingNotifications : m_pendingNotifications)
+    {
+        pendingNotifications.store(0U, std::memory_order_relaxed);
+    }
+
+    UnnamedSemaphoreBuilder()
+        .initialValue(0U)
+        .isInterProcessCapable(false)
+        .create(m_wakeupSemaphore)
+        .expect("Valid Semaphore");
+
+    for (uint32_t i = 0U; i < numberOfWorkers; ++i)
+    {
+        m_workers.emplace_back(&CallbackWorkers_t::workerLoop, this);
+    }
+}
+
+Listener::CallbackWorkers_t::~CallbackWorkers_t() noexcept
+{
+    m_keepRunning.store(false);
+    for (uint64_t i = 0U; i < m_workers.size(); ++i)
+    {
+        IOX_DISCARD_RESULT(m_wakeupSemaphore->post());
+    }
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+uint32_t Listener::CallbackWorkers_t::numberOfWorkers() const noexcept
+{
+    return static_cast<uint32_t>(m_workers.size());
+}
+
+void Listener::CallbackWorkers_t::schedule(const uint32_t index) noexcept
+{
+    // when the event has already pending notifications, a worker owns it and executes the callback once more
+    if (m_pendingNotifications[index].fetch_add(1U, std::memory_order_acq_rel) != 0U)
+    {
+        return;
+    }
+
+    IOX_ENFORCE(m_scheduledEvents.tryPush(index), "Scheduling an event which is already scheduled");
+    m_wakeupSemaphore->post().or_else([](const auto& error) {
+        IOX_LOG(Error, "Could not wake up the listener callback worker! Error: " << static_cast<uint32_t>(error));
+    });
+}
+
+void Listener::CallbackWorkers_t::workerLoop() noexcept
+{
+    while (true)
+    {
+        if (m_wakeupSemaphore->wait().has_error())
+        {
+            IOX_LOG(Error, "Could not wait for the listener events to execute!");
+        }
+
+        if (!m_keepRunning.load())
+        {
+            return;
+        }
+
+        auto index = m_scheduledEvents.pop();
+        if (index.has_value())
+        {
+            execute(index.value());
+        }
+    }
+}
+
+void Listener::CallbackWorkers_t::execute(const uint32_t index) noexcept
+{
+    auto& pendingNotifications = m_pendingNotifications[index];
+    auto handledNotifications = pendingNotifications.load(std::memory_order_acquire);
+    while (true)
+    {
+        m_listener.m_events[index]->executeCallback();
+
+        // all notifications which arrived before the callback execution started are handled by it; if more arrived
+        // in the meantime, the callback has to be executed once more by this worker
+        const auto previousNotifications =
+            pendingNotifications.fetch_sub(handledNotifications, std::memory_order_acq_rel);
+        if (previousNotifications == handledNotifications)
+        {
+            return;
+        }
+        handledNotifications = previousNotifications - handledNotifications;
+    }
+}
+////////////////////////
+// END CallbackWorkers_t
+////////////////////////
+
 namespace internal
 {
 Event_t::~Event_t() noexcept
@@ -23,8 +23,9 @@ namespace popo
 {
 VariantQueueTypes getResponseQueueType(const QueueFullPolicy policy) noexcept
 {
-    return policy == QueueFullPolicy::DISCARD_OLDEST_DATA ? VariantQueueTypes::SoFi_MultiProducerSingleConsumer
-                                                          : VariantQueueTypes::FiFo_MultiProducerSingleConsumer;
+    return ClientChunkQueueData_t::Queue_t::fixedCapacityQueueType(
+        policy == QueueFullPolicy::DISCARD_OLDEST_DATA ? VariantQueueTypes::SoFi_MultiProducerSingleConsumer
+                                                       : VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
 }
 
 constexpr uint64_t ClientPortData::HISTORY_CAPACITY_ZERO;
@@ -254,5 +254,20 @@ void ClientPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+void ClientPortRouDi::detachFromOwner() noexcept
+{
+    m_chunkSender.detachSenderFromOwner();
+}
+
+bool ClientPortRouDi::publishPendingQueues() noexcept
+{
+    return m_chunkSender.publishPendingQueues();
+}
+
+bool ClientPortRouDi::isQueueAccessible(not_null<const ServerChunkQueueData_t* const> queue) const noexcept
+{
+    return m_chunkSender.isQueueAccessibleBySender(queue);
+}
+
 } // namespace popo
 } // namespace iox
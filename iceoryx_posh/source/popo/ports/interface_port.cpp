@@ -16,8 +16,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 
+#include <mutex>
+
 namespace iox
 {
 namespace popo
@@ -49,9 +52,43 @@ void InterfacePort::dispatchCaProMessage(const capro::CaproMessage& caProMessage
     {
         // information loss for this interface port
         IOX_REPORT(PoshError::POSH__INTERFACEPORT_CAPRO_MESSAGE_DISMISSED, iox::er::RUNTIME_ERROR);
+        return;
+    }
+
+    std::lock_guard<ThreadSafePolicy> lock(getMembers()->m_conditionVariableLock);
+    if (getMembers()->m_conditionVariableDataPtr)
+    {
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
     }
 }
 
+bool InterfacePort::hasCaProMessage() const noexcept
+{
+    return !getMembers()->m_caproMessageFiFo.empty();
+}
+
+void InterfacePort::setConditionVariable(ConditionVariableData& conditionVariableDataRef,
+                                         const uint64_t notificationIndex) noexcept
+{
+    std::lock_guard<ThreadSafePolicy> lock(getMembers()->m_conditionVariableLock);
+    getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
+    getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+}
+
+void InterfacePort::unsetConditionVariable() noexcept
+{
+    std::lock_guard<ThreadSafePolicy> lock(getMembers()->m_conditionVariableLock);
+    getMembers()->m_conditionVariableDataPtr = nullptr;
+    getMembers()->m_conditionVariableNotificationIndex.reset();
+}
+
+bool InterfacePort::isConditionVariableSet() const noexcept
+{
+    return getMembers()->m_conditionVariableDataPtr.operator bool();
+}
+
 const InterfacePortData* InterfacePort::getMembers() const noexcept
 {
     return reinterpret_cast<const InterfacePortData*>(BasePort::getMembers());
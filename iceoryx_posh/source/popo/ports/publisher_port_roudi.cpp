@@ -122,5 +122,20 @@ void PublisherPortRouDi::releaseAllChunks() noexcept
     m_chunkSender.releaseAll();
 }
 
+void PublisherPortRouDi::detachFromOwner() noexcept
+{
+    m_chunkSender.detachSenderFromOwner();
+}
+
+bool PublisherPortRouDi::publishPendingQueues() noexcept
+{
+    return m_chunkSender.publishPendingQueues();
+}
+
+bool PublisherPortRouDi::isQueueAccessible(not_null<const PublisherPortData::ChunkQueueData_t* const> queue) const noexcept
+{
+    return m_chunkSender.isQueueAccessibleBySender(queue);
+}
+
 } // namespace popo
 } // namespace iox
@@ -23,8 +23,9 @@ namespace popo
 {
 VariantQueueTypes getRequestQueueType(const QueueFullPolicy policy) noexcept
 {
-    return policy == QueueFullPolicy::DISCARD_OLDEST_DATA ? VariantQueueTypes::SoFi_MultiProducerSingleConsumer
-                                                          : VariantQueueTypes::FiFo_MultiProducerSingleConsumer;
+    return ServerChunkQueueData_t::Queue_t::fixedCapacityQueueType(
+        policy == QueueFullPolicy::DISCARD_OLDEST_DATA ? VariantQueueTypes::SoFi_MultiProducerSingleConsumer
+                                                       : VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
 }
 
 constexpr uint64_t ServerPortData::HISTORY_REQUEST_OF_ZERO;
@@ -40,6 +41,7 @@ ServerPortData::ServerPortData(const capro::ServiceDescription& serviceDescripti
     , m_chunkReceiverData(
           getRequestQueueType(serverOptions.requestQueueFullPolicy), serverOptions.requestQueueFullPolicy, memoryInfo)
     , m_offeringRequested(serverOptions.offerOnCreate)
+    , m_concurrentRequestProcessing(serverOptions.concurrentRequestProcessing)
 {
     m_chunkReceiverData.m_queue.setCapacity(serverOptions.requestQueueCapacity);
 }
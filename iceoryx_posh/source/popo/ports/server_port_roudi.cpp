@@ -171,5 +171,20 @@ void ServerPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+void ServerPortRouDi::detachFromOwner() noexcept
+{
+    m_chunkSender.detachSenderFromOwner();
+}
+
+bool ServerPortRouDi::publishPendingQueues() noexcept
+{
+    return m_chunkSender.publishPendingQueues();
+}
+
+bool ServerPortRouDi::isQueueAccessible(not_null<const ClientChunkQueueData_t* const> queue) const noexcept
+{
+    return m_chunkSender.isQueueAccessibleBySender(queue);
+}
+
 } // namespace popo
 } // namespace iox
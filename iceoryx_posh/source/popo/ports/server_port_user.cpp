@@ -29,6 +29,24 @@ ServerPortUser::ServerPortUser(MemberType_t& serverPortData) noexcept
 {
 }
 
+ServerPortUser::ServerPortUser(ServerPortUser&& rhs) noexcept
+    : BasePort(std::move(rhs))
+    , m_chunkSender(std::move(rhs.m_chunkSender))
+    , m_chunkReceiver(std::move(rhs.m_chunkReceiver))
+{
+}
+
+ServerPortUser& ServerPortUser::operator=(ServerPortUser&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        BasePort::operator=(std::move(rhs));
+        m_chunkSender = std::move(rhs.m_chunkSender);
+        m_chunkReceiver = std::move(rhs.m_chunkReceiver);
+    }
+    return *this;
+}
+
 const ServerPortUser::MemberType_t* ServerPortUser::getMembers() const noexcept
 {
     return reinterpret_cast<const MemberType_t*>(BasePort::getMembers());
@@ -39,8 +57,20 @@ ServerPortUser::MemberType_t* ServerPortUser::getMembers() noexcept
     return reinterpret_cast<MemberType_t*>(BasePort::getMembers());
 }
 
+std::unique_lock<std::mutex> ServerPortUser::lockForConcurrentRequestProcessing() noexcept
+{
+    // the single threaded server does not pay for the lock
+    std::unique_lock<std::mutex> lock(m_concurrentRequestProcessingMutex, std::defer_lock);
+    if (getMembers()->m_concurrentRequestProcessing)
+    {
+        lock.lock();
+    }
+    return lock;
+}
+
 expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest() noexcept
 {
+    auto lock = lockForConcurrentRequestProcessing();
     auto getChunkResult = m_chunkReceiver.tryGet();
 
     if (getChunkResult.has_error())
@@ -60,6 +90,7 @@ void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) no
 {
     if (requestHeader != nullptr)
     {
+        auto lock = lockForConcurrentRequestProcessing();
         m_chunkReceiver.release(requestHeader->getChunkHeader());
     }
     else
@@ -71,6 +102,7 @@ void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) no
 
 void ServerPortUser::releaseQueuedRequests() noexcept
 {
+    auto lock = lockForConcurrentRequestProcessing();
     m_chunkReceiver.clear();
 }
 
@@ -94,6 +126,7 @@ ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
         return err(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER);
     }
 
+    auto lock = lockForConcurrentRequestProcessing();
     auto allocateResult = m_chunkSender.tryAllocate(
         getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(ResponseHeader), alignof(ResponseHeader));
 
@@ -114,6 +147,7 @@ void ServerPortUser::releaseResponse(const ResponseHeader* const responseHeader)
 {
     if (responseHeader != nullptr)
     {
+        auto lock = lockForConcurrentRequestProcessing();
         m_chunkSender.release(responseHeader->getChunkHeader());
     }
     else
@@ -140,14 +174,25 @@ expected<void, ServerSendError> ServerPortUser::sendResponse(ResponseHeader* con
         return err(ServerSendError::NOT_OFFERED);
     }
 
-    bool responseSent{false};
-    m_chunkSender.getQueueIndex(responseHeader->m_uniqueClientQueueId, responseHeader->m_lastKnownClientQueueIndex)
-        .and_then([&](auto queueIndex) {
-            responseHeader->m_lastKnownClientQueueIndex = queueIndex;
-            responseSent = m_chunkSender.sendToQueue(
-                responseHeader->getChunkHeader(), responseHeader->m_uniqueClientQueueId, queueIndex);
-        })
-        .or_else([&] { releaseResponse(responseHeader); });
+    const auto uniqueClientQueueId = responseHeader->m_uniqueClientQueueId;
+    uint32_t queueIndex{0U};
+    optional<mepoo::SharedChunk> response;
+    {
+        auto lock = lockForConcurrentRequestProcessing();
+        m_chunkSender.getQueueIndex(uniqueClientQueueId, responseHeader->m_lastKnownClientQueueIndex)
+            .and_then([&](auto index) {
+                responseHeader->m_lastKnownClientQueueIndex = index;
+                queueIndex = index;
+                response = m_chunkSender.prepareSendToQueue(responseHeader->getChunkHeader());
+            })
+            .or_else([&] { m_chunkSender.release(responseHeader->getChunkHeader()); });
+    }
+
+    // the delivery is done without the lock for the concurrent request processing since it blocks on a full client
+    // queue with the WAIT_FOR_CONSUMER policy, which would otherwise stall all other workers of the server
+    const bool responseSent =
+        response.has_value()
+        && !m_chunkSender.deliverToQueue(uniqueClientQueueId, queueIndex, response.value()).has_error();
 
     if (!responseSent)
     {
@@ -163,6 +208,7 @@ void ServerPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -171,6 +217,7 @@ void ServerPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
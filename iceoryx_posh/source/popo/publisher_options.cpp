@@ -21,12 +21,18 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint32_t PublisherOptions::NO_NUMA_NODE_PREFERENCE;
+constexpr uint32_t PublisherOptions::NUMA_NODE_OF_CALLING_THREAD;
+
 Serialization PublisherOptions::serialize() const noexcept
 {
     return Serialization::create(historyCapacity,
                                  nodeName,
                                  offerOnCreate,
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+                                 chunkCacheSize,
+                                 stampSendTimestamp,
+                                 preferredNumaNode);
 }
 
 expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(const Serialization& serialized) noexcept
@@ -39,7 +45,10 @@ expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(c
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        publisherOptions.chunkCacheSize,
+                                                        publisherOptions.stampSendTimestamp,
+                                                        publisherOptions.preferredNumaNode);
 
     if (!deserializationSuccessful
         || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
@@ -27,7 +27,8 @@ Serialization ServerOptions::serialize() const noexcept
                                  nodeName,
                                  offerOnCreate,
                                  static_cast<std::underlying_type_t<QueueFullPolicy>>(requestQueueFullPolicy),
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(clientTooSlowPolicy));
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(clientTooSlowPolicy),
+                                 concurrentRequestProcessing);
 }
 
 expected<ServerOptions, Serialization::Error> ServerOptions::deserialize(const Serialization& serialized) noexcept
@@ -43,7 +44,8 @@ expected<ServerOptions, Serialization::Error> ServerOptions::deserialize(const S
                                                         serverOptions.nodeName,
                                                         serverOptions.offerOnCreate,
                                                         requestQueueFullPolicy,
-                                                        clientTooSlowPolicy);
+                                                        clientTooSlowPolicy,
+                                                        serverOptions.concurrentRequestProcessing);
 
     if (!deserializationSuccessful
         || requestQueueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA)
@@ -62,7 +64,8 @@ bool ServerOptions::operator==(const ServerOptions& rhs) const noexcept
 {
     return requestQueueCapacity == rhs.requestQueueCapacity && nodeName == rhs.nodeName
            && offerOnCreate == rhs.offerOnCreate && requestQueueFullPolicy == rhs.requestQueueFullPolicy
-           && clientTooSlowPolicy == rhs.clientTooSlowPolicy;
+           && clientTooSlowPolicy == rhs.clientTooSlowPolicy
+           && concurrentRequestProcessing == rhs.concurrentRequestProcessing;
 }
 } // namespace popo
 } // namespace iox
@@ -98,7 +98,11 @@ bool TriggerHandle::wasTriggered() const noexcept
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (m_conditionVariableDataPtr != nullptr)
     {
-        return m_conditionVariableDataPtr->m_activeNotifications[m_uniqueTriggerId].load(std::memory_order_relaxed);
+        const auto word = m_uniqueTriggerId / ConditionVariableData::BITS_PER_NOTIFICATION_WORD;
+        const auto bit = m_uniqueTriggerId % ConditionVariableData::BITS_PER_NOTIFICATION_WORD;
+        return (m_conditionVariableDataPtr->m_activeNotifications[word].load(std::memory_order_relaxed)
+                & (1ULL << bit))
+               != 0U;
     }
     return false;
 }
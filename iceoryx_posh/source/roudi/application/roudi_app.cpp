@@ -49,6 +49,7 @@ RouDiApp::RouDiApp(const IceoryxConfig& config) noexcept
         IOX_LOG(Trace, "  Shares Address Space With Applications = " << roudiConfig.sharesAddressSpaceWithApplications);
         IOX_LOG(Trace, "  Process Termination Delay = " << roudiConfig.processTerminationDelay);
         IOX_LOG(Trace, "  Process Kill Delay = " << roudiConfig.processKillDelay);
+        IOX_LOG(Trace, "  Runtime Message Worker Count = " << roudiConfig.runtimeMessageWorkerCount);
         IOX_LOG(Trace, "  Compatibility Check Level = " << roudiConfig.compatibilityCheckLevel);
         IOX_LOG(Trace, "  Introspection Chunk Count = " << roudiConfig.introspectionChunkCount);
         IOX_LOG(Trace, "  Discovery Chunk Count = " << roudiConfig.discoveryChunkCount);
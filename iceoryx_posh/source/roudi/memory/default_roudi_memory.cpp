@@ -30,7 +30,11 @@ DefaultRouDiMemory::DefaultRouDiMemory(const IceoryxConfig& config) noexcept
     : m_introspectionMemPoolBlock(introspectionMemPoolConfig(config.introspectionChunkCount))
     , m_discoveryMemPoolBlock(discoveryMemPoolConfig(config.discoveryChunkCount))
     , m_segmentManagerBlock(config, config.domainId)
-    , m_managementShm(SHM_NAME, config.domainId, AccessMode::ReadWrite, OpenMode::PurgeAndCreate)
+    , m_managementShm(SHM_NAME,
+                      config.domainId,
+                      AccessMode::ReadWrite,
+                      OpenMode::PurgeAndCreate,
+                      config.m_managementSharedMemoryOptions)
 {
     m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         IOX_REPORT_FATAL(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK);
@@ -69,6 +73,8 @@ mepoo::MePooConfig DefaultRouDiMemory::discoveryMemPoolConfig(const uint32_t chu
     constexpr size_t ALIGNMENT{mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT};
     mepoo::MePooConfig mempoolConfig;
     mempoolConfig.m_mempoolConfig.push_back({align(sizeof(roudi::ServiceRegistry), ALIGNMENT), chunkCount});
+    mempoolConfig.m_mempoolConfig.push_back({align(sizeof(roudi::ServiceRegistryChange), ALIGNMENT),
+                                             SERVICE_REGISTRY_CHANGES_QUEUE_CAPACITY + chunkCount});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -35,11 +35,13 @@ constexpr access_rights PosixShmMemoryProvider::SHM_MEMORY_PERMISSIONS;
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const DomainId domainId,
                                                const AccessMode accessMode,
-                                               const OpenMode openMode) noexcept
+                                               const OpenMode openMode,
+                                               const mepoo::SharedMemoryOptions& sharedMemoryOptions) noexcept
     : m_shmName(shmName)
     , m_domainId(domainId)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_sharedMemoryOptions(sharedMemoryOptions)
 {
 }
 
@@ -65,6 +67,11 @@ expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(const
              .accessMode(m_accessMode)
              .openMode(m_openMode)
              .permissions(SHM_MEMORY_PERMISSIONS)
+             .transparentHugePages(m_sharedMemoryOptions.transparentHugePages)
+             .lockMemory(m_sharedMemoryOptions.lockMemory)
+             .prefaultThreadCount(m_sharedMemoryOptions.prefaultThreadCount)
+             .numaPolicy(m_sharedMemoryOptions.numaPolicy)
+             .numaNode(m_sharedMemoryOptions.numaNode)
              .create()
              .and_then([this](auto& sharedMemoryObject) { m_shmObject.emplace(std::move(sharedMemoryObject)); }))
     {
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_listener.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
@@ -24,12 +25,22 @@
 #include "iox/logging.hpp"
 #include "iox/vector.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
 {
 namespace roudi
 {
+namespace
+{
+template <typename Container, typename Port>
+bool containsPort(const Container& ports, const Port* const port) noexcept
+{
+    return std::find(ports.begin(), ports.end(), port) != ports.end();
+}
+} // namespace
+
 capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept
 {
     auto result = convert::from_string<int32_t>(str.c_str());
@@ -80,9 +91,23 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
         registryPortOptions,
         discoveryMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    // the changes are only relevant for applications which are already connected, late joiners receive the complete
+    // registry which is published when they subscribe to the service discovery
+    popo::PublisherOptions registryChangesPortOptions;
+    registryChangesPortOptions.historyCapacity = 0U;
+    registryChangesPortOptions.nodeName = iox::NodeName_t("Service Registry");
+    registryChangesPortOptions.offerOnCreate = true;
+
+    m_serviceRegistryChangesPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+        registryChangesPortOptions,
+        discoveryMemoryManager);
+
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryChangesPort(*m_serviceRegistryChangesPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryChangesPort);
 
     auto maybeIntrospectionMemoryManager = m_roudiMemoryInterface->introspectionMemoryManager();
     if (!maybeIntrospectionMemoryManager.has_value())
@@ -118,6 +143,8 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
+    publishPendingQueueChanges();
+
     handlePublisherPorts();
 
     handleSubscriberPorts();
@@ -130,27 +157,43 @@ void PortManager::doDiscovery() noexcept
 
     handleConditionVariables();
 
+    releaseDestroyedPorts();
+
     publishServiceRegistry();
 }
 
+popo::DiscoveryNotifierData& PortManager::discoveryNotifierData() noexcept
+{
+    return m_portPool->getDiscoveryNotifierData();
+}
+
+void PortManager::stopDiscoveryNotifications() noexcept
+{
+    m_portPool->detachAllFromDiscoveryNotifier();
+}
+
 void PortManager::handlePublisherPorts() noexcept
 {
-    // get the changes of publisher port offer state
+    // get the changes of publisher port offer state; only the ports which notified a request are processed
     auto& publisherPorts = m_portPool->getPublisherPortDataList();
-    auto port = publisherPorts.begin();
-    while (port != publisherPorts.end())
-    {
-        auto currentPort = port++;
-        PublisherPortRouDiType publisherPort(currentPort.to_ptr());
+    popo::DiscoveryListener(m_portPool->getDiscoveryNotifierData())
+        .forEachNotification(PortPoolData::PUBLISHER_NOTIFICATION_OFFSET, MAX_PUBLISHERS, [&](const uint64_t index) {
+            auto port = publisherPorts.iter_from_index(static_cast<PortPoolData::PublisherContainer::IndexType>(index));
+            if (port == publisherPorts.end())
+            {
+                // the port was already removed
+                return;
+            }
+            PublisherPortRouDiType publisherPort(port.to_ptr());
 
-        doDiscoveryForPublisherPort(publisherPort);
+            doDiscoveryForPublisherPort(publisherPort);
 
-        // check if we have to destroy this publisher port
-        if (publisherPort.toBeDestroyed())
-        {
-            destroyPublisherPort(currentPort.to_ptr());
-        }
-    }
+            // check if we have to destroy this publisher port
+            if (publisherPort.toBeDestroyed())
+            {
+                destroyPublisherPort(port.to_ptr());
+            }
+        });
 }
 
 void PortManager::doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept
@@ -184,22 +227,28 @@ void PortManager::doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherP
 
 void PortManager::handleSubscriberPorts() noexcept
 {
-    // get requests for change of subscription state of subscribers
+    // get requests for change of subscription state of subscribers; only the ports which notified a request are
+    // processed
     auto& subscriberPorts = m_portPool->getSubscriberPortDataList();
-    auto port = subscriberPorts.begin();
-    while (port != subscriberPorts.end())
-    {
-        auto currentPort = port++;
-        SubscriberPortType subscriberPort(currentPort.to_ptr());
+    popo::DiscoveryListener(m_portPool->getDiscoveryNotifierData())
+        .forEachNotification(PortPoolData::SUBSCRIBER_NOTIFICATION_OFFSET, MAX_SUBSCRIBERS, [&](const uint64_t index) {
+            auto port =
+                subscriberPorts.iter_from_index(static_cast<PortPoolData::SubscriberContainer::IndexType>(index));
+            if (port == subscriberPorts.end())
+            {
+                // the port was already removed
+                return;
+            }
+            SubscriberPortType subscriberPort(port.to_ptr());
 
-        doDiscoveryForSubscriberPort(subscriberPort);
+            doDiscoveryForSubscriberPort(subscriberPort);
 
-        // check if we have to destroy this subscriber port
-        if (subscriberPort.toBeDestroyed())
-        {
-            destroySubscriberPort(currentPort.to_ptr());
-        }
-    }
+            // check if we have to destroy this subscriber port
+            if (subscriberPort.toBeDestroyed())
+            {
+                destroySubscriberPort(port.to_ptr());
+            }
+        });
 }
 
 void PortManager::doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPort) noexcept
@@ -240,10 +289,19 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
 {
     IOX_ENFORCE(clientPortData != nullptr, "clientPortData must not be a nullptr");
 
+    if (containsPort(m_destroyedClientPorts, clientPortData))
+    {
+        // the port is already destroyed and waits until its queue is not accessed anymore
+        return;
+    }
+
     // create temporary client ports to orderly shut this client down
     popo::ClientPortRouDi clientPortRoudi(*clientPortData);
     popo::ClientPortUser clientPortUser(*clientPortData);
 
+    m_portPool->detachFromDiscoveryNotifier(*clientPortData);
+    clientPortRoudi.detachFromOwner();
+    removeWaitingSenderFromAllQueues(clientPortData->m_chunkSenderData.m_senderWakeUpSemaphore);
     clientPortUser.disconnect();
 
     // process DISCONNECT for this client in RouDi and distribute it
@@ -254,10 +312,25 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
         this->sendToAllMatchingServerPorts(caproMessage, clientPortRoudi);
     });
 
-    clientPortRoudi.releaseAllChunks();
-
     /// @todo iox-#1128 remove from to port introspection
 
+    if (isQueueOfClientAccessible(*clientPortData))
+    {
+        IOX_LOG(Debug,
+                "The response queue of the destroyed client port from runtime '"
+                    << clientPortData->m_runtimeName << "' and with service description '"
+                    << clientPortData->m_serviceDescription << "' is still used by a server; the port is released later");
+        m_destroyedClientPorts.push_back(clientPortData);
+        return;
+    }
+
+    releaseClientPort(clientPortData);
+}
+
+void PortManager::releaseClientPort(popo::ClientPortData* const clientPortData) noexcept
+{
+    popo::ClientPortRouDi(*clientPortData).releaseAllChunks();
+
     IOX_LOG(Debug,
             "Destroy client port from runtime '" << clientPortData->m_runtimeName << "' and with service description '"
                                                  << clientPortData->m_serviceDescription << "'");
@@ -268,22 +341,26 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
 
 void PortManager::handleClientPorts() noexcept
 {
-    // get requests for change of connection state of clients
+    // get requests for change of connection state of clients; only the ports which notified a request are processed
     auto& clientPorts = m_portPool->getClientPortDataList();
-    auto port = clientPorts.begin();
-    while (port != clientPorts.end())
-    {
-        auto currentPort = port++;
-        popo::ClientPortRouDi clientPort(*currentPort);
+    popo::DiscoveryListener(m_portPool->getDiscoveryNotifierData())
+        .forEachNotification(PortPoolData::CLIENT_NOTIFICATION_OFFSET, MAX_CLIENTS, [&](const uint64_t index) {
+            auto port = clientPorts.iter_from_index(static_cast<PortPoolData::ClientContainer::IndexType>(index));
+            if (port == clientPorts.end())
+            {
+                // the port was already removed
+                return;
+            }
+            popo::ClientPortRouDi clientPort(*port);
 
-        doDiscoveryForClientPort(clientPort);
+            doDiscoveryForClientPort(clientPort);
 
-        // check if we have to destroy this clinet port
-        if (clientPort.toBeDestroyed())
-        {
-            destroyClientPort(currentPort.to_ptr());
-        }
-    }
+            // check if we have to destroy this clinet port
+            if (clientPort.toBeDestroyed())
+            {
+                destroyClientPort(port.to_ptr());
+            }
+        });
 }
 
 void PortManager::doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept
@@ -334,10 +411,19 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
 {
     IOX_ENFORCE(serverPortData != nullptr, "serverPortData must not be a nullptr");
 
+    if (containsPort(m_destroyedServerPorts, serverPortData))
+    {
+        // the port is already destroyed and waits until its queue is not accessed anymore
+        return;
+    }
+
     // create temporary server ports to orderly shut this server down
     popo::ServerPortRouDi serverPortRoudi{*serverPortData};
     popo::ServerPortUser serverPortUser{*serverPortData};
 
+    m_portPool->detachFromDiscoveryNotifier(*serverPortData);
+    serverPortRoudi.detachFromOwner();
+    removeWaitingSenderFromAllQueues(serverPortData->m_chunkSenderData.m_senderWakeUpSemaphore);
     serverPortUser.stopOffer();
 
     // process STOP_OFFER for this server in RouDi and distribute it
@@ -352,10 +438,25 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
         this->sendToAllMatchingInterfacePorts(caproMessage);
     });
 
-    serverPortRoudi.releaseAllChunks();
-
     /// @todo iox-#1128 remove from port introspection
 
+    if (isQueueOfServerAccessible(*serverPortData))
+    {
+        IOX_LOG(Debug,
+                "The request queue of the destroyed server port from runtime '"
+                    << serverPortData->m_runtimeName << "' and with service description '"
+                    << serverPortData->m_serviceDescription << "' is still used by a client; the port is released later");
+        m_destroyedServerPorts.push_back(serverPortData);
+        return;
+    }
+
+    releaseServerPort(serverPortData);
+}
+
+void PortManager::releaseServerPort(popo::ServerPortData* const serverPortData) noexcept
+{
+    popo::ServerPortRouDi(*serverPortData).releaseAllChunks();
+
     IOX_LOG(Debug,
             "Destroy server port from runtime '" << serverPortData->m_runtimeName << "' and with service description '"
                                                  << serverPortData->m_serviceDescription << "'");
@@ -366,22 +467,26 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
 
 void PortManager::handleServerPorts() noexcept
 {
-    // get the changes of server port offer state
+    // get the changes of server port offer state; only the ports which notified a request are processed
     auto& serverPorts = m_portPool->getServerPortDataList();
-    auto port = serverPorts.begin();
-    while (port != serverPorts.end())
-    {
-        auto currentPort = port++;
-        popo::ServerPortRouDi serverPort(*currentPort);
+    popo::DiscoveryListener(m_portPool->getDiscoveryNotifierData())
+        .forEachNotification(PortPoolData::SERVER_NOTIFICATION_OFFSET, MAX_SERVERS, [&](const uint64_t index) {
+            auto port = serverPorts.iter_from_index(static_cast<PortPoolData::ServerContainer::IndexType>(index));
+            if (port == serverPorts.end())
+            {
+                // the port was already removed
+                return;
+            }
+            popo::ServerPortRouDi serverPort(*port);
 
-        doDiscoveryForServerPort(serverPort);
+            doDiscoveryForServerPort(serverPort);
 
-        // check if we have to destroy this server port
-        if (serverPort.toBeDestroyed())
-        {
-            destroyServerPort(currentPort.to_ptr());
-        }
-    }
+            // check if we have to destroy this server port
+            if (serverPort.toBeDestroyed())
+            {
+                destroyServerPort(port.to_ptr());
+            }
+        });
 }
 
 void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept
@@ -420,26 +525,32 @@ void PortManager::handleInterfaces() noexcept
 
 
     auto& interfacePorts = m_portPool->getInterfacePortDataList();
-    auto port = interfacePorts.begin();
-    while (port != interfacePorts.end())
-    {
-        auto currentPort = port++;
-        if (currentPort->m_doInitialOfferForward)
-        {
-            interfacePortsForInitialForwarding.push_back(currentPort.to_ptr());
-            currentPort->m_doInitialOfferForward = false;
-        }
+    popo::DiscoveryListener(m_portPool->getDiscoveryNotifierData())
+        .forEachNotification(
+            PortPoolData::INTERFACE_NOTIFICATION_OFFSET, MAX_INTERFACE_NUMBER, [&](const uint64_t index) {
+                auto port =
+                    interfacePorts.iter_from_index(static_cast<PortPoolData::InterfaceContainer::IndexType>(index));
+                if (port == interfacePorts.end())
+                {
+                    // the port was already removed
+                    return;
+                }
 
-        // check if we have to destroy this interface port
-        if (currentPort->m_toBeDestroyed.load(std::memory_order_relaxed))
-        {
-            IOX_LOG(Debug,
-                    "Destroy interface port from runtime '" << currentPort->m_runtimeName
-                                                            << "' and with service description '"
-                                                            << currentPort->m_serviceDescription << "'");
-            m_portPool->removeInterfacePort(currentPort.to_ptr());
-        }
-    }
+                // check if we have to destroy this interface port
+                if (port->m_toBeDestroyed.load(std::memory_order_relaxed))
+                {
+                    IOX_LOG(Debug,
+                            "Destroy interface port from runtime '" << port->m_runtimeName
+                                                                    << "' and with service description '"
+                                                                    << port->m_serviceDescription << "'");
+                    m_portPool->removeInterfacePort(port.to_ptr());
+                }
+                else if (port->m_doInitialOfferForward)
+                {
+                    interfacePortsForInitialForwarding.push_back(port.to_ptr());
+                    port->m_doInitialOfferForward = false;
+                }
+            });
 
     if (interfacePortsForInitialForwarding.size() > 0)
     {
@@ -491,16 +602,21 @@ void PortManager::handleInterfaces() noexcept
 void PortManager::handleConditionVariables() noexcept
 {
     auto& condVars = m_portPool->getConditionVariableDataList();
-    auto condVar = condVars.begin();
-    while (condVar != condVars.end())
-    {
-        auto currentCondVar = condVar++;
-        if (currentCondVar->m_toBeDestroyed.load(std::memory_order_relaxed))
-        {
-            IOX_LOG(Debug, "Destroy ConditionVariableData from runtime '" << currentCondVar->m_runtimeName << "'");
-            m_portPool->removeConditionVariableData(currentCondVar.to_ptr());
-        }
-    }
+    popo::DiscoveryListener(m_portPool->getDiscoveryNotifierData())
+        .forEachNotification(PortPoolData::CONDITION_VARIABLE_NOTIFICATION_OFFSET,
+                             MAX_NUMBER_OF_CONDITION_VARIABLES,
+                             [&](const uint64_t index) {
+                                 auto condVar = condVars.iter_from_index(
+                                     static_cast<PortPoolData::CondVarContainer::IndexType>(index));
+                                 if (condVar != condVars.end()
+                                     && condVar->m_toBeDestroyed.load(std::memory_order_relaxed))
+                                 {
+                                     IOX_LOG(Debug,
+                                             "Destroy ConditionVariableData from runtime '" << condVar->m_runtimeName
+                                                                                            << "'");
+                                     m_portPool->removeConditionVariableData(condVar.to_ptr());
+                                 }
+                             });
 }
 
 bool PortManager::isCompatiblePubSub(const PublisherPortRouDiType& publisher,
@@ -555,6 +671,13 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                     });
 
                 m_portIntrospection.reportMessage(publisherResponse.value(), subscriberSource.getUniqueID());
+
+                // a subscriber which joins the service discovery has missed the previous changes of the registry
+                if (publisherResponse->m_type == capro::CaproMessageType::ACK
+                    && isServiceDiscoveryPort(publisherPortData))
+                {
+                    m_isServiceRegistrySnapshotRequested = true;
+                }
             }
             publisherFound = true;
         }
@@ -672,6 +795,11 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
     bool serverFound = false;
     for (auto& serverPortData : m_portPool->getServerPortDataList())
     {
+        if (containsPort(m_destroyedServerPorts, &serverPortData))
+        {
+            continue;
+        }
+
         popo::ServerPortRouDi serverPort(serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
         {
@@ -756,6 +884,7 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_serviceRegistryChangesPublisherPortData.reset();
     }
     auto& publisherPorts = m_portPool->getPublisherPortDataList();
     auto publisherPort = publisherPorts.begin();
@@ -831,12 +960,40 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     }
 }
 
+void PortManager::removeWaitingSenderFromAllQueues(
+    const optional<build::InterProcessSemaphore>& senderWakeUpSemaphore) noexcept
+{
+    // only a sender with the WAIT_FOR_CONSUMER policy has a wake-up semaphore
+    if (!senderWakeUpSemaphore.has_value())
+    {
+        return;
+    }
+
+    for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
+    {
+        subscriberPortData.m_chunkReceiverData.m_waitingProducers.removeProducer(*senderWakeUpSemaphore);
+    }
+
+    for (auto& serverPortData : m_portPool->getServerPortDataList())
+    {
+        serverPortData.m_chunkReceiverData.m_waitingProducers.removeProducer(*senderWakeUpSemaphore);
+    }
+
+    for (auto& clientPortData : m_portPool->getClientPortDataList())
+    {
+        clientPortData.m_chunkReceiverData.m_waitingProducers.removeProducer(*senderWakeUpSemaphore);
+    }
+}
+
 void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
 {
     // create temporary publisher ports to orderly shut this publisher down
     PublisherPortRouDiType publisherPortRoudi{publisherPortData};
     PublisherPortUserType publisherPortUser{publisherPortData};
 
+    m_portPool->detachFromDiscoveryNotifier(*publisherPortData);
+    publisherPortRoudi.detachFromOwner();
+    removeWaitingSenderFromAllQueues(publisherPortData->m_chunkSenderData.m_senderWakeUpSemaphore);
     publisherPortUser.stopOffer();
 
     // process STOP_OFFER for this publisher in RouDi and distribute it
@@ -863,10 +1020,17 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
 
 void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
 {
+    if (containsPort(m_destroyedSubscriberPorts, subscriberPortData))
+    {
+        // the port is already destroyed and waits until its queue is not accessed anymore
+        return;
+    }
+
     // create temporary subscriber ports to orderly shut this subscriber down
     SubscriberPortType subscriberPortRoudi(subscriberPortData);
     SubscriberPortUserType subscriberPortUser(subscriberPortData);
 
+    m_portPool->detachFromDiscoveryNotifier(*subscriberPortData);
     subscriberPortUser.unsubscribe();
 
     // process UNSUB for this subscriber in RouDi and distribute it
@@ -877,10 +1041,26 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
         this->sendToAllMatchingPublisherPorts(caproMessage, subscriberPortRoudi);
     });
 
-    subscriberPortRoudi.releaseAllChunks();
-
     m_portIntrospection.removeSubscriber(subscriberPortUser);
 
+    if (isQueueOfSubscriberAccessible(*subscriberPortData))
+    {
+        IOX_LOG(Debug,
+                "The queue of the destroyed subscriber port from runtime '"
+                    << subscriberPortData->m_runtimeName << "' and with service description '"
+                    << subscriberPortData->m_serviceDescription
+                    << "' is still used by a publisher; the port is released later");
+        m_destroyedSubscriberPorts.push_back(subscriberPortData);
+        return;
+    }
+
+    releaseSubscriberPort(subscriberPortData);
+}
+
+void PortManager::releaseSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    SubscriberPortType(subscriberPortData).releaseAllChunks();
+
     IOX_LOG(Debug,
             "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
                                                      << "' and with service description '"
@@ -889,6 +1069,92 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
+void PortManager::publishPendingQueueChanges() noexcept
+{
+    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        PublisherPortRouDiType(&publisherPortData).publishPendingQueues();
+    }
+
+    for (auto& serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi(serverPortData).publishPendingQueues();
+    }
+
+    for (auto& clientPortData : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi(clientPortData).publishPendingQueues();
+    }
+}
+
+void PortManager::releaseDestroyedPorts() noexcept
+{
+    const auto releaseUnusedPorts = [](auto& destroyedPorts, auto isQueueAccessible, auto releasePort) {
+        uint64_t index{0U};
+        while (index < destroyedPorts.size())
+        {
+            auto* portData = destroyedPorts[index];
+            if (isQueueAccessible(*portData))
+            {
+                ++index;
+                continue;
+            }
+            releasePort(portData);
+            destroyedPorts.erase(destroyedPorts.begin() + index);
+        }
+    };
+
+    releaseUnusedPorts(
+        m_destroyedSubscriberPorts,
+        [this](const auto& portData) { return this->isQueueOfSubscriberAccessible(portData); },
+        [this](auto* portData) { this->releaseSubscriberPort(portData); });
+    releaseUnusedPorts(
+        m_destroyedClientPorts,
+        [this](const auto& portData) { return this->isQueueOfClientAccessible(portData); },
+        [this](auto* portData) { this->releaseClientPort(portData); });
+    releaseUnusedPorts(
+        m_destroyedServerPorts,
+        [this](const auto& portData) { return this->isQueueOfServerAccessible(portData); },
+        [this](auto* portData) { this->releaseServerPort(portData); });
+}
+
+bool PortManager::isQueueOfSubscriberAccessible(
+    const SubscriberPortType::MemberType_t& subscriberPortData) const noexcept
+{
+    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        if (PublisherPortRouDiType(&publisherPortData).isQueueAccessible(&subscriberPortData.m_chunkReceiverData))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PortManager::isQueueOfClientAccessible(const popo::ClientPortData& clientPortData) const noexcept
+{
+    for (auto& serverPortData : m_portPool->getServerPortDataList())
+    {
+        if (popo::ServerPortRouDi(serverPortData).isQueueAccessible(&clientPortData.m_chunkReceiverData))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PortManager::isQueueOfServerAccessible(const popo::ServerPortData& serverPortData) const noexcept
+{
+    for (auto& clientPortData : m_portPool->getClientPortDataList())
+    {
+        if (popo::ClientPortRouDi(clientPortData).isQueueAccessible(&serverPortData.m_chunkReceiverData))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
                                       const popo::PublisherOptions& publisherOptions,
@@ -1042,7 +1308,7 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
     {
         auto currentPort = port++;
 
-        if (service == currentPort->m_serviceDescription)
+        if (service == currentPort->m_serviceDescription && !containsPort(m_destroyedServerPorts, currentPort.to_ptr()))
         {
             if (currentPort->m_toBeDestroyed)
             {
@@ -1089,8 +1355,19 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
 
 void PortManager::publishServiceRegistry() noexcept
 {
-    if (!m_serviceRegistry.hasDataChangedSinceLastCall())
+    // the applications keep their registry up to date with the published changes; the complete registry is only
+    // published for subscribers which joined the service discovery or missed a change
+    if (!m_isServiceRegistrySnapshotRequested)
+    {
+        return;
+    }
+
+    const auto sequenceNumber = m_serviceRegistry.sequenceNumber();
+    if (m_publishedServiceRegistrySequenceNumber.has_value()
+        && m_publishedServiceRegistrySequenceNumber.value() == sequenceNumber)
     {
+        // the last published registry is still up to date and provided to late joiners by the history
+        m_isServiceRegistrySnapshotRequested = false;
         return;
     }
 
@@ -1112,8 +1389,13 @@ void PortManager::publishServiceRegistry() noexcept
             new (chunk->userPayload()) ServiceRegistry(m_serviceRegistry);
 
             publisher.sendChunk(chunk);
+            m_isServiceRegistrySnapshotRequested = false;
+            m_publishedServiceRegistrySequenceNumber.emplace(sequenceNumber);
         })
-        .or_else([](auto&) { IOX_LOG(Warn, "Could not allocate a chunk for the service registry!"); });
+        .or_else([](auto&) {
+            // the registry is published again in the next discovery loop
+            IOX_LOG(Warn, "Could not allocate a chunk for the service registry!");
+        });
 }
 
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
@@ -1121,30 +1403,83 @@ const ServiceRegistry& PortManager::serviceRegistry() const noexcept
     return m_serviceRegistry;
 }
 
+void PortManager::publishServiceRegistryChange(const uint64_t previousSequenceNumber,
+                                               const ServiceRegistryChange::Kind kind,
+                                               const capro::ServiceDescription& service) noexcept
+{
+    const auto sequenceNumber = m_serviceRegistry.sequenceNumber();
+    if (sequenceNumber == previousSequenceNumber)
+    {
+        return;
+    }
+
+    if (!m_serviceRegistryChangesPublisherPortData.has_value())
+    {
+        // only happens during RouDi startup and shutdown, the applications catch up with the complete registry
+        m_isServiceRegistrySnapshotRequested = true;
+        return;
+    }
+    PublisherPortUserType publisher(m_serviceRegistryChangesPublisherPortData.value());
+    const auto& changesSenderData = m_serviceRegistryChangesPublisherPortData.value()->m_chunkSenderData;
+    publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryChange),
+                          alignof(ServiceRegistryChange),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            auto change = new (chunk->userPayload()) ServiceRegistryChange();
+            change->sequenceNumber = sequenceNumber;
+            change->kind = kind;
+            change->serviceDescription = service;
+
+            const auto numberOfLostChunks = changesSenderData.m_numberOfLostChunks.load(std::memory_order_relaxed);
+            publisher.sendChunk(chunk);
+            // an overflowing queue drops a change; the application detects the gap in the sequence numbers and
+            // catches up with the complete registry
+            if (changesSenderData.m_numberOfLostChunks.load(std::memory_order_relaxed) != numberOfLostChunks)
+            {
+                m_isServiceRegistrySnapshotRequested = true;
+            }
+        })
+        .or_else([&](auto&) {
+            // the applications detect the gap in the sequence numbers and catch up with the complete registry
+            IOX_LOG(Warn, "Could not allocate a chunk for the service registry change!");
+            m_isServiceRegistrySnapshotRequested = true;
+        });
+}
+
 void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    const auto previousSequenceNumber = m_serviceRegistry.sequenceNumber();
     m_serviceRegistry.addPublisher(service).or_else([&](auto&) {
         IOX_LOG(Warn, "Could not add publisher with service description '" << service << "' to service registry!");
         IOX_REPORT(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, iox::er::RUNTIME_ERROR);
     });
+    publishServiceRegistryChange(previousSequenceNumber, ServiceRegistryChange::Kind::ADD_PUBLISHER, service);
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    const auto previousSequenceNumber = m_serviceRegistry.sequenceNumber();
     m_serviceRegistry.removePublisher(service);
+    publishServiceRegistryChange(previousSequenceNumber, ServiceRegistryChange::Kind::REMOVE_PUBLISHER, service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    const auto previousSequenceNumber = m_serviceRegistry.sequenceNumber();
     m_serviceRegistry.addServer(service).or_else([&](auto&) {
         IOX_LOG(Warn, "Could not add server with service description '" << service << "' to service registry!");
         IOX_REPORT(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, iox::er::RUNTIME_ERROR);
     });
+    publishServiceRegistryChange(previousSequenceNumber, ServiceRegistryChange::Kind::ADD_SERVER, service);
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    const auto previousSequenceNumber = m_serviceRegistry.sequenceNumber();
     m_serviceRegistry.removeServer(service);
+    publishServiceRegistryChange(previousSequenceNumber, ServiceRegistryChange::Kind::REMOVE_SERVER, service);
 }
 
 expected<popo::ConditionVariableData*, PortPoolError>
@@ -1153,6 +1488,14 @@ PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noex
     return m_portPool->addConditionVariableData(runtimeName);
 }
 
+bool PortManager::isServiceDiscoveryPort(const PublisherPortRouDiType::MemberType_t& publisherPortData) const noexcept
+{
+    return (m_serviceRegistryPublisherPortData.has_value()
+            && m_serviceRegistryPublisherPortData.value() == &publisherPortData)
+           || (m_serviceRegistryChangesPublisherPortData.has_value()
+               && m_serviceRegistryChangesPublisherPortData.value() == &publisherPortData);
+}
+
 bool PortManager::isInternal(const capro::ServiceDescription& service) const noexcept
 {
     for (auto& internalService : m_internalServices)
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/roudi/port_pool.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 
@@ -38,6 +39,39 @@ PortPoolData::CondVarContainer& PortPool::getConditionVariableDataList() noexcep
     return m_portPoolData->m_conditionVariableMembers;
 }
 
+popo::DiscoveryNotifierData& PortPool::getDiscoveryNotifierData() noexcept
+{
+    return m_portPoolData->m_discoveryNotifierData;
+}
+
+void PortPool::detachAllFromDiscoveryNotifier() noexcept
+{
+    for (auto& port : getPublisherPortDataList())
+    {
+        detachFromDiscoveryNotifier(port);
+    }
+    for (auto& port : getSubscriberPortDataList())
+    {
+        detachFromDiscoveryNotifier(port);
+    }
+    for (auto& port : getClientPortDataList())
+    {
+        detachFromDiscoveryNotifier(port);
+    }
+    for (auto& port : getServerPortDataList())
+    {
+        detachFromDiscoveryNotifier(port);
+    }
+    for (auto& port : getInterfacePortDataList())
+    {
+        detachFromDiscoveryNotifier(port);
+    }
+    for (auto& conditionVariable : getConditionVariableDataList())
+    {
+        detachFromDiscoveryNotifier(conditionVariable);
+    }
+}
+
 expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces commInterface) noexcept
 {
@@ -49,6 +83,11 @@ PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interf
         IOX_REPORT(PoshError::PORT_POOL__INTERFACELIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::INTERFACE_PORT_LIST_FULL);
     }
+    attachToDiscoveryNotifier(*interfacePortData,
+                              PortPoolData::INTERFACE_NOTIFICATION_OFFSET + interfacePortData.to_index());
+    // a new interface requires the initial forwarding of the offered services by the discovery
+    popo::DiscoveryNotifier(m_portPoolData->m_discoveryNotifierData, interfacePortData->m_discoveryNotificationIndex)
+        .notify();
     return ok(interfacePortData.to_ptr());
 }
 
@@ -62,6 +101,8 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
         IOX_REPORT(PoshError::PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::CONDITION_VARIABLE_LIST_FULL);
     }
+    attachToDiscoveryNotifier(*conditionVariableData,
+                              PortPoolData::CONDITION_VARIABLE_NOTIFICATION_OFFSET + conditionVariableData.to_index());
     return ok(conditionVariableData.to_ptr());
 }
 
@@ -102,6 +143,24 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::PUBLISHER_PORT_LIST_FULL);
     }
+
+    if (publisherOptions.chunkCacheSize > 0U)
+    {
+        auto memPoolCache = m_portPoolData->m_memPoolCaches.emplace(publisherOptions.chunkCacheSize);
+        if (memPoolCache == m_portPoolData->m_memPoolCaches.end())
+        {
+            IOX_LOG(Warn,
+                    "Out of mempool caches! The publisher of runtime '"
+                        << runtimeName << "' with service description '" << serviceDescription
+                        << "' acquires the chunks without a cache");
+        }
+        else
+        {
+            publisherPortData->m_chunkSenderData.m_memPoolCache = memPoolCache.to_ptr();
+        }
+    }
+    attachToDiscoveryNotifier(*publisherPortData,
+                              PortPoolData::PUBLISHER_NOTIFICATION_OFFSET + publisherPortData.to_index());
     return ok(publisherPortData.to_ptr());
 }
 
@@ -121,6 +180,22 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SUBSCRIBERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SUBSCRIBER_PORT_LIST_FULL);
     }
+
+    if (subscriberOptions.recordLatency)
+    {
+        auto latencyHistogram = m_portPoolData->m_latencyHistograms.emplace();
+        if (latencyHistogram == m_portPoolData->m_latencyHistograms.end())
+        {
+            IOX_LOG(Warn,
+                    "Out of latency histograms! The subscriber of runtime '"
+                        << runtimeName << "' with service description '" << serviceDescription
+                        << "' does not record the latency");
+        }
+        else
+        {
+            subscriberPortData->m_chunkReceiverData.m_latencyHistogram = latencyHistogram.to_ptr();
+        }
+    }
     return ok(subscriberPortData);
 }
 
@@ -151,6 +226,7 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__CLIENTLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
+    attachToDiscoveryNotifier(*clientPortData, PortPoolData::CLIENT_NOTIFICATION_OFFSET + clientPortData.to_index());
     return ok(clientPortData.to_ptr());
 }
 
@@ -171,16 +247,27 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SERVERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
+    attachToDiscoveryNotifier(*serverPortData, PortPoolData::SERVER_NOTIFICATION_OFFSET + serverPortData.to_index());
     return ok(serverPortData.to_ptr());
 }
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    const auto* memPoolCache = portData->m_chunkSenderData.m_memPoolCache.get();
+    if (memPoolCache != nullptr)
+    {
+        m_portPoolData->m_memPoolCaches.erase(memPoolCache);
+    }
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    const auto* latencyHistogram = portData->m_chunkReceiverData.m_latencyHistogram.get();
+    if (latencyHistogram != nullptr)
+    {
+        m_portPoolData->m_latencyHistograms.erase(latencyHistogram);
+    }
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
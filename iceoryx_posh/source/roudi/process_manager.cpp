@@ -102,37 +102,46 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
 
 void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) {
-            m_portManager.unblockProcessShutdown(name);
+    findPortOwner(name)
+        .and_then([&](const auto& owner) {
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                m_portManager.unblockProcessShutdown(name);
+            }
             // Reply with PREPARE_APP_TERMINATION_ACK and let process shutdown
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::PREPARE_APP_TERMINATION_ACK);
-            process->sendViaIpcChannel(sendBuffer);
+            sendToPortOwner(owner, sendBuffer);
         })
         .or_else([&]() { IOX_LOG(Warn, "Unknown application " << name << " requested shutdown preparation."); });
 }
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
-    // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
-    for (auto& process : m_processList)
     {
-        IOX_LOG(Debug, "Sending SIGTERM to Process ID " << process.getPid() << " named '" << process.getName());
-        requestShutdownOfProcess(process, ShutdownPolicy::SIG_TERM);
+        std::lock_guard<std::mutex> processListLock(m_processListMutex);
+        // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
+        for (auto& process : m_processList)
+        {
+            IOX_LOG(Debug, "Sending SIGTERM to Process ID " << process.getPid() << " named '" << process.getName());
+            requestShutdownOfProcess(process, ShutdownPolicy::SIG_TERM);
+        }
     }
 
     // this unblocks the RouDi shutdown if a publisher port is blocked by a full subscriber queue
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     m_portManager.unblockRouDiShutdown();
 }
 
 uint64_t ProcessManager::registeredProcessCount() const noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     return m_processList.size();
 }
 
 bool ProcessManager::probeRegisteredProcessesAliveWithSigTerm() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (probeProcessAliveWithSigTerm(process))
@@ -145,6 +154,7 @@ bool ProcessManager::probeRegisteredProcessesAliveWithSigTerm() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(Warn,
@@ -156,6 +166,7 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(Warn,
@@ -229,6 +240,7 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
 {
     bool returnValue{false};
 
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // process is already in list (i.e. registered)
@@ -325,6 +337,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
 bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 {
     constexpr TerminationFeedback FEEDBACK{TerminationFeedback::SEND_ACK_TO_PROCESS};
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     if (!searchForProcessAndRemoveIt(name, FEEDBACK))
     {
         IOX_LOG(Error, "Application " << name << " could not be unregistered!");
@@ -358,7 +371,10 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
-        m_portManager.deletePortsOfProcess(processIter->getName());
+        {
+            std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+            m_portManager.deletePortsOfProcess(processIter->getName());
+        }
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
         if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
@@ -382,10 +398,14 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 
 void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name, capro::Interfaces commInterface) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) {
+    findPortOwner(name)
+        .and_then([&](const auto& owner) {
             // create a ReceiverPort
-            popo::InterfacePortData* port = m_portManager.acquireInterfacePortData(commInterface, name);
+            popo::InterfacePortData* port{nullptr};
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                port = m_portManager.acquireInterfacePortData(commInterface, name);
+            }
 
             // send ReceiverPort to app as a serialized relative pointer
             auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, port);
@@ -393,7 +413,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name, capro::In
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_INTERFACE_ACK)
                        << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-            process->sendViaIpcChannel(sendBuffer);
+            sendToPortOwner(owner, sendBuffer);
 
             IOX_LOG(Debug, "Created new interface for application " << name);
         })
@@ -402,6 +422,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name, capro::In
 
 void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     findProcess(name).and_then([&](auto& process) {
         runtime::IpcMessage sendBuffer;
         sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
@@ -416,36 +437,11 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                                              const popo::SubscriberOptions& subscriberOptions,
                                              const PortConfigInfo& portConfigInfo) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (maybeSubscriber.has_value())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(Debug,
-                        "Created new SubscriberPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(Error,
-                        "Could not create SubscriberPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-            }
+    findPortOwner(name)
+        .and_then([&](const auto& owner) {
+            sendPortToProcess(owner,
+                              runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                              acquireSubscriberForProcess(owner, service, subscriberOptions, portConfigInfo));
         })
         .or_else([&]() {
             IOX_LOG(Warn,
@@ -459,70 +455,11 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
-
-            if (maybePublisher.has_value())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(Debug,
-                        "Created new PublisherPort for application '" << name << "' with service description '"
-                                                                      << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-
-                std::string error;
-                switch (maybePublisher.error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
-
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(Error,
-                        "Could not create PublisherPort for application '" << name << "' with service description '"
-                                                                           << service << "'");
-            }
+    findPortOwner(name)
+        .and_then([&](const auto& owner) {
+            sendPortToProcess(owner,
+                              runtime::IpcMessageType::CREATE_PUBLISHER_ACK,
+                              acquirePublisherForProcess(owner, service, publisherOptions, portConfigInfo));
         })
         .or_else([&]() {
             IOX_LOG(Warn,
@@ -536,47 +473,11 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                                          const popo::ClientOptions& clientOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) { // create a ClientPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            m_portManager
-                .acquireClientPortData(
-                    service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& clientPort) {
-                    auto relativePtrToClientPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
-                               << convert::toString(relativePtrToClientPort) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(Debug,
-                            "Created new ClientPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(Error,
-                            "Could not create ClientPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-                });
+    findPortOwner(name)
+        .and_then([&](const auto& owner) {
+            sendPortToProcess(owner,
+                              runtime::IpcMessageType::CREATE_CLIENT_ACK,
+                              acquireClientForProcess(owner, service, clientOptions, portConfigInfo));
         })
         .or_else([&]() {
             IOX_LOG(Warn,
@@ -590,47 +491,11 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                                          const popo::ServerOptions& serverOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    findProcess(name)
-        .and_then([&](auto& process) { // create a ServerPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            m_portManager
-                .acquireServerPortData(
-                    service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& serverPort) {
-                    auto relativePtrToServerPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
-                               << convert::toString(relativePtrToServerPort) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(Debug,
-                            "Created new ServerPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(Error,
-                            "Could not create ServerPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-                });
+    findPortOwner(name)
+        .and_then([&](const auto& owner) {
+            sendPortToProcess(owner,
+                              runtime::IpcMessageType::CREATE_SERVER_ACK,
+                              acquireServerForProcess(owner, service, serverOptions, portConfigInfo));
         })
         .or_else([&]() {
             IOX_LOG(Warn,
@@ -641,34 +506,288 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
-    findProcess(runtimeName)
-        .and_then([&](auto& process) { // Try to create a condition variable
-            m_portManager.acquireConditionVariableData(runtimeName)
-                .and_then([&](auto condVar) {
-                    auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, condVar);
+    findPortOwner(runtimeName)
+        .and_then([&](const auto& owner) {
+            sendPortToProcess(owner,
+                              runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK,
+                              acquireConditionVariableForProcess(owner));
+        })
+        .or_else([&]() { IOX_LOG(Warn, "Unknown application " << runtimeName << " requested a ConditionVariable."); });
+}
+
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name,
+                                        const span<const runtime::PortRequest> requests) noexcept
+{
+    findPortOwner(name)
+        .and_then([&](const auto& owner) {
+            // all ports are located in the management segment, therefore the segment id is sent only once
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_ACK)
+                       << convert::toString(m_mgmtSegmentId);
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(
-                        runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
-                               << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+            for (const auto& request : requests)
+            {
+                auto ackType = runtime::IpcMessageType::NOTYPE;
+                expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType> port =
+                    err(runtime::IpcMessageErrorType::NOTYPE);
 
-                    IOX_LOG(Debug, "Created new ConditionVariable for application " << runtimeName);
-                })
-                .or_else([&](PortPoolError error) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                    if (error == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
-                    {
-                        sendBuffer << runtime::IpcMessageErrorTypeToString(
-                            runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL);
-                    }
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(Debug, "Could not create new ConditionVariable for application " << runtimeName);
-                });
+                switch (request.m_type)
+                {
+                case runtime::IpcMessageType::CREATE_PUBLISHER:
+                    ackType = runtime::IpcMessageType::CREATE_PUBLISHER_ACK;
+                    port = acquirePublisherForProcess(owner,
+                                                      request.m_service,
+                                                      *request.m_options.get<popo::PublisherOptions>(),
+                                                      request.m_portConfigInfo);
+                    break;
+                case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+                    ackType = runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK;
+                    port = acquireSubscriberForProcess(owner,
+                                                       request.m_service,
+                                                       *request.m_options.get<popo::SubscriberOptions>(),
+                                                       request.m_portConfigInfo);
+                    break;
+                case runtime::IpcMessageType::CREATE_CLIENT:
+                    ackType = runtime::IpcMessageType::CREATE_CLIENT_ACK;
+                    port = acquireClientForProcess(owner,
+                                                   request.m_service,
+                                                   *request.m_options.get<popo::ClientOptions>(),
+                                                   request.m_portConfigInfo);
+                    break;
+                case runtime::IpcMessageType::CREATE_SERVER:
+                    ackType = runtime::IpcMessageType::CREATE_SERVER_ACK;
+                    port = acquireServerForProcess(owner,
+                                                   request.m_service,
+                                                   *request.m_options.get<popo::ServerOptions>(),
+                                                   request.m_portConfigInfo);
+                    break;
+                default:
+                    ackType = runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK;
+                    port = acquireConditionVariableForProcess(owner);
+                    break;
+                }
+
+                port.and_then([&](const auto offset) {
+                        sendBuffer << runtime::IpcMessageTypeToString(ackType) << convert::toString(offset);
+                    })
+                    .or_else([&](const auto error) {
+                        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE)
+                                   << runtime::IpcMessageErrorTypeToString(error);
+                    });
+            }
+
+            sendToPortOwner(owner, sendBuffer);
         })
-        .or_else([&]() { IOX_LOG(Warn, "Unknown application " << runtimeName << " requested a ConditionVariable."); });
+        .or_else([&]() { IOX_LOG(Warn, "Unknown application '" << name << "' requested multiple ports"); });
+}
+
+void ProcessManager::sendPortToProcess(
+    const PortOwner& owner,
+    const runtime::IpcMessageType ackType,
+    const expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>& port) noexcept
+{
+    runtime::IpcMessage sendBuffer;
+    port.and_then([&](const auto offset) {
+            sendBuffer << runtime::IpcMessageTypeToString(ackType) << convert::toString(offset)
+                       << convert::toString(m_mgmtSegmentId);
+        })
+        .or_else([&](const auto error) {
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE)
+                       << runtime::IpcMessageErrorTypeToString(error);
+        });
+    sendToPortOwner(owner, sendBuffer);
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireSubscriberForProcess(const PortOwner& owner,
+                                            const capro::ServiceDescription& service,
+                                            const popo::SubscriberOptions& subscriberOptions,
+                                            const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto& name = owner.name;
+    std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+    auto maybeSubscriber = m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+    portManagerLock.unlock();
+
+    if (maybeSubscriber.has_error())
+    {
+        IOX_LOG(Error,
+                "Could not create SubscriberPort for application '" << name << "' with service description '"
+                                                                    << service << "'");
+        return err(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+    }
+
+    IOX_LOG(Debug,
+            "Created new SubscriberPort for application '" << name << "' with service description '" << service
+                                                           << "'");
+    // the SubscriberPort is sent to the app as a serialized relative pointer
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value()));
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquirePublisherForProcess(const PortOwner& owner,
+                                           const capro::ServiceDescription& service,
+                                           const popo::PublisherOptions& publisherOptions,
+                                           const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto& name = owner.name;
+    optional<uint32_t> preferredNumaNode;
+    if (publisherOptions.preferredNumaNode != popo::PublisherOptions::NO_NUMA_NODE_PREFERENCE)
+    {
+        preferredNumaNode = publisherOptions.preferredNumaNode;
+    }
+    auto segmentInfo =
+        m_segmentManager->getSegmentInformationWithWriteAccessForUser(owner.user, preferredNumaNode);
+
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return err(runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    std::unique_lock<std::mutex> processListLock(m_processListMutex);
+    std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+    auto maybePublisher = m_portManager.acquirePublisherPortData(
+        service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+    // the heartbeat is read by the discovery, therefore it is set before the port manager is unlocked
+    maybePublisher.and_then(
+        [&](auto portData) { portData->m_chunkSenderData.m_senderHeartbeat = this->heartbeatOfPortOwner(owner); });
+    portManagerLock.unlock();
+    processListLock.unlock();
+
+    if (maybePublisher.has_error())
+    {
+        IOX_LOG(Error,
+                "Could not create PublisherPort for application '" << name << "' with service description '"
+                                                                   << service << "'");
+        switch (maybePublisher.error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+            return err(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+            return err(runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+        default:
+            return err(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+        }
+    }
+
+    IOX_LOG(Debug,
+            "Created new PublisherPort for application '" << name << "' with service description '" << service
+                                                          << "'");
+    // the PublisherPort is sent to the app as a serialized relative pointer
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value()));
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireClientForProcess(const PortOwner& owner,
+                                        const capro::ServiceDescription& service,
+                                        const popo::ClientOptions& clientOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto& name = owner.name;
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(owner.user);
+
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return err(runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    std::unique_lock<std::mutex> processListLock(m_processListMutex);
+    std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+    auto maybeClient = m_portManager.acquireClientPortData(
+        service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+    // the heartbeat is read by the discovery, therefore it is set before the port manager is unlocked
+    maybeClient.and_then(
+        [&](auto portData) { portData->m_chunkSenderData.m_senderHeartbeat = this->heartbeatOfPortOwner(owner); });
+    portManagerLock.unlock();
+    processListLock.unlock();
+
+    if (maybeClient.has_error())
+    {
+        IOX_LOG(Error,
+                "Could not create ClientPort for application '" << name << "' with service description '" << service
+                                                                << "'");
+        return err(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+    }
+
+    IOX_LOG(Debug,
+            "Created new ClientPort for application '" << name << "' with service description '" << service << "'");
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeClient.value()));
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireServerForProcess(const PortOwner& owner,
+                                        const capro::ServiceDescription& service,
+                                        const popo::ServerOptions& serverOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto& name = owner.name;
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(owner.user);
+
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return err(runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    std::unique_lock<std::mutex> processListLock(m_processListMutex);
+    std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+    auto maybeServer = m_portManager.acquireServerPortData(
+        service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+    // the heartbeat is read by the discovery, therefore it is set before the port manager is unlocked
+    maybeServer.and_then(
+        [&](auto portData) { portData->m_chunkSenderData.m_senderHeartbeat = this->heartbeatOfPortOwner(owner); });
+    portManagerLock.unlock();
+    processListLock.unlock();
+
+    if (maybeServer.has_error())
+    {
+        IOX_LOG(Error,
+                "Could not create ServerPort for application '" << name << "' with service description '" << service
+                                                                << "'");
+        return err(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
+    }
+
+    IOX_LOG(Debug,
+            "Created new ServerPort for application '" << name << "' with service description '" << service << "'");
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeServer.value()));
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::acquireConditionVariableForProcess(const PortOwner& owner) noexcept
+{
+    const auto& runtimeName = owner.name;
+    std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+    auto maybeConditionVariable = m_portManager.acquireConditionVariableData(runtimeName);
+    portManagerLock.unlock();
+
+    if (maybeConditionVariable.has_error())
+    {
+        IOX_LOG(Debug, "Could not create new ConditionVariable for application " << runtimeName);
+        return err(runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL);
+    }
+
+    IOX_LOG(Debug, "Created new ConditionVariable for application " << runtimeName);
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeConditionVariable.value()));
+}
+
+runtime::Heartbeat* ProcessManager::heartbeatOfProcess(const Process& process) noexcept
+{
+    if (!process.isMonitored())
+    {
+        return nullptr;
+    }
+
+    auto heartbeatIter = m_heartbeatPool->iter_from_index(process.getHeartbeatPoolIndex());
+    return (heartbeatIter != m_heartbeatPool->end()) ? heartbeatIter.to_ptr() : nullptr;
+}
+
+runtime::Heartbeat* ProcessManager::heartbeatOfPortOwner(const PortOwner& owner) noexcept
+{
+    runtime::Heartbeat* heartbeat{nullptr};
+    findProcess(owner.name).and_then([&](auto& process) { heartbeat = this->heartbeatOfProcess(*process); });
+    return heartbeat;
 }
 
 void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept
@@ -688,6 +807,7 @@ ProcessManager::addIntrospectionPublisherPort(const capro::ServiceDescription& s
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
     options.nodeName = INTROSPECTION_NODE_NAME;
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     return m_portManager.acquireInternalPublisherPortData(service, options, m_introspectionMemoryManager);
 }
 
@@ -704,11 +824,36 @@ optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexce
     return nullopt;
 }
 
+optional<ProcessManager::PortOwner> ProcessManager::findPortOwner(const RuntimeName_t& name) noexcept
+{
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    optional<PortOwner> owner;
+    findProcess(name).and_then([&](auto& process) {
+        owner.emplace(PortOwner{process->getName(), process->getUser()});
+    });
+    return owner;
+}
+
+void ProcessManager::sendToPortOwner(const PortOwner& owner, const runtime::IpcMessage& message) noexcept
+{
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    findProcess(owner.name)
+        .and_then([&](auto& process) { process->sendViaIpcChannel(message); })
+        .or_else([&]() {
+            // the process was removed by the monitoring after its ports were created; a new process with the same
+            // name cannot have registered in the meantime, since the messages of one process are processed in order
+            IOX_LOG(Warn, "Application " << owner.name << " was removed while its request was processed");
+            std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+            m_portManager.deletePortsOfProcess(owner.name);
+        });
+}
+
 void ProcessManager::monitorProcesses() noexcept
 {
     static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                   "keep alive timeout too small");
     auto timeout = runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     auto heartbeatIterator = m_heartbeatPool->begin();
     while (heartbeatIterator != m_heartbeatPool->end())
     {
@@ -747,6 +892,7 @@ void ProcessManager::monitorProcesses() noexcept
 
 void ProcessManager::discoveryUpdate() noexcept
 {
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     m_portManager.doDiscovery();
 }
 
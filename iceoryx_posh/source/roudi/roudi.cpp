@@ -17,16 +17,22 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_listener.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
-#include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
+#include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/detail/system_configuration.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_user.hpp"
 #include "iox/std_string_support.hpp"
 #include "iox/thread.hpp"
+#include "iox/vector.hpp"
+
+#include <functional>
+#include <string>
 
 namespace iox
 {
@@ -40,23 +46,19 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_runHandleRuntimeMessageThread(true)
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               m_roudiConfig.domainId,
-               m_roudiConfig.compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, m_roudiConfig.domainId, m_roudiConfig.compatibilityCheckLevel)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
+          PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService)))
 {
     if (detail::isCompiledOn32BitSystem())
     {
         IOX_LOG(Warn, "Runnning RouDi on 32-bit architectures is experimental! Use at your own risk!");
     }
     m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -83,6 +85,35 @@ RouDi::~RouDi() noexcept
 
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
+    auto numberOfWorkers = m_roudiConfig.runtimeMessageWorkerCount;
+    if (numberOfWorkers == 0U || numberOfWorkers > MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS)
+    {
+        numberOfWorkers = (numberOfWorkers == 0U) ? 1U : MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS;
+        IOX_LOG(Warn,
+                "The runtime message worker count of " << m_roudiConfig.runtimeMessageWorkerCount
+                                                       << " is out of range! Using " << numberOfWorkers
+                                                       << " worker(s) instead.");
+    }
+
+    // with a single worker the messages are processed directly by the receiving thread
+    if (numberOfWorkers > 1U)
+    {
+        for (uint32_t i = 0U; i < numberOfWorkers; ++i)
+        {
+            m_runtimeMessageWorkers.emplace_back();
+            UnnamedSemaphoreBuilder()
+                .initialValue(0U)
+                .isInterProcessCapable(false)
+                .create(m_runtimeMessageWorkers.back().wakeupSemaphore)
+                .expect("Valid Semaphore");
+        }
+
+        for (uint32_t i = 0U; i < numberOfWorkers; ++i)
+        {
+            m_runtimeMessageWorkers[i].thread = std::thread(&RouDi::processDispatchedRuntimeMessages, this, i);
+        }
+    }
+
     m_handleRuntimeMessageThread =
         std::thread(&RouDi::processRuntimeMessages,
                     this,
@@ -96,7 +127,7 @@ void RouDi::shutdown() noexcept
     // trigger the shutdown of the monitoring and discovery thread in order to prevent application to register while
     // shutting down
     m_runMonitoringAndDiscoveryThread = false;
-    m_discoveryLoopTrigger.trigger();
+    popo::DiscoveryListener(m_portManager->discoveryNotifierData()).wakeUp();
 
     // stop the introspection
     m_processIntrospection.stop();
@@ -111,12 +142,16 @@ void RouDi::shutdown() noexcept
         IOX_LOG(Debug, "...'Mon+Discover' thread joined.");
     }
 
+    // nobody listens to the notifications anymore; the ports are still shut down and must not access the notifier
+    // since another RouDi in the same process might already have unregistered all segments
+    m_portManager->stopDiscoveryNotifications();
+
     if (!m_roudiConfig.sharesAddressSpaceWithApplications)
     {
         deadline_timer terminationDelayTimer(m_roudiConfig.processTerminationDelay);
         using namespace units::duration_literals;
         auto remainingDurationForInfoPrint = m_roudiConfig.processTerminationDelay - 1_s;
-        while (!terminationDelayTimer.hasExpired() && m_prcMgr->registeredProcessCount() > 0)
+        while (!terminationDelayTimer.hasExpired() && m_prcMgr.registeredProcessCount() > 0)
         {
             if (remainingDurationForInfoPrint > terminationDelayTimer.remainingTime())
             {
@@ -128,11 +163,11 @@ void RouDi::shutdown() noexcept
             std::this_thread::sleep_for(std::chrono::milliseconds(PROCESS_TERMINATED_CHECK_INTERVAL.toMilliseconds()));
         }
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         deadline_timer finalKillTimer(m_roudiConfig.processKillDelay);
         auto remainingDurationForWarnPrint = m_roudiConfig.processKillDelay - 2_s;
-        while (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -146,15 +181,15 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm() && finalKillTimer.hasExpired())
+        if (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm())
+        if (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
@@ -167,6 +202,28 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         IOX_LOG(Debug, "...'IPC-msg-process' thread joined.");
     }
+
+    stopRuntimeMessageWorkers();
+}
+
+void RouDi::stopRuntimeMessageWorkers() noexcept
+{
+    // the receiving thread is already joined, therefore no further messages are dispatched and the workers process
+    // the remaining messages before they stop
+    m_runRuntimeMessageWorkers = false;
+
+    for (auto& worker : m_runtimeMessageWorkers)
+    {
+        IOX_DISCARD_RESULT(worker.wakeupSemaphore->post());
+    }
+
+    for (auto& worker : m_runtimeMessageWorkers)
+    {
+        if (worker.thread.joinable())
+        {
+            worker.thread.join();
+        }
+    }
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -189,7 +246,8 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
                             << static_cast<uint32_t>(error));
             });
     }
-    m_discoveryLoopTrigger.trigger();
+    m_discoveryLoopTriggered.store(true);
+    popo::DiscoveryListener(m_portManager->discoveryNotifierData()).wakeUp();
     m_discoveryFinishedSemaphore->timedWait(timeout).or_else([](const auto& error) {
         IOX_LOG(Error,
                 "A timed wait on the semaphore which signals a finished run of the "
@@ -202,23 +260,14 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
-    {
-      public:
-        DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
-            : WaitSet(condVarData)
-        {
-        }
-    };
-
-    popo::ConditionVariableData conditionVariableData;
-    DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    // the ports notify the listener about their requests, therefore the discovery runs immediately after a request;
+    // the timeout is only required for the cyclic monitoring of the processes
+    popo::DiscoveryListener discoveryListener(m_portManager->discoveryNotifierData());
     bool manuallyTriggered{false};
 
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        m_prcMgr.run();
 
         cyclicUpdateHook();
 
@@ -231,15 +280,8 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
             });
         }
 
-        manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
-        {
-            if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
-            {
-                manuallyTriggered = true;
-                break;
-            }
-        }
+        IOX_DISCARD_RESULT(discoveryListener.timedWait(DISCOVERY_INTERVAL));
+        manuallyTriggered = m_discoveryLoopTriggered.exchange(false);
     }
 }
 
@@ -260,14 +302,73 @@ void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterf
         runtime::IpcMessage message;
         if (roudiIpc.timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+            if (m_runtimeMessageWorkers.empty())
+            {
+                processRuntimeMessage(message);
+            }
+            else
+            {
+                dispatchRuntimeMessage(std::move(message));
+            }
+        }
+    }
+}
+
+void RouDi::dispatchRuntimeMessage(runtime::IpcMessage&& message) noexcept
+{
+    // a registration must not be overtaken by a request of the same runtime, therefore the workers are sharded by
+    // the runtime name instead of taking the messages from a shared queue
+    const auto workerIndex = std::hash<std::string>{}(message.getElementAtIndex(1)) % m_runtimeMessageWorkers.size();
+    auto& worker = m_runtimeMessageWorkers[workerIndex];
+
+    iox::detail::adaptive_wait adaptiveWait;
+    while (!worker.messages.tryPush(std::move(message)))
+    {
+        if (!m_runHandleRuntimeMessageThread)
+        {
+            IOX_LOG(Warn, "Dropping runtime message since RouDi is shutting down!");
+            return;
+        }
+        adaptiveWait.wait();
+    }
+
+    worker.wakeupSemaphore->post().or_else([](const auto& error) {
+        IOX_LOG(Error, "Could not wake up the runtime message worker! Error: " << static_cast<uint32_t>(error));
+    });
+}
+
+void RouDi::processDispatchedRuntimeMessages(const uint32_t workerIndex) noexcept
+{
+    setThreadName(into<lossy<ThreadName_t>>(std::string("IPC-msg-") + convert::toString(workerIndex)));
+
+    auto& worker = m_runtimeMessageWorkers[workerIndex];
+    bool keepRunning{true};
+    while (keepRunning)
+    {
+        // load the flag before draining the queue in order to process all messages which were dispatched before the
+        // shutdown
+        keepRunning = m_runRuntimeMessageWorkers.load();
+
+        for (auto message = worker.messages.pop(); message.has_value(); message = worker.messages.pop())
+        {
+            processRuntimeMessage(message.value());
+        }
 
-            processMessage(message, cmd, runtimeName);
+        if (keepRunning)
+        {
+            IOX_DISCARD_RESULT(worker.wakeupSemaphore->timedWait(m_runtimeMessagesThreadTimeout));
         }
     }
 }
 
+void RouDi::processRuntimeMessage(const runtime::IpcMessage& message) noexcept
+{
+    auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
+    RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+
+    processMessage(message, cmd, runtimeName);
+}
+
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
                                                  uint32_t& pid,
                                                  iox_uid_t& userId,
@@ -286,6 +387,63 @@ version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& mess
     return serializationVersionInfo;
 }
 
+optional<runtime::PortRequest> RouDi::parsePortRequest(const runtime::IpcMessage& message,
+                                                      const uint32_t index) noexcept
+{
+    const auto type = runtime::stringToIpcMessageType(message.getElementAtIndex(index).c_str());
+    if (type == runtime::IpcMessageType::CREATE_CONDITION_VARIABLE)
+    {
+        return runtime::PortRequest::conditionVariable();
+    }
+
+    auto deserializationResult =
+        capro::ServiceDescription::deserialize(Serialization(message.getElementAtIndex(index + 1U)));
+    if (deserializationResult.has_error())
+    {
+        IOX_LOG(Error,
+                "Deserialization failed when '" << message.getElementAtIndex(index + 1U).c_str() << "' was provided\n");
+        return nullopt;
+    }
+    const auto& service = deserializationResult.value();
+
+    const auto serializedOptions = message.getElementAtIndex(index + 2U);
+    const runtime::PortConfigInfo portConfigInfo{Serialization(message.getElementAtIndex(index + 3U))};
+
+    switch (type)
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+        if (auto options = popo::PublisherOptions::deserialize(Serialization(serializedOptions)); !options.has_error())
+        {
+            return runtime::PortRequest::publisher(service, options.value(), portConfigInfo);
+        }
+        break;
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+        if (auto options = popo::SubscriberOptions::deserialize(Serialization(serializedOptions)); !options.has_error())
+        {
+            return runtime::PortRequest::subscriber(service, options.value(), portConfigInfo);
+        }
+        break;
+    case runtime::IpcMessageType::CREATE_CLIENT:
+        if (auto options = popo::ClientOptions::deserialize(Serialization(serializedOptions)); !options.has_error())
+        {
+            return runtime::PortRequest::client(service, options.value(), portConfigInfo);
+        }
+        break;
+    case runtime::IpcMessageType::CREATE_SERVER:
+        if (auto options = popo::ServerOptions::deserialize(Serialization(serializedOptions)); !options.has_error())
+        {
+            return runtime::PortRequest::server(service, options.value(), portConfigInfo);
+        }
+        break;
+    default:
+        IOX_LOG(Error, "Unsupported port type '" << message.getElementAtIndex(index).c_str() << "' was provided");
+        return nullopt;
+    }
+
+    IOX_LOG(Error, "Deserialization of the options failed when '" << serializedOptions.c_str() << "' was provided");
+    return nullopt;
+}
+
 void RouDi::processMessage(const runtime::IpcMessage& message,
                            const iox::runtime::IpcMessageType& cmd,
                            const RuntimeName_t& runtimeName) noexcept
@@ -365,7 +523,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addPublisherForProcess(
+            m_prcMgr.addPublisherForProcess(
                 runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -404,7 +562,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addSubscriberForProcess(
+            m_prcMgr.addSubscriberForProcess(
                 runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -443,7 +601,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
         }
         break;
     }
@@ -481,7 +639,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
         }
         break;
     }
@@ -495,7 +653,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName);
         }
         break;
     }
@@ -512,7 +670,39 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             capro::Interfaces commInterface =
                 StringToCaProInterface(into<lossy<capro::IdString_t>>(message.getElementAtIndex(2)));
 
-            m_prcMgr->addInterfaceForProcess(runtimeName, commInterface);
+            m_prcMgr.addInterfaceForProcess(runtimeName, commInterface);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        // the runtime name is followed by the type, service description, options and port config info of each port
+        constexpr uint32_t NUMBER_OF_ENTRIES_PER_PORT{4U};
+        const uint32_t numberOfEntries = message.getNumberOfElements() - 2U;
+        const uint32_t numberOfPorts = numberOfEntries / NUMBER_OF_ENTRIES_PER_PORT;
+        if (message.getNumberOfElements() < 2U + NUMBER_OF_ENTRIES_PER_PORT
+            || numberOfEntries % NUMBER_OF_ENTRIES_PER_PORT != 0U || numberOfPorts > MAX_PORT_REQUESTS_PER_MESSAGE)
+        {
+            IOX_LOG(Error,
+                    "Wrong number of parameters for \"IpcMessageType::CREATE_PORTS\" from \"" << runtimeName
+                                                                                              << "\"received!");
+            break;
+        }
+
+        vector<runtime::PortRequest, MAX_PORT_REQUESTS_PER_MESSAGE> requests;
+        for (uint32_t i = 0U; i < numberOfPorts; ++i)
+        {
+            auto request = parsePortRequest(message, 2U + i * NUMBER_OF_ENTRIES_PER_PORT);
+            if (!request.has_value())
+            {
+                break;
+            }
+            requests.emplace_back(std::move(request.value()));
+        }
+
+        if (requests.size() == numberOfPorts)
+        {
+            m_prcMgr.addPortsForProcess(runtimeName, span<const runtime::PortRequest>(requests));
         }
         break;
     }
@@ -527,7 +717,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName);
         }
         break;
     }
@@ -541,7 +731,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
         }
         break;
     }
@@ -549,7 +739,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         IOX_LOG(Error, "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]");
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
         break;
     }
     }
@@ -565,13 +755,14 @@ void RouDi::registerProcess(const RuntimeName_t& name,
     bool monitorProcess = (m_roudiConfig.monitoringMode == roudi::MonitoringMode::ON
                            && !m_roudiConfig.sharesAddressSpaceWithApplications);
     IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+        m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
-    return ++sessionId;
+    // the registrations of different runtimes are processed concurrently by the runtime message workers
+    static concurrent::Atomic<uint64_t> sessionId{0U};
+    return sessionId.fetch_add(1U, std::memory_order_relaxed) + 1U;
 }
 
 void RouDi::IpcMessageErrorHandler() noexcept
@@ -23,6 +23,7 @@
 #include "iox/into.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_group.hpp"
+#include "iox/posix_shared_memory_object.hpp"
 #include "iox/std_string_support.hpp"
 #include "iox/string.hpp"
 #include "iox/vector.hpp"
@@ -36,6 +37,42 @@ namespace iox
 {
 namespace config
 {
+namespace
+{
+iox::expected<iox::mepoo::SharedMemoryOptions, iox::roudi::RouDiConfigFileParseError>
+parseSharedMemoryOptions(const cpptoml::table& table) noexcept
+{
+    iox::mepoo::SharedMemoryOptions options;
+    options.transparentHugePages = table.get_as<bool>("transparent_huge_pages").value_or(options.transparentHugePages);
+    options.lockMemory = table.get_as<bool>("lock_memory").value_or(options.lockMemory);
+
+    auto prefaultThreadCount = table.get_as<int64_t>("prefault_threads").value_or(options.prefaultThreadCount);
+    if (prefaultThreadCount < 1
+        || prefaultThreadCount > static_cast<int64_t>(PosixSharedMemoryObjectBuilder::MAX_PREFAULT_THREAD_COUNT))
+    {
+        return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_PREFAULT_THREAD_COUNT);
+    }
+    options.prefaultThreadCount = static_cast<uint32_t>(prefaultThreadCount);
+
+    auto numaPolicy = table.get_as<std::string>("numa_policy").value_or("default");
+    if (numaPolicy == "bind")
+    {
+        options.numaPolicy = NumaPolicy::BIND;
+    }
+    else if (numaPolicy == "interleave")
+    {
+        options.numaPolicy = NumaPolicy::INTERLEAVE;
+    }
+    else if (numaPolicy != "default")
+    {
+        return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_POLICY);
+    }
+    options.numaNode = table.get_as<uint32_t>("numa_node").value_or(options.numaNode);
+
+    return iox::ok(options);
+}
+} // namespace
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(config::CmdLineArgs_t& cmdLineArgs) noexcept
 {
     /// don't print additional output if not running
@@ -143,11 +180,39 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
 
     auto groupOfCurrentProcess = PosixGroup::getGroupOfCurrentProcess().getName();
     iox::IceoryxConfig parsedConfig;
+
+    auto management = parsedFile->get_table("management");
+    if (management)
+    {
+        auto managementOptions = parseSharedMemoryOptions(*management);
+        if (managementOptions.has_error())
+        {
+            return iox::err(managementOptions.error());
+        }
+        parsedConfig.m_managementSharedMemoryOptions = managementOptions.value();
+    }
+
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
         iox::mepoo::MePooConfig mempoolConfig;
+        auto fallbackPolicy = segment->get_as<std::string>("mempool_fallback").value_or("none");
+        if (fallbackPolicy == "next_larger")
+        {
+            mempoolConfig.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL;
+        }
+        else if (fallbackPolicy != "none")
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_FALLBACK_POLICY);
+        }
+
+        auto sharedMemoryOptions = parseSharedMemoryOptions(*segment);
+        if (sharedMemoryOptions.has_error())
+        {
+            return iox::err(sharedMemoryOptions.error());
+        }
+
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -176,7 +241,9 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         parsedConfig.m_sharedMemorySegments.push_back(
             {PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             sharedMemoryOptions.value()});
     }
 
     return iox::ok(parsedConfig);
@@ -21,11 +21,68 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+constexpr uint32_t FNV_OFFSET_BASIS{2166136261U};
+constexpr uint32_t FNV_PRIME{16777619U};
+
+/// @brief 32 bit FNV-1a hash of an id
+uint32_t hashId(const capro::IdString_t& id) noexcept
+{
+    uint32_t hash{FNV_OFFSET_BASIS};
+    const char* characters = id.c_str();
+    for (uint64_t i = 0U; i < id.size(); ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounded by the size of the string
+        hash ^= static_cast<uint8_t>(characters[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t combineHashes(const uint32_t seed, const uint32_t value) noexcept
+{
+    // NOLINTNEXTLINE(readability-magic-numbers) golden ratio constant which is also used by boost::hash_combine
+    return seed ^ (value + 0x9e3779b9U + (seed << 6U) + (seed >> 2U));
+}
+
+uint32_t hashKey(const uint32_t serviceHash, const uint32_t instanceHash, const uint32_t eventHash) noexcept
+{
+    return combineHashes(combineHashes(serviceHash, instanceHash), eventHash);
+}
+
+uint32_t hashKey(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return hashKey(hashId(serviceDescription.getServiceIDString()),
+                   hashId(serviceDescription.getInstanceIDString()),
+                   hashId(serviceDescription.getEventIDString()));
+}
+
+bool matches(const ServiceRegistry::ServiceDescriptionEntry& entry,
+             const optional<capro::IdString_t>& service,
+             const optional<capro::IdString_t>& instance,
+             const optional<capro::IdString_t>& event) noexcept
+{
+    bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+    match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+    match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+    return match;
+}
+} // namespace
+
 ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::ServiceDescription& serviceDescription)
     : serviceDescription(serviceDescription)
 {
 }
 
+ServiceRegistry::ServiceRegistry() noexcept
+{
+    for (auto& slot : m_lookup)
+    {
+        slot = NO_INDEX;
+    }
+}
+
 expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
                                                             ReferenceCounter_t ServiceDescriptionEntry::*count)
 {
@@ -37,47 +94,32 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         // entry exists, increment counter
         auto& entry = m_serviceDescriptions[index];
         ((*entry).*count)++;
-        m_dataChanged = true;
+        changed();
         return ok();
     }
 
-    // entry does not exist, find a free slot if it exists
-
-    // fast path to a free slot (which was occupied by previously removed entry),
-    // prefer to fill entries close to the front
-    if (m_freeIndex != NO_INDEX)
+    // entry does not exist, reuse a slot which was occupied by a previously removed entry if there is any
+    if (!m_freeIndices.empty())
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        m_freeIndex = NO_INDEX;
-        return ok();
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
     }
-
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
+    // append new entry at the end (the size only grows up to capacity)
+    else if (m_serviceDescriptions.emplace_back())
     {
-        if (!entry)
-        {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            m_dataChanged = true;
-            return ok();
-        }
+        index = static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
     }
-
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    else
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        return ok();
+        return err(Error::SERVICE_REGISTRY_FULL);
     }
 
-    return err(Error::SERVICE_REGISTRY_FULL);
+    auto& entry = m_serviceDescriptions[index];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+    addToIndices(index);
+    changed();
+    return ok();
 }
 
 expected<void, ServiceRegistry::Error>
@@ -103,10 +145,11 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                remove(index);
+            }
+            else
+            {
+                changed();
             }
         }
     }
@@ -123,10 +166,11 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                remove(index);
+            }
+            else
+            {
+                changed();
             }
         }
     }
@@ -137,48 +181,178 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
-        m_dataChanged = true;
+        remove(index);
     }
 }
 
+void ServiceRegistry::remove(const uint32_t index) noexcept
+{
+    removeFromIndices(index);
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndices.push_back(index);
+    changed();
+}
+
+void ServiceRegistry::changed() noexcept
+{
+    ++m_sequenceNumber;
+    m_dataChanged = true;
+}
+
 void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& instance,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    if (service && instance && event)
     {
-        if (entry)
+        auto index = findIndex(capro::ServiceDescription(*service, *instance, *event));
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
 
-            if (match)
+    // with at least one wildcard, the smallest bucket of the ids which are not a wildcard is searched
+    uint32_t searchId{NUMBER_OF_IDS};
+    const Bucket* searchBucket{nullptr};
+    auto selectBucket = [&](const uint32_t id, const optional<capro::IdString_t>& value) {
+        if (value)
+        {
+            const auto& bucket = m_buckets[id][hashId(*value) & (NUMBER_OF_BUCKETS - 1U)];
+            if (searchBucket == nullptr || bucket.size < searchBucket->size)
             {
-                callable(*entry);
+                searchBucket = &bucket;
+                searchId = id;
             }
         }
+    };
+    selectBucket(SERVICE_ID, service);
+    selectBucket(INSTANCE_ID, instance);
+    selectBucket(EVENT_ID, event);
+
+    if (searchBucket == nullptr)
+    {
+        // only wildcards, every entry matches
+        forEach(callable);
+        return;
+    }
+
+    for (auto index = searchBucket->head; index != NO_INDEX; index = m_indexNodes[index].next[searchId])
+    {
+        const auto& entry = m_serviceDescriptions[index];
+        // different ids can end up in the same bucket
+        if (matches(*entry, service, instance, event))
+        {
+            callable(*entry);
+        }
     }
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    const auto keyHash = hashKey(serviceDescription);
+    // the load factor of at most 0.5 guarantees that the probing ends at an empty slot
+    for (auto slot = keyHash & (LOOKUP_CAPACITY - 1U); m_lookup[slot] != NO_INDEX;
+         slot = (slot + 1U) & (LOOKUP_CAPACITY - 1U))
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        const auto index = m_lookup[slot];
+        if (m_indexNodes[index].keyHash == keyHash
+            && m_serviceDescriptions[index]->serviceDescription == serviceDescription)
         {
-            return i;
+            return index;
         }
     }
     return NO_INDEX;
 }
 
+void ServiceRegistry::addToIndices(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    auto& node = m_indexNodes[index];
+    node.idHashes[SERVICE_ID] = hashId(serviceDescription.getServiceIDString());
+    node.idHashes[INSTANCE_ID] = hashId(serviceDescription.getInstanceIDString());
+    node.idHashes[EVENT_ID] = hashId(serviceDescription.getEventIDString());
+    node.keyHash = hashKey(node.idHashes[SERVICE_ID], node.idHashes[INSTANCE_ID], node.idHashes[EVENT_ID]);
+
+    auto slot = node.keyHash & (LOOKUP_CAPACITY - 1U);
+    while (m_lookup[slot] != NO_INDEX)
+    {
+        slot = (slot + 1U) & (LOOKUP_CAPACITY - 1U);
+    }
+    m_lookup[slot] = index;
+
+    // append to the buckets in order to visit the entries in the order they were added
+    for (uint32_t id = 0U; id < NUMBER_OF_IDS; ++id)
+    {
+        auto& bucket = m_buckets[id][node.idHashes[id] & (NUMBER_OF_BUCKETS - 1U)];
+        node.next[id] = NO_INDEX;
+        node.previous[id] = bucket.tail;
+        if (bucket.tail == NO_INDEX)
+        {
+            bucket.head = index;
+        }
+        else
+        {
+            m_indexNodes[bucket.tail].next[id] = index;
+        }
+        bucket.tail = index;
+        ++bucket.size;
+    }
+}
+
+void ServiceRegistry::removeFromIndices(const uint32_t index) noexcept
+{
+    auto& node = m_indexNodes[index];
+
+    auto emptySlot = node.keyHash & (LOOKUP_CAPACITY - 1U);
+    while (m_lookup[emptySlot] != index)
+    {
+        emptySlot = (emptySlot + 1U) & (LOOKUP_CAPACITY - 1U);
+    }
+
+    // backward shift deletion, the following entries of the probe sequence are moved into the empty slot unless
+    // their home slot lies behind it; this keeps all probe sequences intact without the need for tombstones
+    for (auto slot = (emptySlot + 1U) & (LOOKUP_CAPACITY - 1U); m_lookup[slot] != NO_INDEX;
+         slot = (slot + 1U) & (LOOKUP_CAPACITY - 1U))
+    {
+        const auto homeSlot = m_indexNodes[m_lookup[slot]].keyHash & (LOOKUP_CAPACITY - 1U);
+        const bool isHomeSlotBetween = (emptySlot <= slot) ? (emptySlot < homeSlot && homeSlot <= slot)
+                                                           : (emptySlot < homeSlot || homeSlot <= slot);
+        if (!isHomeSlotBetween)
+        {
+            m_lookup[emptySlot] = m_lookup[slot];
+            emptySlot = slot;
+        }
+    }
+    m_lookup[emptySlot] = NO_INDEX;
+
+    for (uint32_t id = 0U; id < NUMBER_OF_IDS; ++id)
+    {
+        auto& bucket = m_buckets[id][node.idHashes[id] & (NUMBER_OF_BUCKETS - 1U)];
+        if (node.previous[id] == NO_INDEX)
+        {
+            bucket.head = node.next[id];
+        }
+        else
+        {
+            m_indexNodes[node.previous[id]].next[id] = node.next[id];
+        }
+
+        if (node.next[id] == NO_INDEX)
+        {
+            bucket.tail = node.previous[id];
+        }
+        else
+        {
+            m_indexNodes[node.next[id]].previous[id] = node.previous[id];
+        }
+        --bucket.size;
+    }
+}
+
 void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
     for (auto& entry : m_serviceDescriptions)
@@ -197,5 +371,37 @@ bool ServiceRegistry::hasDataChangedSinceLastCall() noexcept
     return dataChanged;
 }
 
+uint64_t ServiceRegistry::sequenceNumber() const noexcept
+{
+    return m_sequenceNumber;
+}
+
+bool ServiceRegistry::applyChange(const ServiceRegistryChange& change) noexcept
+{
+    if (change.sequenceNumber != m_sequenceNumber + 1U)
+    {
+        return false;
+    }
+
+    switch (change.kind)
+    {
+    case ServiceRegistryChange::Kind::ADD_PUBLISHER:
+        IOX_DISCARD_RESULT(addPublisher(change.serviceDescription));
+        break;
+    case ServiceRegistryChange::Kind::REMOVE_PUBLISHER:
+        removePublisher(change.serviceDescription);
+        break;
+    case ServiceRegistryChange::Kind::ADD_SERVER:
+        IOX_DISCARD_RESULT(addServer(change.serviceDescription));
+        break;
+    case ServiceRegistryChange::Kind::REMOVE_SERVER:
+        removeServer(change.serviceDescription);
+        break;
+    }
+
+    // the copy only stays in sync with the origin when the change had the same effect on both registries
+    return m_sequenceNumber == change.sequenceNumber;
+}
+
 } // namespace roudi
 } // namespace iox
@@ -0,0 +1,118 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_request.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+PortRequest::PortRequest(const IpcMessageType type,
+                         const capro::ServiceDescription& service,
+                         Options_t&& options,
+                         const PortConfigInfo& portConfigInfo) noexcept
+    : m_type(type)
+    , m_service(service)
+    , m_options(std::move(options))
+    , m_portConfigInfo(portConfigInfo)
+{
+}
+
+PortRequest PortRequest::publisher(const capro::ServiceDescription& service,
+                                   const popo::PublisherOptions& publisherOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    return PortRequest(IpcMessageType::CREATE_PUBLISHER,
+                       service,
+                       Options_t(in_place_type<popo::PublisherOptions>(), publisherOptions),
+                       portConfigInfo);
+}
+
+PortRequest PortRequest::subscriber(const capro::ServiceDescription& service,
+                                    const popo::SubscriberOptions& subscriberOptions,
+                                    const PortConfigInfo& portConfigInfo) noexcept
+{
+    return PortRequest(IpcMessageType::CREATE_SUBSCRIBER,
+                       service,
+                       Options_t(in_place_type<popo::SubscriberOptions>(), subscriberOptions),
+                       portConfigInfo);
+}
+
+PortRequest PortRequest::client(const capro::ServiceDescription& service,
+                                const popo::ClientOptions& clientOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept
+{
+    return PortRequest(IpcMessageType::CREATE_CLIENT,
+                       service,
+                       Options_t(in_place_type<popo::ClientOptions>(), clientOptions),
+                       portConfigInfo);
+}
+
+PortRequest PortRequest::server(const capro::ServiceDescription& service,
+                                const popo::ServerOptions& serverOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept
+{
+    return PortRequest(IpcMessageType::CREATE_SERVER,
+                       service,
+                       Options_t(in_place_type<popo::ServerOptions>(), serverOptions),
+                       portConfigInfo);
+}
+
+PortRequest PortRequest::conditionVariable() noexcept
+{
+    return PortRequest(IpcMessageType::CREATE_CONDITION_VARIABLE,
+                       capro::ServiceDescription(),
+                       Options_t(in_place_type<ConditionVariableOptions>()),
+                       PortConfigInfo());
+}
+
+IpcMessageType PortRequest::type() const noexcept
+{
+    return m_type;
+}
+
+void* PortRequest::portDataIf(const IpcMessageType type) const noexcept
+{
+    return (m_type == type) ? m_portData : nullptr;
+}
+
+PublisherPortUserType::MemberType_t* PortRequest::publisherPortData() const noexcept
+{
+    return static_cast<PublisherPortUserType::MemberType_t*>(portDataIf(IpcMessageType::CREATE_PUBLISHER));
+}
+
+SubscriberPortUserType::MemberType_t* PortRequest::subscriberPortData() const noexcept
+{
+    return static_cast<SubscriberPortUserType::MemberType_t*>(portDataIf(IpcMessageType::CREATE_SUBSCRIBER));
+}
+
+popo::ClientPortData* PortRequest::clientPortData() const noexcept
+{
+    return static_cast<popo::ClientPortData*>(portDataIf(IpcMessageType::CREATE_CLIENT));
+}
+
+popo::ServerPortData* PortRequest::serverPortData() const noexcept
+{
+    return static_cast<popo::ServerPortData*>(portDataIf(IpcMessageType::CREATE_SERVER));
+}
+
+popo::ConditionVariableData* PortRequest::conditionVariableData() const noexcept
+{
+    return static_cast<popo::ConditionVariableData*>(portDataIf(IpcMessageType::CREATE_CONDITION_VARIABLE));
+}
+
+} // namespace runtime
+} // namespace iox
@@ -20,11 +20,13 @@
 #include "iox/detail/convert.hpp"
 #include "iox/variant.hpp"
 
+#include "iceoryx_platform/mman.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
 
 #include <cstdint>
 
@@ -32,6 +34,62 @@ namespace iox
 {
 namespace runtime
 {
+namespace
+{
+IpcMessageType portRequestAckType(const IpcMessageType requestType) noexcept
+{
+    switch (requestType)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return IpcMessageType::CREATE_PUBLISHER_ACK;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return IpcMessageType::CREATE_SUBSCRIBER_ACK;
+    case IpcMessageType::CREATE_CLIENT:
+        return IpcMessageType::CREATE_CLIENT_ACK;
+    case IpcMessageType::CREATE_SERVER:
+        return IpcMessageType::CREATE_SERVER_ACK;
+    case IpcMessageType::CREATE_CONDITION_VARIABLE:
+        return IpcMessageType::CREATE_CONDITION_VARIABLE_ACK;
+    default:
+        return IpcMessageType::NOTYPE;
+    }
+}
+
+IpcMessageErrorType portRequestInvalidResponseError(const IpcMessageType requestType) noexcept
+{
+    switch (requestType)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE;
+    case IpcMessageType::CREATE_CLIENT:
+        return IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE;
+    case IpcMessageType::CREATE_SERVER:
+        return IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE;
+    default:
+        return IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE;
+    }
+}
+
+IpcMessageErrorType portRequestWrongResponseError(const IpcMessageType requestType) noexcept
+{
+    switch (requestType)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        return IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        return IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE;
+    case IpcMessageType::CREATE_CLIENT:
+        return IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE;
+    case IpcMessageType::CREATE_SERVER:
+        return IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE;
+    default:
+        return IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE;
+    }
+}
+} // namespace
+
 PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name,
                                  std::pair<IpcRuntimeInterface, optional<SharedMemoryUser>>&& interfaces) noexcept
     : PoshRuntime(name)
@@ -152,72 +210,17 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
                                         const popo::PublisherOptions& publisherOptions,
                                         const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_HISTORY_CAPACITY =
-        PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
-
-    auto options = publisherOptions;
-    if (options.historyCapacity > MAX_HISTORY_CAPACITY)
-    {
-        IOX_LOG(Warn,
-                "Requested history capacity "
-                    << options.historyCapacity << " exceeds the maximum possible one for this publisher"
-                    << ", limiting from " << publisherOptions.historyCapacity << " to " << MAX_HISTORY_CAPACITY);
-        options.historyCapacity = MAX_HISTORY_CAPACITY;
-    }
-
-    if (options.nodeName.empty())
-    {
-        options.nodeName = m_appName;
-    }
+    auto options = sanitizePublisherOptions(publisherOptions);
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<Serialization>(service).toString() << publisherOptions.serialize().toString()
+               << static_cast<Serialization>(service).toString() << options.serialize().toString()
                << static_cast<Serialization>(portConfigInfo).toString();
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
     if (maybePublisher.has_error())
     {
-        switch (maybePublisher.error())
-        {
-        case IpcMessageErrorType::NO_UNIQUE_CREATED:
-            IOX_LOG(Warn, "Service '" << service << "' already in use by another process.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-            IOX_LOG(Warn, "Usage of internal service '" << service << "' is forbidden.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::PUBLISHER_LIST_FULL:
-            IOX_LOG(Warn,
-                    "Service '" << service << "' could not be created since we are out of memory for publishers.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
-            IOX_LOG(Warn, "Service '" << service << "' could not be created. Request publisher got invalid response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn,
-                    "Service '" << service
-                                << "' could not be created. Request publisher got wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
-            IOX_LOG(
-                Warn,
-                "Service '"
-                    << service
-                    << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                       "user. Try using another user or adapt RouDi's config.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
-            break;
-        default:
-            IOX_LOG(Warn, "Unknown error occurred while creating service '" << service << "'.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
-            break;
-        }
+        reportPublisherCreationError(service, maybePublisher.error());
         return nullptr;
     }
     return maybePublisher.value();
@@ -271,37 +274,7 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
                                          const popo::SubscriberOptions& subscriberOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
-
-    auto options = subscriberOptions;
-    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(Warn,
-                "Requested queue capacity "
-                    << options.queueCapacity << " exceeds the maximum possible one for this subscriber"
-                    << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY);
-        options.queueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (0U == options.queueCapacity)
-    {
-        IOX_LOG(Warn,
-                "Requested queue capacity of 0 doesn't make sense as no data would be received,"
-                    << " the capacity is set to 1");
-        options.queueCapacity = 1U;
-    }
-
-    if (subscriberOptions.historyRequest > options.queueCapacity)
-    {
-        IOX_LOG(Warn,
-                "Requested historyRequest for "
-                    << service << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!");
-        options.historyRequest = options.queueCapacity;
-    }
-
-    if (options.nodeName.empty())
-    {
-        options.nodeName = m_appName;
-    }
+    auto options = sanitizeSubscriberOptions(service, subscriberOptions);
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
@@ -309,32 +282,9 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
                << static_cast<Serialization>(portConfigInfo).toString();
 
     auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
-
     if (maybeSubscriber.has_error())
     {
-        switch (maybeSubscriber.error())
-        {
-        case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
-            IOX_LOG(Warn,
-                    "Service '" << service << "' could not be created since we are out of memory for subscribers.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
-            IOX_LOG(Warn, "Service '" << service << "' could not be created. Request subscriber got invalid response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn,
-                    "Service '" << service
-                                << "' could not be created. Request subscriber got wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
-            break;
-        default:
-            IOX_LOG(Warn, "Unknown error occurred while creating service '" << service << "'.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
-            break;
-        }
+        reportSubscriberCreationError(service, maybeSubscriber.error());
         return nullptr;
     }
     return maybeSubscriber.value();
@@ -388,23 +338,7 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
                                                                          const popo::ClientOptions& clientOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
-    auto options = clientOptions;
-    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(Warn,
-                "Requested response queue capacity "
-                    << options.responseQueueCapacity << " exceeds the maximum possible one for this client"
-                    << ", limiting from " << options.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY);
-        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (options.responseQueueCapacity == 0U)
-    {
-        IOX_LOG(Warn,
-                "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
-                    << " the capacity is set to 1");
-        options.responseQueueCapacity = 1U;
-    }
+    auto options = sanitizeClientOptions(clientOptions);
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
@@ -414,40 +348,7 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
     auto maybeClient = requestClientFromRoudi(sendBuffer);
     if (maybeClient.has_error())
     {
-        switch (maybeClient.error())
-        {
-        case IpcMessageErrorType::CLIENT_LIST_FULL:
-            IOX_LOG(Warn,
-                    "Could not create client with service description '" << service
-                                                                         << "' as we are out of memory for clients.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_CLIENTS, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE:
-            IOX_LOG(Warn,
-                    "Could not create client with service description '" << service << "'; received invalid response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn,
-                    "Could not create client with service description '" << service
-                                                                         << "'; received wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT:
-            IOX_LOG(
-                Warn,
-                "Service '"
-                    << service
-                    << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                       "user. Try using another user or adapt RouDi's config.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
-            break;
-        default:
-            IOX_LOG(Warn, "Unknown error occurred while creating client with service description '" << service << "'");
-            IOX_REPORT(PoshError::POSH__RUNTIME_CLIENT_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
-            break;
-        }
+        reportClientCreationError(service, maybeClient.error());
         return nullptr;
     }
     return maybeClient.value();
@@ -501,23 +402,7 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
                                                                          const popo::ServerOptions& serverOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
-    auto options = serverOptions;
-    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(Warn,
-                "Requested request queue capacity "
-                    << options.requestQueueCapacity << " exceeds the maximum possible one for this server"
-                    << ", limiting from " << options.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY);
-        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (options.requestQueueCapacity == 0U)
-    {
-        IOX_LOG(Warn,
-                "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
-                    << " the capacity is set to 1");
-        options.requestQueueCapacity = 1U;
-    }
+    auto options = sanitizeServerOptions(serverOptions);
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
@@ -527,40 +412,7 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
     auto maybeServer = requestServerFromRoudi(sendBuffer);
     if (maybeServer.has_error())
     {
-        switch (maybeServer.error())
-        {
-        case IpcMessageErrorType::SERVER_LIST_FULL:
-            IOX_LOG(Warn,
-                    "Could not create server with service description '" << service
-                                                                         << "' as we are out of memory for servers.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_SERVERS, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE:
-            IOX_LOG(Warn,
-                    "Could not create server with service description '" << service << "'; received invalid response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn,
-                    "Could not create server with service description '" << service
-                                                                         << "'; received wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
-            break;
-        case IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT:
-            IOX_LOG(
-                Warn,
-                "Service '"
-                    << service
-                    << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                       "user. Try using another user or adapt RouDi's config.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
-            break;
-        default:
-            IOX_LOG(Warn, "Unknown error occurred while creating server with service description '" << service << "'");
-            IOX_REPORT(PoshError::POSH__RUNTIME_SERVER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
-            break;
-        }
+        reportServerCreationError(service, maybeServer.error());
         return nullptr;
     }
     return maybeServer.value();
@@ -701,31 +553,513 @@ popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() n
     auto maybeConditionVariable = requestConditionVariableFromRoudi(sendBuffer);
     if (maybeConditionVariable.has_error())
     {
-        switch (maybeConditionVariable.error())
+        reportConditionVariableCreationError(maybeConditionVariable.error());
+        return nullptr;
+    }
+    return maybeConditionVariable.value();
+}
+
+popo::PublisherOptions
+PoshRuntimeImpl::sanitizePublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept
+{
+    constexpr uint64_t MAX_HISTORY_CAPACITY =
+        PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
+
+    auto options = publisherOptions;
+    if (options.historyCapacity > MAX_HISTORY_CAPACITY)
+    {
+        IOX_LOG(Warn,
+                "Requested history capacity "
+                    << options.historyCapacity << " exceeds the maximum possible one for this publisher"
+                    << ", limiting from " << publisherOptions.historyCapacity << " to " << MAX_HISTORY_CAPACITY);
+        options.historyCapacity = MAX_HISTORY_CAPACITY;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+
+    if (options.preferredNumaNode == popo::PublisherOptions::NUMA_NODE_OF_CALLING_THREAD)
+    {
+        uint32_t numaNode{0U};
+        IOX_POSIX_CALL(iox_get_numa_node)(&numaNode)
+            .failureReturnValue(-1)
+            .evaluate()
+            .and_then([&](auto&) { options.preferredNumaNode = numaNode; })
+            .or_else([&](auto& r) {
+                IOX_LOG(Warn,
+                        "Unable to acquire the NUMA node of the calling thread, using the default segment: "
+                            << r.getHumanReadableErrnum());
+                options.preferredNumaNode = popo::PublisherOptions::NO_NUMA_NODE_PREFERENCE;
+            });
+    }
+
+    return options;
+}
+
+popo::SubscriberOptions
+PoshRuntimeImpl::sanitizeSubscriberOptions(const capro::ServiceDescription& service,
+                                           const popo::SubscriberOptions& subscriberOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
+
+    auto options = subscriberOptions;
+    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(Warn,
+                "Requested queue capacity "
+                    << options.queueCapacity << " exceeds the maximum possible one for this subscriber"
+                    << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY);
+        options.queueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.queueCapacity)
+    {
+        IOX_LOG(Warn,
+                "Requested queue capacity of 0 doesn't make sense as no data would be received,"
+                    << " the capacity is set to 1");
+        options.queueCapacity = 1U;
+    }
+
+    if (subscriberOptions.historyRequest > options.queueCapacity)
+    {
+        IOX_LOG(Warn,
+                "Requested historyRequest for "
+                    << service << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!");
+        options.historyRequest = options.queueCapacity;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+
+    return options;
+}
+
+popo::ClientOptions PoshRuntimeImpl::sanitizeClientOptions(const popo::ClientOptions& clientOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    auto options = clientOptions;
+    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(Warn,
+                "Requested response queue capacity "
+                    << options.responseQueueCapacity << " exceeds the maximum possible one for this client"
+                    << ", limiting from " << options.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY);
+        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (options.responseQueueCapacity == 0U)
+    {
+        IOX_LOG(Warn,
+                "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
+                    << " the capacity is set to 1");
+        options.responseQueueCapacity = 1U;
+    }
+
+    return options;
+}
+
+popo::ServerOptions PoshRuntimeImpl::sanitizeServerOptions(const popo::ServerOptions& serverOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    auto options = serverOptions;
+    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(Warn,
+                "Requested request queue capacity "
+                    << options.requestQueueCapacity << " exceeds the maximum possible one for this server"
+                    << ", limiting from " << options.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY);
+        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (options.requestQueueCapacity == 0U)
+    {
+        IOX_LOG(Warn,
+                "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
+                    << " the capacity is set to 1");
+        options.requestQueueCapacity = 1U;
+    }
+
+    return options;
+}
+
+void PoshRuntimeImpl::reportPublisherCreationError(const capro::ServiceDescription& service,
+                                                   const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::NO_UNIQUE_CREATED:
+        IOX_LOG(Warn, "Service '" << service << "' already in use by another process.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        IOX_LOG(Warn, "Usage of internal service '" << service << "' is forbidden.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::PUBLISHER_LIST_FULL:
+        IOX_LOG(Warn,
+                "Service '" << service << "' could not be created since we are out of memory for publishers.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
+        IOX_LOG(Warn, "Service '" << service << "' could not be created. Request publisher got invalid response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn,
+                "Service '" << service
+                            << "' could not be created. Request publisher got wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
+        IOX_LOG(
+            Warn,
+            "Service '"
+                << service
+                << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                   "user. Try using another user or adapt RouDi's config.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating service '" << service << "'.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
+        break;
+    }
+}
+
+void PoshRuntimeImpl::reportSubscriberCreationError(const capro::ServiceDescription& service,
+                                                    const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
+        IOX_LOG(Warn,
+                "Service '" << service << "' could not be created since we are out of memory for subscribers.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
+        IOX_LOG(Warn, "Service '" << service << "' could not be created. Request subscriber got invalid response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn,
+                "Service '" << service
+                            << "' could not be created. Request subscriber got wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating service '" << service << "'.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
+        break;
+    }
+}
+
+void PoshRuntimeImpl::reportClientCreationError(const capro::ServiceDescription& service,
+                                                const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::CLIENT_LIST_FULL:
+        IOX_LOG(Warn,
+                "Could not create client with service description '" << service
+                                                                     << "' as we are out of memory for clients.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_CLIENTS, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE:
+        IOX_LOG(Warn,
+                "Could not create client with service description '" << service << "'; received invalid response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn,
+                "Could not create client with service description '" << service
+                                                                     << "'; received wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT:
+        IOX_LOG(
+            Warn,
+            "Service '"
+                << service
+                << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                   "user. Try using another user or adapt RouDi's config.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating client with service description '" << service << "'");
+        IOX_REPORT(PoshError::POSH__RUNTIME_CLIENT_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
+        break;
+    }
+}
+
+void PoshRuntimeImpl::reportServerCreationError(const capro::ServiceDescription& service,
+                                                const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::SERVER_LIST_FULL:
+        IOX_LOG(Warn,
+                "Could not create server with service description '" << service
+                                                                     << "' as we are out of memory for servers.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_OUT_OF_SERVERS, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE:
+        IOX_LOG(Warn,
+                "Could not create server with service description '" << service << "'; received invalid response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn,
+                "Could not create server with service description '" << service
+                                                                     << "'; received wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT:
+        IOX_LOG(
+            Warn,
+            "Service '"
+                << service
+                << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                   "user. Try using another user or adapt RouDi's config.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating server with service description '" << service << "'");
+        IOX_REPORT(PoshError::POSH__RUNTIME_SERVER_PORT_CREATION_UNKNOWN_ERROR, iox::er::RUNTIME_ERROR);
+        break;
+    }
+}
+
+void PoshRuntimeImpl::reportConditionVariableCreationError(const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL:
+        IOX_LOG(Warn, "Could not create condition variable as we are out of memory for condition variables.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_LIST_FULL, iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE:
+        IOX_LOG(Warn, "Could not create condition variables; received invalid IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    case IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(Warn, "Could not create condition variables; received wrong IPC channel response.");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    default:
+        IOX_LOG(Warn, "Unknown error occurred while creating condition variable");
+        IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_CREATION_UNKNOWN_ERROR,
+                   iox::er::RUNTIME_ERROR);
+        break;
+    }
+}
+
+void PoshRuntimeImpl::reportPortCreationError(const PortRequest& request,
+                                              const IpcMessageErrorType error) const noexcept
+{
+    switch (request.m_type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        reportPublisherCreationError(request.m_service, error);
+        break;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        reportSubscriberCreationError(request.m_service, error);
+        break;
+    case IpcMessageType::CREATE_CLIENT:
+        reportClientCreationError(request.m_service, error);
+        break;
+    case IpcMessageType::CREATE_SERVER:
+        reportServerCreationError(request.m_service, error);
+        break;
+    case IpcMessageType::CREATE_CONDITION_VARIABLE:
+        reportConditionVariableCreationError(error);
+        break;
+    default:
+        IOX_UNREACHABLE();
+    }
+}
+
+void PoshRuntimeImpl::addPortRequestToMessage(const PortRequest& request, IpcMessage& sendBuffer) const noexcept
+{
+    sendBuffer << IpcMessageTypeToString(request.m_type);
+
+    switch (request.m_type)
+    {
+    case IpcMessageType::CREATE_PUBLISHER:
+        sendBuffer << static_cast<Serialization>(request.m_service).toString()
+                   << sanitizePublisherOptions(*request.m_options.get<popo::PublisherOptions>()).serialize().toString()
+                   << static_cast<Serialization>(request.m_portConfigInfo).toString();
+        break;
+    case IpcMessageType::CREATE_SUBSCRIBER:
+        sendBuffer << static_cast<Serialization>(request.m_service).toString()
+                   << sanitizeSubscriberOptions(request.m_service,
+                                                *request.m_options.get<popo::SubscriberOptions>())
+                          .serialize()
+                          .toString()
+                   << static_cast<Serialization>(request.m_portConfigInfo).toString();
+        break;
+    case IpcMessageType::CREATE_CLIENT:
+        sendBuffer << static_cast<Serialization>(request.m_service).toString()
+                   << sanitizeClientOptions(*request.m_options.get<popo::ClientOptions>()).serialize().toString()
+                   << static_cast<Serialization>(request.m_portConfigInfo).toString();
+        break;
+    case IpcMessageType::CREATE_SERVER:
+        sendBuffer << static_cast<Serialization>(request.m_service).toString()
+                   << sanitizeServerOptions(*request.m_options.get<popo::ServerOptions>()).serialize().toString()
+                   << static_cast<Serialization>(request.m_portConfigInfo).toString();
+        break;
+    default:
+        // a condition variable has no service description, options and port config info but the entries are added
+        // anyway in order to have the same number of entries for every request
+        sendBuffer << std::string() << std::string() << std::string();
+        break;
+    }
+}
+
+uint64_t PoshRuntimeImpl::createPorts(const span<PortRequest> requests) noexcept
+{
+    uint64_t numberOfCreatedPorts{0U};
+    uint64_t batchBegin{0U};
+    while (batchBegin < requests.size())
+    {
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+
+        uint64_t batchEnd{batchBegin};
+        while (batchEnd < requests.size() && batchEnd - batchBegin < MAX_PORT_REQUESTS_PER_MESSAGE)
+        {
+            requests[batchEnd].m_portData = nullptr;
+
+            IpcMessage extendedSendBuffer{sendBuffer};
+            addPortRequestToMessage(requests[batchEnd], extendedSendBuffer);
+            const bool fitsIntoMessage = extendedSendBuffer.getMessage().size()
+                                             + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE
+                                         <= ROUDI_MESSAGE_SIZE;
+            // a request which does not even fit into an otherwise empty message is sent alone and fails in the
+            // same way as with getMiddlewarePublisher & co
+            if (!fitsIntoMessage && batchEnd > batchBegin)
+            {
+                break;
+            }
+            sendBuffer = std::move(extendedSendBuffer);
+            ++batchEnd;
+        }
+
+        numberOfCreatedPorts += requestPortsFromRoudi(sendBuffer, requests.subspan(batchBegin, batchEnd - batchBegin));
+        batchBegin = batchEnd;
+    }
+
+    return numberOfCreatedPorts;
+}
+
+uint64_t PoshRuntimeImpl::requestPortsFromRoudi(const IpcMessage& sendBuffer, const span<PortRequest> requests) noexcept
+{
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+    {
+        IOX_LOG(Error, "Request ports got invalid response!");
+        for (auto& request : requests)
+        {
+            reportPortCreationError(request, portRequestInvalidResponseError(request.m_type));
+        }
+        return 0U;
+    }
+
+    const auto responseType = stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str());
+    if (responseType == IpcMessageType::MESSAGE_NOT_SUPPORTED)
+    {
+        IOX_LOG(Debug, "RouDi does not support the creation of multiple ports at once; requesting them one by one");
+        return createPortsOneByOne(requests);
+    }
+
+    // the response contains the segment id of all ports followed by the type and offset or error of each port
+    const auto segmentId = convert::from_string<segment_id_underlying_t>(receiveBuffer.getElementAtIndex(1U).c_str());
+    if (responseType != IpcMessageType::CREATE_PORTS_ACK
+        || receiveBuffer.getNumberOfElements() != 2U + 2U * requests.size() || !segmentId.has_value())
+    {
+        IOX_LOG(Error, "Request ports got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'");
+        for (auto& request : requests)
+        {
+            reportPortCreationError(request, portRequestWrongResponseError(request.m_type));
+        }
+        return 0U;
+    }
+
+    uint64_t numberOfCreatedPorts{0U};
+    uint32_t index{2U};
+    for (auto& request : requests)
+    {
+        const auto portType = stringToIpcMessageType(receiveBuffer.getElementAtIndex(index).c_str());
+        const auto portValue = receiveBuffer.getElementAtIndex(index + 1U);
+        index += 2U;
+
+        if (portType == portRequestAckType(request.m_type))
+        {
+            auto offset = convert::from_string<UntypedRelativePointer::offset_t>(portValue.c_str());
+            if (!offset.has_value())
+            {
+                IOX_LOG(Error, "offset conversion failed");
+                reportPortCreationError(request, IpcMessageErrorType::OFFSET_CONVERSION_FAILURE);
+                continue;
+            }
+
+            request.m_portData = UntypedRelativePointer::getPtr(segment_id_t{segmentId.value()}, offset.value());
+            ++numberOfCreatedPorts;
+        }
+        else if (portType == IpcMessageType::ERROR_RESPONSE)
+        {
+            reportPortCreationError(request, stringToIpcMessageErrorType(portValue.c_str()));
+        }
+        else
         {
-        case IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL:
-            IOX_LOG(Warn, "Could not create condition variable as we are out of memory for condition variables.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_LIST_FULL, iox::er::RUNTIME_ERROR);
+            reportPortCreationError(request, portRequestWrongResponseError(request.m_type));
+        }
+    }
+
+    return numberOfCreatedPorts;
+}
+
+uint64_t PoshRuntimeImpl::createPortsOneByOne(const span<PortRequest> requests) noexcept
+{
+    uint64_t numberOfCreatedPorts{0U};
+    for (auto& request : requests)
+    {
+        switch (request.m_type)
+        {
+        case IpcMessageType::CREATE_PUBLISHER:
+            request.m_portData = getMiddlewarePublisher(
+                request.m_service, *request.m_options.get<popo::PublisherOptions>(), request.m_portConfigInfo);
             break;
-        case IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE:
-            IOX_LOG(Warn, "Could not create condition variables; received invalid IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
+        case IpcMessageType::CREATE_SUBSCRIBER:
+            request.m_portData = getMiddlewareSubscriber(
+                request.m_service, *request.m_options.get<popo::SubscriberOptions>(), request.m_portConfigInfo);
             break;
-        case IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(Warn, "Could not create condition variables; received wrong IPC channel response.");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE,
-                       iox::er::RUNTIME_ERROR);
+        case IpcMessageType::CREATE_CLIENT:
+            request.m_portData = getMiddlewareClient(
+                request.m_service, *request.m_options.get<popo::ClientOptions>(), request.m_portConfigInfo);
+            break;
+        case IpcMessageType::CREATE_SERVER:
+            request.m_portData = getMiddlewareServer(
+                request.m_service, *request.m_options.get<popo::ServerOptions>(), request.m_portConfigInfo);
             break;
         default:
-            IOX_LOG(Warn, "Unknown error occurred while creating condition variable");
-            IOX_REPORT(PoshError::POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_CREATION_UNKNOWN_ERROR,
-                       iox::er::RUNTIME_ERROR);
+            request.m_portData = getMiddlewareConditionVariable();
             break;
         }
-        return nullptr;
+
+        if (request.m_portData != nullptr)
+        {
+            ++numberOfCreatedPorts;
+        }
     }
-    return maybeConditionVariable.value();
+
+    return numberOfCreatedPorts;
 }
 
 bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg,
@@ -17,6 +17,9 @@
 
 #include "iceoryx_posh/runtime/service_discovery.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/deadline_timer.hpp"
+
+#include <thread>
 
 namespace iox
 {
@@ -26,13 +29,58 @@ ServiceDiscovery::ServiceDiscovery() noexcept
 {
 }
 
-void ServiceDiscovery::update()
+bool ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    updateFromServiceRegistry();
+    while (!m_isOutOfSync && !applyServiceRegistryChanges())
+    {
+        // some changes were missed, RouDi publishes the complete registry to close the gap
+        updateFromServiceRegistry();
+    }
+    return !m_isOutOfSync;
+}
+
+void ServiceDiscovery::updateFromServiceRegistry()
+{
     m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
+        // the complete registry is only published for late joiners and after a missed change; the copy is skipped
+        // when the changes already brought the local registry up to date
+        if (serviceRegistrySample->sequenceNumber() > m_serviceRegistry->sequenceNumber())
+        {
+            *m_serviceRegistry = *serviceRegistrySample;
+        }
     });
+
+    // an older registry, e.g. the one from the history, does not contain the missed change
+    if (m_isOutOfSync && m_serviceRegistry->sequenceNumber() >= m_resyncSequenceNumber)
+    {
+        m_isOutOfSync = false;
+    }
+}
+
+bool ServiceDiscovery::applyServiceRegistryChanges()
+{
+    // the changes are taken one by one so that the changes after a gap stay in the queue until the complete registry
+    // arrived; the ones which are contained in it are skipped afterwards
+    while (m_serviceRegistryChangesSubscriber.take().and_then(
+        [&](popo::Sample<const roudi::ServiceRegistryChange>& changeSample) {
+            // changes which are already contained in the local registry are skipped
+            if (changeSample->sequenceNumber > m_serviceRegistry->sequenceNumber()
+                && !m_serviceRegistry->applyChange(*changeSample))
+            {
+                m_isOutOfSync = true;
+                m_resyncSequenceNumber = changeSample->sequenceNumber;
+            }
+        }))
+    {
+        if (m_isOutOfSync)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
@@ -41,7 +89,22 @@ void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
                                    const function_ref<void(const capro::ServiceDescription&)> callableForEach,
                                    const popo::MessagingPattern pattern) noexcept
 {
-    update();
+    if (!update())
+    {
+        // the local registry misses a change; RouDi publishes the complete registry in its next discovery loop
+        deadline_timer resyncTimeout{SERVICE_DISCOVERY_RESYNC_TIMEOUT};
+        while (!update())
+        {
+            if (resyncTimeout.hasExpired())
+            {
+                IOX_LOG(Warn,
+                        "ServiceDiscovery did not receive the complete service registry in time! The search is "
+                        "performed on an outdated service registry.");
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::nanoseconds(SERVICE_DISCOVERY_RESYNC_POLL_INTERVAL.toNanoseconds()));
+        }
+    }
 
     switch (pattern)
     {
@@ -81,7 +144,8 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        // every modification of the registry is published as change
+        m_serviceRegistryChangesSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -98,7 +162,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryChangesSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -111,13 +175,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryChangesSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryChangesSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
@@ -0,0 +1,174 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+#include "iox/atomic.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <functional>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using namespace iox::gw;
+using namespace iox::roudi_env;
+
+struct StubbedExternalTerminal
+{
+    StubbedExternalTerminal(iox::capro::IdString_t, iox::capro::IdString_t, iox::capro::IdString_t) {};
+};
+
+using TestChannel = Channel<iox::popo::UntypedSubscriber, StubbedExternalTerminal>;
+
+constexpr const char RUNTIME_NAME[]{"gateway_event_driven"};
+
+/// @brief Creates a channel for every offered service of the "Gateway" service and counts the forwarded samples
+class EventDrivenGateway : public GatewayGeneric<TestChannel>
+{
+  public:
+    explicit EventDrivenGateway(const uint32_t numberOfForwardingWorkers)
+        // the periods are far longer than the test timeouts, the gateway must react to the events
+        : GatewayGeneric<TestChannel>(
+            iox::capro::Interfaces::DDS, 1000_s, 1000_s, GatewayMode::EVENT_DRIVEN, numberOfForwardingWorkers)
+    {
+    }
+
+    void loadConfiguration(const iox::config::GatewayConfig&) noexcept override
+    {
+    }
+
+    void discover(const iox::capro::CaproMessage& msg) noexcept override
+    {
+        if (msg.m_type == iox::capro::CaproMessageType::OFFER
+            && msg.m_serviceDescription.getServiceIDString() == iox::capro::IdString_t("Gateway"))
+        {
+            // the roudi environment requires the runtime to be initialized in the event loop thread of the gateway
+            iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME);
+            iox::popo::SubscriberOptions options;
+            options.historyRequest = 1U;
+            IOX_DISCARD_RESULT(addChannel(msg.m_serviceDescription, options));
+        }
+    }
+
+    void forward(const TestChannel& channel) noexcept override
+    {
+        auto subscriber = channel.getIceoryxTerminal();
+        while (subscriber->take()
+                   .and_then([&](const void* payload) {
+                       subscriber->release(payload);
+                       m_forwardedSamples.fetch_add(1U);
+                   })
+                   .has_value())
+        {
+        }
+    }
+
+    iox::concurrent::Atomic<uint64_t> m_forwardedSamples{0U};
+};
+
+class GatewayGenericEventDriven_test : public RouDi_GTest
+{
+  public:
+    GatewayGenericEventDriven_test()
+        : RouDi_GTest(MinimalIceoryxConfigBuilder().create())
+    {
+    }
+
+    void SetUp() override
+    {
+        iox::runtime::PoshRuntime::initRuntime(RUNTIME_NAME);
+    }
+
+    static bool waitUntil(const std::function<bool()>& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    void publishOnServicesAndExpectForwarding(const uint32_t numberOfServices, const uint32_t numberOfForwardingWorkers)
+    {
+        EventDrivenGateway sut{numberOfForwardingWorkers};
+        sut.runMultithreaded();
+
+        iox::popo::PublisherOptions options;
+        options.historyCapacity = 1U;
+        std::vector<std::unique_ptr<iox::popo::Publisher<uint64_t>>> publishers;
+        for (uint32_t i = 0U; i < numberOfServices; ++i)
+        {
+            publishers.emplace_back(new iox::popo::Publisher<uint64_t>(
+                {"Gateway", "Instance", iox::into<iox::lossy<iox::capro::IdString_t>>(std::to_string(i))}, options));
+            ASSERT_FALSE(publishers.back()->publishCopyOf(i).has_error());
+        }
+
+        // the offers are dispatched to the interface port of the gateway which creates the channels
+        triggerDiscoveryLoopAndWaitToFinish();
+        ASSERT_TRUE(waitUntil([&] { return sut.getNumberOfChannels() == numberOfServices; }));
+
+        // the subscribers of the channels are connected and receive the history
+        triggerDiscoveryLoopAndWaitToFinish();
+        EXPECT_TRUE(waitUntil([&] { return sut.m_forwardedSamples.load() == numberOfServices; }));
+
+        for (auto& publisher : publishers)
+        {
+            ASSERT_FALSE(publisher->publishCopyOf(42U).has_error());
+        }
+        EXPECT_TRUE(waitUntil([&] { return sut.m_forwardedSamples.load() == 2U * numberOfServices; }));
+
+        sut.shutdown();
+    }
+};
+
+TEST_F(GatewayGenericEventDriven_test, DiscoveryAndForwardingReactToEvents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8350ec78-7253-49a9-84c0-58b1c1750710");
+    publishOnServicesAndExpectForwarding(1U, 1U);
+}
+
+TEST_F(GatewayGenericEventDriven_test, ForwardingWorkersForwardAllChannelsWithData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "056b5cba-88c0-4414-ad6d-c5c357afc62b");
+    publishOnServicesAndExpectForwarding(8U, 4U);
+}
+
+TEST_F(GatewayGenericEventDriven_test, ShutdownWithoutEventsTerminates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e487398-b390-4aaf-bb07-3f18d2c6c51b");
+    EventDrivenGateway sut{4U};
+    sut.runMultithreaded();
+    sut.shutdown();
+    EXPECT_THAT(sut.m_forwardedSamples.load(), Eq(0U));
+}
+
+} // namespace
@@ -705,6 +705,19 @@ TEST(Node_test, CreatingListenerWorks)
     EXPECT_TRUE((std::is_same_v<decltype(listener), iox::unique_ptr<iox::posh::experimental::Listener>>));
 }
 
+TEST(Node_test, CreatingListenerWithCallbackWorkersWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1a69377-8e7c-4fd2-b3fa-d14b7e1e2b3b");
+
+    RouDiEnv roudi;
+
+    auto node = RouDiEnvNodeBuilder("hypnotoad").create().expect("Creating a node should not fail!");
+
+    auto listener = node.listener().callback_workers(2).create().expect("Creating a listener should not fail!");
+
+    EXPECT_THAT(listener->numberOfCallbackWorkers(), Eq(2U));
+}
+
 TEST(Node_test, ExhaustingUntypedServerUntypedClientClientLeadsToError)
 {
     ::testing::Test::RecordProperty("TEST_ID", "19df3a60-1cc2-4172-aaf4-5877c0ed2f7e");
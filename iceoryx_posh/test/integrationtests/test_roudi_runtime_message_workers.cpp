@@ -0,0 +1,133 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/std_string_support.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi_env;
+using namespace iox::units::duration_literals;
+
+using iox::runtime::IpcMessage;
+using iox::runtime::IpcMessageType;
+using iox::runtime::IpcRuntimeInterface;
+
+class RouDiRuntimeMessageWorkers_test : public Test
+{
+  public:
+    void startRouDi(const uint32_t runtimeMessageWorkerCount)
+    {
+        auto config = MinimalIceoryxConfigBuilder().create();
+        config.runtimeMessageWorkerCount = runtimeMessageWorkerCount;
+        m_roudiEnv.emplace(config);
+    }
+
+    /// @brief registers a runtime, requests a condition variable and unregisters the runtime again
+    /// @return true if RouDi answered every request as expected
+    static bool registerRequestAndUnregister(const RuntimeName_t& runtimeName)
+    {
+        auto ipcInterface = IpcRuntimeInterface::create(runtimeName, DEFAULT_DOMAIN_ID, 5_s);
+        if (ipcInterface.has_error())
+        {
+            return false;
+        }
+
+        IpcMessage request;
+        IpcMessage response;
+        request << runtime::IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << runtimeName;
+        if (!ipcInterface->sendRequestToRouDi(request, response, 5_s)
+            || runtime::stringToIpcMessageType(response.getElementAtIndex(0U).c_str())
+                   != IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
+        {
+            return false;
+        }
+
+        IpcMessage termination;
+        termination << runtime::IpcMessageTypeToString(IpcMessageType::TERMINATION) << runtimeName;
+        return ipcInterface->sendRequestToRouDi(termination, response, 5_s)
+               && runtime::stringToIpcMessageType(response.getElementAtIndex(0U).c_str())
+                      == IpcMessageType::TERMINATION_ACK;
+    }
+
+    /// @brief lets the given number of runtimes register concurrently
+    /// @return the number of runtimes which got all requests answered
+    static uint64_t registerRuntimesConcurrently(const uint64_t numberOfRuntimes)
+    {
+        concurrent::Atomic<uint64_t> successfulRuntimes{0U};
+        std::vector<std::thread> runtimes;
+        for (uint64_t i = 0U; i < numberOfRuntimes; ++i)
+        {
+            runtimes.emplace_back([&successfulRuntimes, i] {
+                const auto runtimeName = into<lossy<RuntimeName_t>>("runtime_" + convert::toString(i));
+                if (registerRequestAndUnregister(runtimeName))
+                {
+                    ++successfulRuntimes;
+                }
+            });
+        }
+
+        for (auto& runtime : runtimes)
+        {
+            runtime.join();
+        }
+
+        return successfulRuntimes.load();
+    }
+
+    static constexpr uint64_t NUMBER_OF_RUNTIMES{20U};
+
+    optional<RouDiEnv> m_roudiEnv;
+};
+
+TEST_F(RouDiRuntimeMessageWorkers_test, ConcurrentRegistrationsWithMultipleWorkersAreSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2b8fbdc-3c8f-454b-ada9-f069d121583a");
+    startRouDi(4U);
+
+    EXPECT_THAT(registerRuntimesConcurrently(NUMBER_OF_RUNTIMES), Eq(NUMBER_OF_RUNTIMES));
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, ConcurrentRegistrationsWithSingleWorkerAreSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a62e4311-fe34-499e-b8e4-f00d527816dd");
+    startRouDi(1U);
+
+    EXPECT_THAT(registerRuntimesConcurrently(NUMBER_OF_RUNTIMES), Eq(NUMBER_OF_RUNTIMES));
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, ConcurrentRegistrationsWithZeroWorkersFallBackToSingleWorker)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46069d9b-30af-4387-a34d-88a03a033c43");
+    startRouDi(0U);
+
+    EXPECT_THAT(registerRuntimesConcurrently(NUMBER_OF_RUNTIMES), Eq(NUMBER_OF_RUNTIMES));
+}
+
+} // namespace
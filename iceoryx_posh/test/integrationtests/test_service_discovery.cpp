@@ -30,8 +30,10 @@
 #include "iox/atomic.hpp"
 #include "test.hpp"
 
+#include <memory>
 #include <random>
 #include <set>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -174,7 +176,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 7U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -182,6 +184,71 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     }
 }
 
+TEST_F(ServiceDiscoveryBase_test, ServiceRegistryIsNotPublishedAgainWhenAServiceIsOffered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "611c113e-e71a-42d4-a7db-f592cf3487de");
+    popo::Subscriber<roudi::ServiceRegistry> serviceRegistrySubscriber(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME});
+    triggerDiscoveryLoopAndWaitToFinish();
+    while (serviceRegistrySubscriber.take().has_value())
+    {
+    }
+
+    const iox::capro::ServiceDescription SERVICE_DESCRIPTION("service", "instance", "event");
+    popo::UntypedPublisher publisher(SERVICE_DESCRIPTION);
+    triggerDiscoveryLoopAndWaitToFinish();
+
+    findService(SERVICE_DESCRIPTION.getServiceIDString(),
+                SERVICE_DESCRIPTION.getInstanceIDString(),
+                SERVICE_DESCRIPTION.getEventIDString(),
+                MessagingPattern::PUB_SUB);
+    ASSERT_THAT(serviceContainer.size(), Eq(1U));
+    EXPECT_THAT(serviceContainer[0], Eq(SERVICE_DESCRIPTION));
+    EXPECT_FALSE(serviceRegistrySubscriber.hasData());
+}
+
+TEST_F(ServiceDiscoveryBase_test, LateJoiningServiceDiscoveryFindsAlreadyOfferedService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66bc1b4a-35ab-4293-b3a5-14e21bc561be");
+    const iox::capro::ServiceDescription SERVICE_DESCRIPTION("service", "instance", "event");
+    popo::UntypedPublisher publisher(SERVICE_DESCRIPTION);
+    triggerDiscoveryLoopAndWaitToFinish();
+
+    ServiceDiscovery lateJoiner;
+    triggerDiscoveryLoopAndWaitToFinish();
+
+    serviceContainer.clear();
+    lateJoiner.findService(SERVICE_DESCRIPTION.getServiceIDString(),
+                           SERVICE_DESCRIPTION.getInstanceIDString(),
+                           SERVICE_DESCRIPTION.getEventIDString(),
+                           findHandler,
+                           MessagingPattern::PUB_SUB);
+    ASSERT_THAT(serviceContainer.size(), Eq(1U));
+    EXPECT_THAT(serviceContainer[0], Eq(SERVICE_DESCRIPTION));
+}
+
+TEST_F(ServiceDiscoveryBase_test, FindServiceCatchesUpWithTheCompleteRegistryAfterMissedChanges)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3e9a1f4-6b27-4d85-9f30-7a1d5e8b2c64");
+    const IdString_t SERVICE{"service"};
+    triggerDiscoveryLoopAndWaitToFinish();
+    findService(SERVICE, nullopt, nullopt, MessagingPattern::PUB_SUB);
+    ASSERT_TRUE(serviceContainer.empty());
+
+    // more changes than the queue of the service discovery can hold are published in a single discovery loop
+    constexpr uint64_t NUMBER_OF_PUBLISHERS{SERVICE_REGISTRY_CHANGES_QUEUE_CAPACITY + 8U};
+    std::vector<std::unique_ptr<popo::UntypedPublisher>> publishers;
+    for (uint64_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+    {
+        publishers.emplace_back(std::make_unique<popo::UntypedPublisher>(
+            ServiceDescription(SERVICE, "instance", IdString_t(TruncateToCapacity, std::to_string(i).c_str()))));
+    }
+    triggerDiscoveryLoopAndWaitToFinish();
+
+    findService(SERVICE, nullopt, nullopt, MessagingPattern::PUB_SUB);
+    EXPECT_THAT(serviceContainer.size(), Eq(NUMBER_OF_PUBLISHERS));
+}
+
 //
 // Offer, StopOffer, Reoffer
 // Variation of PUB/SUB and REQ/RES
@@ -451,6 +518,9 @@ class ReferenceDiscovery
             services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
                              iox::SERVICE_DISCOVERY_EVENT_NAME);
+            services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                             iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                             iox::SERVICE_DISCOVERY_CHANGES_EVENT_NAME);
         }
     }
 
@@ -58,6 +58,8 @@ TEST(ChunkHeader_test, ChunkHeaderHasInitializedMembers)
 
     EXPECT_THAT(sut.sequenceNumber(), Eq(0U));
 
+    EXPECT_THAT(sut.sendTimestamp(), Eq(0U));
+
     EXPECT_THAT(sut.userHeaderId(), Eq(ChunkHeader::NO_USER_HEADER));
     EXPECT_THAT(sut.userHeaderSize(), Eq(0U));
     EXPECT_THAT(sut.userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
@@ -81,7 +83,7 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
     {
         uint32_t userHeaderSize{0U};
         uint8_t chunkHeaderVersion{0U};
-        uint8_t reserved{0U};
+        uint8_t extensions{0U};
         uint16_t userHeaderId{0};
         uint64_t originId{0U};
         uint64_t sequenceNumber{0U};
@@ -360,6 +362,56 @@ TEST(ChunkHeader_test, UsedChunkSizeIsSizeOfChunkHeaderPlusOneWhenUserPayloadIsO
     EXPECT_THAT(sut.usedSizeOfChunk(), Eq(sizeof(ChunkHeader) + USER_PAYLOAD_SIZE));
 }
 
+TEST(ChunkHeader_test, UsedChunkSizeContainsTheAlignedSendTimestampWhenTheChunkHasOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f179172a-9c73-4799-a16b-620887eca792");
+    constexpr uint64_t CHUNK_SIZE{2 * sizeof(ChunkHeader)};
+    constexpr uint64_t USER_PAYLOAD_SIZE{1U};
+    constexpr bool HAS_SEND_TIMESTAMP{true};
+
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE,
+                                                     iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                     iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                     iox::CHUNK_NO_USER_HEADER_ALIGNMENT,
+                                                     HAS_SEND_TIMESTAMP);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto& chunkSettings = chunkSettingsResult.value();
+
+    ChunkHeader sut{CHUNK_SIZE, chunkSettings};
+
+    const uint64_t EXPECTED_SEND_TIMESTAMP_OFFSET{
+        iox::align(sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, static_cast<uint64_t>(alignof(ChunkHeader::SendTimestamp_t)))};
+    EXPECT_THAT(sut.usedSizeOfChunk(), Eq(EXPECTED_SEND_TIMESTAMP_OFFSET + sizeof(ChunkHeader::SendTimestamp_t)));
+    EXPECT_THAT(sut.usedSizeOfChunk(), Le(chunkSettings.requiredChunkSize()));
+}
+
+TEST(ChunkHeader_test, SendTimestampIsNotAffectedByTheUserPayload)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13a5f385-f229-4b4d-aa13-c90ba8a369f2");
+    constexpr uint64_t CHUNK_SIZE{2 * sizeof(ChunkHeader)};
+    constexpr uint64_t USER_PAYLOAD_SIZE{13U};
+    constexpr bool HAS_SEND_TIMESTAMP{true};
+
+    auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE,
+                                                     iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                     iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                     iox::CHUNK_NO_USER_HEADER_ALIGNMENT,
+                                                     HAS_SEND_TIMESTAMP);
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto& chunkSettings = chunkSettingsResult.value();
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) test only
+    alignas(ChunkHeader) uint8_t storage[CHUNK_SIZE];
+    std::memset(&storage[0], 0xFF, CHUNK_SIZE);
+    auto* sut = new (&storage[0]) ChunkHeader{CHUNK_SIZE, chunkSettings};
+    EXPECT_THAT(sut->sendTimestamp(), Eq(0U));
+
+    std::memset(sut->userPayload(), 0xFF, USER_PAYLOAD_SIZE);
+    EXPECT_THAT(sut->sendTimestamp(), Eq(0U));
+
+    sut->~ChunkHeader();
+}
+
 TEST(ChunkHeader_test, ConstructorTerminatesWhenUserPayloadSizeExceedsChunkSize)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c8f911eb-ed0d-495a-8858-9fc45f5a06e8");
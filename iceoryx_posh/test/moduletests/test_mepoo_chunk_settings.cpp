@@ -113,6 +113,46 @@ TEST(ChunkSettings_test, CallingRequiredChunkSizeReturnsCorrectValue)
     EXPECT_THAT(sut.requiredChunkSize(), Eq(EXPECTED_SIZE));
 }
 
+TEST(ChunkSettings_test, CallingHasSendTimestampReturnsCorrectValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d759b80-c5a7-4fc1-bed9-516c682480c5");
+    constexpr uint64_t USER_PAYLOAD_SIZE{42U};
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT{iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT};
+    constexpr uint32_t USER_HEADER_SIZE{iox::CHUNK_NO_USER_HEADER_SIZE};
+    constexpr uint32_t USER_HEADER_ALIGNMENT{iox::CHUNK_NO_USER_HEADER_ALIGNMENT};
+
+    auto sutWithoutSendTimestamp =
+        ChunkSettings::create(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(sutWithoutSendTimestamp.has_error());
+    EXPECT_FALSE(sutWithoutSendTimestamp.value().hasSendTimestamp());
+
+    auto sutWithSendTimestamp =
+        ChunkSettings::create(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT, true);
+    ASSERT_FALSE(sutWithSendTimestamp.has_error());
+    EXPECT_TRUE(sutWithSendTimestamp.value().hasSendTimestamp());
+}
+
+TEST(ChunkSettings_test, RequiredChunkSizeContainsTheAlignedSendTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ea5b9e7-4a1b-4f1e-b42c-2805425823ff");
+    constexpr uint64_t USER_PAYLOAD_SIZE{13U};
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT{iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT};
+    constexpr uint32_t USER_HEADER_SIZE{iox::CHUNK_NO_USER_HEADER_SIZE};
+    constexpr uint32_t USER_HEADER_ALIGNMENT{iox::CHUNK_NO_USER_HEADER_ALIGNMENT};
+    constexpr bool HAS_SEND_TIMESTAMP{true};
+
+    const uint64_t EXPECTED_SIZE{
+        iox::align(sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, static_cast<uint64_t>(alignof(ChunkHeader::SendTimestamp_t)))
+        + sizeof(ChunkHeader::SendTimestamp_t)};
+
+    auto sutResult = ChunkSettings::create(
+        USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT, HAS_SEND_TIMESTAMP);
+    ASSERT_FALSE(sutResult.has_error());
+    auto& sut = sutResult.value();
+
+    EXPECT_THAT(sut.requiredChunkSize(), Eq(EXPECTED_SIZE));
+}
+
 // END GETTER METHOD TESTS
 
 // BEGIN EXCEEDING CHUNK SIZE TESTS
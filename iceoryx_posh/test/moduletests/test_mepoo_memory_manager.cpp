@@ -377,6 +377,142 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, getChunkSelectsBestFittingMemPoolWhenMultipleMemPoolsHaveTheSameSizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7dc7497-b7b6-49a1-938e-d9deb8f531b5");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    const std::vector<uint64_t> USER_PAYLOAD_SIZES{136U, 160U, 184U, 208U};
+
+    for (const auto size : USER_PAYLOAD_SIZES)
+    {
+        mempoolconf.addMemPool({size, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < USER_PAYLOAD_SIZES.size(); ++i)
+    {
+        auto chunkSettings =
+            ChunkSettings::create(USER_PAYLOAD_SIZES[i], iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+        sut->getChunk(chunkSettings)
+            .and_then([&](auto& chunk) {
+                EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(sut->getMemPoolInfo(i).m_chunkSize));
+                chunkStore.push_back(chunk);
+            })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+
+        EXPECT_THAT(sut->getMemPoolInfo(i).m_usedChunks, Eq(1U));
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkSizeBetweenTwoSizeClassesSelectsTheLargerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c463374-93cf-4be7-9b07-97bbf80a01b1");
+    constexpr uint32_t CHUNK_COUNT{10U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, emptyMemPoolWithNextLargerMemPoolFallbackAcquiresChunkFromLargerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9ca186e-a0e2-464a-bad3-2fa95fd298ac");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+    auto spilledChunkStore = getChunksFromSut(1U, chunkSettings_64);
+
+    ASSERT_THAT(spilledChunkStore.size(), Eq(1U));
+    EXPECT_THAT(spilledChunkStore[0].getChunkHeader()->chunkSize(), Eq(sut->getMemPoolInfo(2).m_chunkSize));
+    EXPECT_THAT(spilledChunkStore[0].getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_64));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_spilledChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_spilledChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, nextLargerMemPoolFallbackSkipsExhaustedLargerMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "57c4b9c5-16fb-42c0-9d3c-d2dfc2e641e1");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore_64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+    auto chunkStore_128 = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+    auto spilledChunkStore = getChunksFromSut(1U, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_spilledChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_spilledChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, nextLargerMemPoolFallbackFailsWhenAllLargerMemPoolsAreExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e39dc221-8b35-467f-a34f-55595f29666a");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore_64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_64)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_spilledChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_failedAllocations, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_failedAllocations, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, spilledChunkIsReturnedToTheLargerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b9acf493-29b3-4215-aab2-5c742aab5752");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.m_fallbackPolicy = iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore_64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+    {
+        auto spilledChunkStore = getChunksFromSut(1U, chunkSettings_64);
+        EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1U));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(1U));
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0eddc5b5-e28f-43df-9da7-2c12014284a5");
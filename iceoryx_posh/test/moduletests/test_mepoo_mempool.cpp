@@ -25,6 +25,9 @@
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
+#include <thread>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -300,6 +303,147 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetMinFreeIsNotRaisedByConcurrentAcquisitions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "006fc95f-b153-4c41-8878-0e23cd1bd160");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t CHUNKS_PER_THREAD{NUMBER_OF_CHUNKS / NUMBER_OF_THREADS};
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            for (uint32_t j = 0U; j < CHUNKS_PER_THREAD; ++j)
+            {
+                EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_THREADS * CHUNKS_PER_THREAD));
+}
+
+TEST_F(MemPool_test, AllocatedChunksAreCountedAndFreedChunksAreNotUsedAnymore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cc1191bb-b28d-4c7a-abae-06edceb05790");
+    constexpr uint32_t NUMBER_OF_ALLOCATIONS{5U};
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_ALLOCATIONS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+    sut.freeChunk(chunks.front());
+
+    EXPECT_THAT(sut.getAllocatedChunks(), Eq(NUMBER_OF_ALLOCATIONS));
+    EXPECT_THAT(sut.getInfo().m_allocatedChunks, Eq(NUMBER_OF_ALLOCATIONS));
+    EXPECT_THAT(sut.getInfo().m_usedChunks, Eq(NUMBER_OF_ALLOCATIONS - 1U));
+}
+
+TEST_F(MemPool_test, CachedChunksAreCountedAsAllocatedWhenTheyAreMarkedAsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8579fd1-febf-467a-b458-0bea40722dae");
+    constexpr uint32_t NUMBER_OF_CACHED_CHUNKS{10U};
+    constexpr uint32_t NUMBER_OF_HANDED_OUT_CHUNKS{3U};
+    std::vector<FreeListIndex_t> indices(NUMBER_OF_CACHED_CHUNKS);
+    ASSERT_THAT(sut.getChunksForCache(indices.data(), NUMBER_OF_CACHED_CHUNKS), Eq(NUMBER_OF_CACHED_CHUNKS));
+    EXPECT_THAT(sut.getAllocatedChunks(), Eq(0U));
+
+    sut.markCachedChunksAsUsed(NUMBER_OF_HANDED_OUT_CHUNKS);
+    sut.freeChunksFromCache(&indices[NUMBER_OF_HANDED_OUT_CHUNKS],
+                            NUMBER_OF_CACHED_CHUNKS - NUMBER_OF_HANDED_OUT_CHUNKS);
+
+    EXPECT_THAT(sut.getAllocatedChunks(), Eq(NUMBER_OF_HANDED_OUT_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_HANDED_OUT_CHUNKS));
+}
+
+TEST_F(MemPool_test, IncreaseFailedAllocationsIsReportedInTheInfo)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9202ed3a-9e9d-4624-aa68-465ef4ff6245");
+    sut.increaseFailedAllocations();
+    sut.increaseFailedAllocations();
+
+    EXPECT_THAT(sut.getFailedAllocations(), Eq(2U));
+    EXPECT_THAT(sut.getInfo().m_failedAllocations, Eq(2U));
+}
+
+TEST_F(MemPool_test, GetChunksForCacheAcquiresChunksAndReportsThemAsCached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "98cb6db6-0bea-4eeb-990d-75ea15ae43fb");
+    constexpr uint32_t NUMBER_OF_CACHED_CHUNKS{10U};
+    std::vector<FreeListIndex_t> indices(NUMBER_OF_CACHED_CHUNKS);
+
+    EXPECT_THAT(sut.getChunksForCache(indices.data(), NUMBER_OF_CACHED_CHUNKS), Eq(NUMBER_OF_CACHED_CHUNKS));
+
+    EXPECT_THAT(sut.getCachedChunks(), Eq(NUMBER_OF_CACHED_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_CACHED_CHUNKS));
+    EXPECT_THAT(sut.getInfo().m_cachedChunks, Eq(NUMBER_OF_CACHED_CHUNKS));
+}
+
+TEST_F(MemPool_test, GetChunksForCacheIsLimitedByTheNumberOfFreeChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87281dd5-1360-4d24-b29b-1118551f78db");
+    std::vector<FreeListIndex_t> indices(NUMBER_OF_CHUNKS + 1U);
+
+    EXPECT_THAT(sut.getChunksForCache(indices.data(), NUMBER_OF_CHUNKS + 1U), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getChunksForCache(indices.data(), 1U), Eq(0U));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, MarkCachedChunksAsUsedMovesChunksFromCachedToUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fa2ff8c1-ce0f-4e82-bc73-cb141bda88b1");
+    constexpr uint32_t NUMBER_OF_CACHED_CHUNKS{10U};
+    constexpr uint32_t NUMBER_OF_HANDED_OUT_CHUNKS{3U};
+    std::vector<FreeListIndex_t> indices(NUMBER_OF_CACHED_CHUNKS);
+    ASSERT_THAT(sut.getChunksForCache(indices.data(), NUMBER_OF_CACHED_CHUNKS), Eq(NUMBER_OF_CACHED_CHUNKS));
+
+    sut.markCachedChunksAsUsed(NUMBER_OF_HANDED_OUT_CHUNKS);
+
+    EXPECT_THAT(sut.getCachedChunks(), Eq(NUMBER_OF_CACHED_CHUNKS - NUMBER_OF_HANDED_OUT_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_HANDED_OUT_CHUNKS));
+}
+
+TEST_F(MemPool_test, FreeChunksFromCacheReturnsTheChunksToTheMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "73a05cd5-a951-419d-96b2-d1d4e8b0d7f3");
+    std::vector<FreeListIndex_t> indices(NUMBER_OF_CHUNKS);
+    ASSERT_THAT(sut.getChunksForCache(indices.data(), NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    sut.freeChunksFromCache(indices.data(), NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(sut.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+}
+
+TEST_F(MemPool_test, FreeChunksFromCacheWhenSameChunkIsTriedToFreeTwiceReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1a3d05b-e6a8-4e5f-b07d-998c9c30cf07");
+    std::vector<FreeListIndex_t> indices(2U);
+    ASSERT_THAT(sut.getChunksForCache(indices.data(), 2U), Eq(2U));
+    sut.freeChunksFromCache(indices.data(), 2U);
+
+    IOX_EXPECT_FATAL_FAILURE([&] { sut.freeChunksFromCache(indices.data(), 2U); },
+                             iox::PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+}
+
+TEST_F(MemPool_test, GetChunkFromIndexReturnsTheChunkOfTheIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8fcdcf01-c70f-47cb-9142-422215413508");
+    FreeListIndex_t index{0U};
+    ASSERT_THAT(sut.getChunksForCache(&index, 1U), Eq(1U));
+
+    auto* chunk = sut.getChunkFromIndex(index);
+    sut.freeChunksFromCache(&index, 1U);
+
+    EXPECT_THAT(sut.getChunk(), Eq(chunk));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
@@ -0,0 +1,241 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_cache.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class MemPoolCache_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_CHUNKS{40U};
+    static constexpr uint64_t CHUNK_SIZE{64U};
+    static constexpr uint64_t MEMORY_SIZE{3U * NUMBER_OF_CHUNKS * CHUNK_SIZE + 10000U};
+    static constexpr uint32_t BATCH_SIZE{8U};
+
+    MemPoolCache_test()
+        : allocator(m_rawMemory, MEMORY_SIZE)
+        , memPool(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator)
+        , otherMemPool(2U * CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator)
+        , chunkManagementPool(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator)
+    {
+    }
+
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t m_rawMemory[MEMORY_SIZE];
+    iox::BumpAllocator allocator;
+
+    MemPool memPool;
+    MemPool otherMemPool;
+    MemPool chunkManagementPool;
+
+    MemPoolCache sut{BATCH_SIZE};
+};
+
+TEST_F(MemPoolCache_test, DefaultConstructedCacheIsDisabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3373034d-8b01-415b-a54e-d13bccfda90f");
+    MemPoolCache disabledCache;
+
+    EXPECT_FALSE(disabledCache.isEnabled());
+    EXPECT_FALSE(disabledCache.tryGet(memPool, chunkManagementPool).has_value());
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(MemPoolCache_test, CacheWithBatchSizeIsEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "237573d7-17c5-4724-b120-6921c7fcd100");
+    EXPECT_TRUE(sut.isEnabled());
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(MemPoolCache_test, TryGetRefillsTheCacheWithOneBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6953b40f-c5a5-4f3b-804f-9959fa66ce49");
+    auto cachedChunk = sut.tryGet(memPool, chunkManagementPool);
+
+    ASSERT_TRUE(cachedChunk.has_value());
+    EXPECT_THAT(cachedChunk->chunk, Ne(nullptr));
+    EXPECT_THAT(cachedChunk->chunkManagement, Ne(nullptr));
+    EXPECT_THAT(sut.size(), Eq(BATCH_SIZE - 1U));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(BATCH_SIZE - 1U));
+    EXPECT_THAT(chunkManagementPool.getCachedChunks(), Eq(BATCH_SIZE - 1U));
+    EXPECT_THAT(memPool.getMinFree(), Eq(NUMBER_OF_CHUNKS - BATCH_SIZE));
+}
+
+TEST_F(MemPoolCache_test, TryGetHandsOutDistinctChunksWithoutAccessingTheMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8fd6bc53-5a82-49ec-9f0b-10e6afcfc168");
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < BATCH_SIZE; ++i)
+    {
+        sut.tryGet(memPool, chunkManagementPool).and_then([&](auto& cachedChunk) {
+            chunks.push_back(cachedChunk.chunk);
+        });
+        EXPECT_THAT(memPool.getMinFree(), Eq(NUMBER_OF_CHUNKS - BATCH_SIZE));
+    }
+
+    ASSERT_THAT(chunks.size(), Eq(BATCH_SIZE));
+    std::sort(chunks.begin(), chunks.end());
+    EXPECT_THAT(std::unique(chunks.begin(), chunks.end()), Eq(chunks.end()));
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(MemPoolCache_test, TryGetAccountsEachHandedOutChunkAsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d2bff90-147b-48c0-b980-33ebd041eb3c");
+    for (uint32_t i = 1U; i <= BATCH_SIZE + 1U; ++i)
+    {
+        ASSERT_TRUE(sut.tryGet(memPool, chunkManagementPool).has_value());
+
+        const auto numberOfCachedChunks = (i <= BATCH_SIZE) ? BATCH_SIZE - i : 2U * BATCH_SIZE - i;
+        EXPECT_THAT(memPool.getUsedChunks(), Eq(i));
+        EXPECT_THAT(memPool.getCachedChunks(), Eq(numberOfCachedChunks));
+        EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(i));
+        EXPECT_THAT(chunkManagementPool.getCachedChunks(), Eq(numberOfCachedChunks));
+    }
+}
+
+TEST_F(MemPoolCache_test, FreeingAHandedOutChunkDecreasesTheUsedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f4d1b7e-6a0e-4d36-9a44-0b3f1a8e2c57");
+    auto cachedChunk = sut.tryGet(memPool, chunkManagementPool);
+    ASSERT_TRUE(cachedChunk.has_value());
+
+    memPool.freeChunk(cachedChunk->chunk);
+    chunkManagementPool.freeChunk(cachedChunk->chunkManagement);
+
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(BATCH_SIZE - 1U));
+    EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(chunkManagementPool.getCachedChunks(), Eq(BATCH_SIZE - 1U));
+}
+
+TEST_F(MemPoolCache_test, ReleaseReturnsTheCachedChunksToTheMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "194d71e4-210e-4cc5-91de-655c6702dd69");
+    ASSERT_TRUE(sut.tryGet(memPool, chunkManagementPool).has_value());
+
+    sut.release();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(chunkManagementPool.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(1U));
+}
+
+TEST_F(MemPoolCache_test, ReleaseOfUnusedCacheDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b73d774-e64e-499d-950a-53b0b15c12b8");
+    sut.release();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(0U));
+}
+
+TEST_F(MemPoolCache_test, TryGetFromDifferentMemPoolKeepsTheCachedChunksOfThePreviousMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3288a8f-6877-4f66-b0dd-a1313f2b0a5d");
+    ASSERT_TRUE(sut.tryGet(memPool, chunkManagementPool).has_value());
+
+    ASSERT_TRUE(sut.tryGet(otherMemPool, chunkManagementPool).has_value());
+    ASSERT_TRUE(sut.tryGet(memPool, chunkManagementPool).has_value());
+
+    EXPECT_THAT(sut.size(), Eq(2U * BATCH_SIZE - 3U));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(BATCH_SIZE - 2U));
+    EXPECT_THAT(memPool.getMinFree(), Eq(NUMBER_OF_CHUNKS - BATCH_SIZE));
+    EXPECT_THAT(otherMemPool.getCachedChunks(), Eq(BATCH_SIZE - 1U));
+    EXPECT_THAT(chunkManagementPool.getCachedChunks(), Eq(2U * BATCH_SIZE - 3U));
+}
+
+TEST_F(MemPoolCache_test, TryGetFromFurtherMemPoolReleasesTheLeastRecentlyUsedMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "43824526-3d64-4d9a-b2ea-9d8dcfce6eaa");
+    constexpr uint32_t NUMBER_OF_FURTHER_MEMPOOLS{MemPoolCache::NUMBER_OF_SLOTS - 1U};
+    constexpr uint64_t FURTHER_MEMORY_SIZE{NUMBER_OF_FURTHER_MEMPOOLS * (NUMBER_OF_CHUNKS * CHUNK_SIZE + 4000U)};
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) static uint8_t furtherMemory[FURTHER_MEMORY_SIZE];
+    iox::BumpAllocator furtherAllocator(furtherMemory, FURTHER_MEMORY_SIZE);
+    std::vector<std::unique_ptr<MemPool>> furtherMemPools;
+    for (uint32_t i = 0U; i < NUMBER_OF_FURTHER_MEMPOOLS; ++i)
+    {
+        furtherMemPools.emplace_back(new MemPool(CHUNK_SIZE, NUMBER_OF_CHUNKS, furtherAllocator, furtherAllocator));
+    }
+
+    ASSERT_TRUE(sut.tryGet(memPool, chunkManagementPool).has_value());
+    ASSERT_TRUE(sut.tryGet(otherMemPool, chunkManagementPool).has_value());
+    for (auto& furtherMemPool : furtherMemPools)
+    {
+        ASSERT_TRUE(sut.tryGet(*furtherMemPool, chunkManagementPool).has_value());
+    }
+
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(otherMemPool.getCachedChunks(), Eq(BATCH_SIZE - 1U));
+    EXPECT_THAT(chunkManagementPool.getCachedChunks(), Eq(MemPoolCache::NUMBER_OF_SLOTS * (BATCH_SIZE - 1U)));
+    EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(MemPoolCache::NUMBER_OF_SLOTS + 1U));
+}
+
+TEST_F(MemPoolCache_test, TryGetFromExhaustedMemPoolFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "484e47fb-587b-4bd5-923b-7c5da51aabb7");
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_THAT(memPool.getChunk(), Ne(nullptr));
+    }
+
+    EXPECT_FALSE(sut.tryGet(memPool, chunkManagementPool).has_value());
+    EXPECT_THAT(chunkManagementPool.getCachedChunks(), Eq(0U));
+}
+
+TEST_F(MemPoolCache_test, RefillIsLimitedByTheAvailableChunkManagements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b76ca695-3252-4ae2-b7b0-3663cb643f3c");
+    constexpr uint32_t NUMBER_OF_AVAILABLE_CHUNK_MANAGEMENTS{3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS - NUMBER_OF_AVAILABLE_CHUNK_MANAGEMENTS; ++i)
+    {
+        ASSERT_THAT(chunkManagementPool.getChunk(), Ne(nullptr));
+    }
+
+    ASSERT_TRUE(sut.tryGet(memPool, chunkManagementPool).has_value());
+
+    EXPECT_THAT(sut.size(), Eq(NUMBER_OF_AVAILABLE_CHUNK_MANAGEMENTS - 1U));
+    EXPECT_THAT(memPool.getCachedChunks(), Eq(NUMBER_OF_AVAILABLE_CHUNK_MANAGEMENTS - 1U));
+    EXPECT_THAT(memPool.getMinFree(), Eq(NUMBER_OF_CHUNKS - BATCH_SIZE));
+}
+
+TEST_F(MemPoolCache_test, BatchSizeIsLimitedToCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26598ffd-61b6-4b18-9f3b-8530f0fd5c3c");
+    MemPoolCache largeCache{MemPoolCache::CAPACITY + 1U};
+
+    ASSERT_TRUE(largeCache.tryGet(memPool, chunkManagementPool).has_value());
+
+    EXPECT_THAT(largeCache.size(), Eq(MemPoolCache::CAPACITY - 1U));
+}
+
+} // namespace
@@ -109,6 +109,16 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(bool, transparentHugePages, false)
+
+        IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
+        IOX_BUILDER_PARAMETER(uint32_t, prefaultThreadCount, 1U)
+
+        IOX_BUILDER_PARAMETER(iox::NumaPolicy, numaPolicy, iox::NumaPolicy::DEFAULT)
+
+        IOX_BUILDER_PARAMETER(uint32_t, numaNode, 0U)
+
       public:
         iox::expected<SharedMemoryObject_MOCK, PosixSharedMemoryObjectError> create() noexcept
         {
@@ -205,6 +215,26 @@ TEST_F(MePooSegment_test, GetWriterGroup)
     EXPECT_THAT(sut->getWriterGroup(), Eq(iox::PosixGroup("iox_roudi_test2")));
 }
 
+TEST_F(MePooSegment_test, GetSharedMemoryOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d477b6a-9268-4bfe-ab09-008e45afee46");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SharedMemoryOptions sharedMemoryOptions;
+    sharedMemoryOptions.numaPolicy = iox::NumaPolicy::BIND;
+    sharedMemoryOptions.numaNode = 1U;
+    SUT sut{mepooConfig,
+            DEFAULT_DOMAIN_ID,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            sharedMemoryOptions};
+
+    EXPECT_THAT(sut.getSharedMemoryOptions().numaPolicy, Eq(iox::NumaPolicy::BIND));
+    EXPECT_THAT(sut.getSharedMemoryOptions().numaNode, Eq(1U));
+}
+
 TEST_F(MePooSegment_test, GetMemoryManager)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4bc4af78-4beb-42eb-aee4-0f7cffb66411");
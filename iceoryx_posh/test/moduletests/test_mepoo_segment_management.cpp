@@ -43,12 +43,57 @@ class MePooSegmentMock
     MePooSegmentMock(const MePooConfig& mempoolConfig [[maybe_unused]],
                      const DomainId domainId [[maybe_unused]],
                      iox::BumpAllocator& managementAllocator [[maybe_unused]],
-                     const PosixGroup& readerGroup [[maybe_unused]],
-                     const PosixGroup& writerGroup [[maybe_unused]],
-                     const MemoryInfo& memoryInfo [[maybe_unused]]) noexcept
+                     const PosixGroup& readerGroup,
+                     const PosixGroup& writerGroup,
+                     const MemoryInfo& memoryInfo [[maybe_unused]],
+                     const SharedMemoryOptions& sharedMemoryOptions) noexcept
+        : m_readerGroup(readerGroup)
+        , m_writerGroup(writerGroup)
+        , m_segmentId(nextSegmentId++)
+        , m_sharedMemoryOptions(sharedMemoryOptions)
     {
     }
+
+    PosixGroup getWriterGroup() const noexcept
+    {
+        return m_writerGroup;
+    }
+
+    PosixGroup getReaderGroup() const noexcept
+    {
+        return m_readerGroup;
+    }
+
+    MemoryManager& getMemoryManager() noexcept
+    {
+        return m_memoryManager;
+    }
+
+    uint64_t getSegmentId() const noexcept
+    {
+        return m_segmentId;
+    }
+
+    uint64_t getSegmentSize() const noexcept
+    {
+        return 0U;
+    }
+
+    const SharedMemoryOptions& getSharedMemoryOptions() const noexcept
+    {
+        return m_sharedMemoryOptions;
+    }
+
+    static uint64_t nextSegmentId;
+
+  private:
+    PosixGroup m_readerGroup;
+    PosixGroup m_writerGroup;
+    uint64_t m_segmentId{0U};
+    SharedMemoryOptions m_sharedMemoryOptions;
+    MemoryManager m_memoryManager;
 };
+uint64_t MePooSegmentMock::nextSegmentId{0U};
 
 class SegmentManager_test : public Test
 {
@@ -85,6 +130,20 @@ class SegmentManager_test : public Test
         return config;
     }
 
+    SegmentConfig getSegmentConfigWithSegmentsOnDistinctNumaNodes(const PosixGroup::groupName_t& writerGroup)
+    {
+        SegmentConfig config;
+        for (uint32_t numaNode = 0U; numaNode < 2U; ++numaNode)
+        {
+            SharedMemoryOptions sharedMemoryOptions;
+            sharedMemoryOptions.numaPolicy = NumaPolicy::BIND;
+            sharedMemoryOptions.numaNode = numaNode;
+            config.m_sharedMemorySegments.push_back(
+                {writerGroup, writerGroup, mepooConfig, MemoryInfo(), sharedMemoryOptions});
+        }
+        return config;
+    }
+
     SegmentConfig getSegmentConfigWithMaximumNumberOfSegements()
     {
         SegmentConfig config;
@@ -198,6 +257,52 @@ TEST_F(SegmentManager_test, addingMoreThanOneWriterGroupFails)
                              iox::PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT);
 }
 
+TEST_F(SegmentManager_test, addingMoreThanOneWriterGroupWithSegmentsOnDistinctNumaNodesWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8d9ba5c-324a-45ac-a6e7-92989d6597f6");
+    auto writerGroup = PosixGroup::getGroupOfCurrentProcess().getName();
+    SegmentConfig segmentConfig = getSegmentConfigWithSegmentsOnDistinctNumaNodes(writerGroup);
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    auto mapping = sut.getSegmentMappings(PosixUser::getUserOfCurrentProcess());
+
+    ASSERT_THAT(mapping.size(), Eq(2U));
+    EXPECT_TRUE(mapping[0].m_isWritable);
+    EXPECT_TRUE(mapping[1].m_isWritable);
+}
+
+TEST_F(SegmentManager_test, addingMoreThanOneWriterGroupWithSegmentsOnTheSameNumaNodeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71d70812-ee53-4cc0-8287-a1bbcb7e6aa8");
+    auto writerGroup = PosixGroup::getGroupOfCurrentProcess().getName();
+    SegmentConfig segmentConfig = getSegmentConfigWithSegmentsOnDistinctNumaNodes(writerGroup);
+    segmentConfig.m_sharedMemorySegments[1].m_sharedMemoryOptions.numaNode = 0U;
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    IOX_EXPECT_FATAL_FAILURE([&] { sut.getSegmentMappings(PosixUser::getUserOfCurrentProcess()); },
+                             iox::PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT);
+}
+
+TEST_F(SegmentManager_test, getMemoryManagerForUserPrefersSegmentOnPreferredNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1cf598d4-f1dd-43e7-87d5-eb3ecd2d906c");
+    auto writerGroup = PosixGroup::getGroupOfCurrentProcess().getName();
+    SegmentConfig segmentConfig = getSegmentConfigWithSegmentsOnDistinctNumaNodes(writerGroup);
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+    const auto user = PosixUser::getUserOfCurrentProcess();
+
+    auto defaultSegment = sut.getSegmentInformationWithWriteAccessForUser(user);
+    auto segmentOnNode0 = sut.getSegmentInformationWithWriteAccessForUser(user, 0U);
+    auto segmentOnNode1 = sut.getSegmentInformationWithWriteAccessForUser(user, 1U);
+    auto segmentOnUnknownNode = sut.getSegmentInformationWithWriteAccessForUser(user, 7U);
+
+    ASSERT_TRUE(defaultSegment.m_memoryManager.has_value());
+    ASSERT_TRUE(segmentOnNode1.m_memoryManager.has_value());
+    EXPECT_THAT(segmentOnNode0.m_segmentID, Eq(defaultSegment.m_segmentID));
+    EXPECT_THAT(segmentOnNode1.m_segmentID, Ne(defaultSegment.m_segmentID));
+    EXPECT_THAT(segmentOnUnknownNode.m_segmentID, Eq(defaultSegment.m_segmentID));
+}
+
 TEST_F(SegmentManager_test, addingMaximumNumberOfSegmentsWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "79db009a-da1a-4140-b375-f174af615d54");
@@ -59,7 +59,10 @@ class StubbedBaseSubscriber : public iox::popo::BaseSubscriber<port_t>
     using SubscriberParent::disableState;
     using SubscriberParent::enableEvent;
     using SubscriberParent::enableState;
+    using SubscriberParent::TAKE_ALL_BATCH_SIZE;
+    using SubscriberParent::takeAllChunks;
     using SubscriberParent::takeChunk;
+    using SubscriberParent::takeChunks;
 
     using SubscriberParent::port;
 };
@@ -161,6 +164,69 @@ TEST_F(BaseSubscriberTest, ReceiveForwardsErrorsFromUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(BaseSubscriberTest, TakeChunksCallForwardedToUnderlyingSubscriberPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8f912fe-fb7f-4ea3-aefb-411b7d3b5be2");
+    // ===== Setup ===== //
+    const iox::mepoo::ChunkHeader* chunkHeader = chunkMock.chunkHeader();
+    EXPECT_CALL(sut.port(), tryGetChunks(3U, _))
+        .WillOnce(Invoke([&](auto, auto onChunk) -> iox::expected<uint64_t, iox::popo::ChunkReceiveResult> {
+            onChunk(chunkHeader);
+            return iox::ok<uint64_t>(1U);
+        }));
+    // ===== Test ===== //
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    auto result = sut.takeChunks(3U, [&](const auto* chunk) { chunks.push_back(chunk); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(1U));
+    ASSERT_THAT(chunks.size(), Eq(1U));
+    EXPECT_EQ(chunks[0], chunkHeader);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BaseSubscriberTest, TakeAllChunksTakesBatchesUntilTheQueueIsDrained)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "389849e5-42ca-4e96-ad62-19013096c2f6");
+    // ===== Setup ===== //
+    constexpr uint64_t BATCH_SIZE{TestBaseSubscriber::TAKE_ALL_BATCH_SIZE};
+    const iox::mepoo::ChunkHeader* chunkHeader = chunkMock.chunkHeader();
+    auto provideChunks = [&](uint64_t numberOfChunks) {
+        return [=](auto, auto onChunk) -> iox::expected<uint64_t, iox::popo::ChunkReceiveResult> {
+            for (uint64_t i = 0U; i < numberOfChunks; ++i)
+            {
+                onChunk(chunkHeader);
+            }
+            return iox::ok(numberOfChunks);
+        };
+    };
+    EXPECT_CALL(sut.port(), tryGetChunks(BATCH_SIZE, _))
+        .WillOnce(Invoke(provideChunks(BATCH_SIZE)))
+        .WillOnce(Invoke(provideChunks(1U)));
+    // ===== Test ===== //
+    uint64_t numberOfCallbacks{0U};
+    auto result = sut.takeAllChunks([&](const auto*) { ++numberOfCallbacks; });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(BATCH_SIZE + 1U));
+    EXPECT_THAT(numberOfCallbacks, Eq(BATCH_SIZE + 1U));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BaseSubscriberTest, TakeAllChunksForwardsErrorsFromUnderlyingPortWhenNothingWasTaken)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c83c5ecc-397f-46ae-90a7-a34e48d7c5f3");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.port(), tryGetChunks)
+        .WillOnce(Return(ByMove(iox::err(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE))));
+    // ===== Test ===== //
+    auto result = sut.takeAllChunks([](const auto*) {});
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE, result.error());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(BaseSubscriberTest, ClearReceiveBufferCallForwardedToUnderlyingSubscriberPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "975653e3-4644-4a2e-8bc6-7af9830e3863");
@@ -23,9 +23,11 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/atomic.hpp"
 #include "iox/detail/hoofs_error_reporting.hpp"
@@ -35,6 +37,7 @@
 #include "test.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -89,6 +92,8 @@ class ChunkDistributor_test : public Test
     {
         static constexpr uint32_t MAX_QUEUES = MAX_NUMBER_QUEUES;
         static constexpr uint64_t MAX_HISTORY_CAPACITY = iox::MAX_PUBLISHER_HISTORY;
+        // the lookup of a queue by its unique id is tested with the tables like for the server and without them
+        static constexpr bool HAS_QUEUE_INDEX_TABLES = std::is_same<PolicyType, ThreadSafePolicy>::value;
     };
 
     struct ChunkQueueConfig
@@ -124,7 +129,7 @@ class ChunkDistributor_test : public Test
 
     static constexpr std::chrono::milliseconds BLOCKING_DURATION{100};
 
-    static constexpr iox::units::Duration DEADLOCK_TIMEOUT{2_s};
+    static constexpr iox::units::Duration DEADLOCK_TIMEOUT{5_s};
     Watchdog deadlockWatchdog{DEADLOCK_TIMEOUT};
 };
 template <typename PolicyType>
@@ -351,6 +356,80 @@ TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithPreviouslyAddedQueueRemovedRe
     EXPECT_FALSE(maybeIndex.has_value());
 }
 
+TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithStaleLastIndexAfterQueuesWereReplacedReturnsCurrentIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b696dd9-d905-4beb-bb83-694fbd902a85");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> storedQueues;
+    for (uint32_t i = 0U; i < TestFixture::MAX_NUMBER_QUEUES; ++i)
+    {
+        storedQueues.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(storedQueues.back().get()).has_error());
+    }
+
+    // every second queue is replaced by a new one, this invalidates the last known index of most of the queues
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> removedQueues;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> remainingQueues;
+    for (uint32_t i = 0U; i < TestFixture::MAX_NUMBER_QUEUES; ++i)
+    {
+        auto& queue = (i % 2U == 0U) ? removedQueues : remainingQueues;
+        queue.emplace_back(storedQueues[i]);
+    }
+    for (auto& queue : removedQueues)
+    {
+        ASSERT_FALSE(sut.tryRemoveQueue(queue.get()).has_error());
+        remainingQueues.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(remainingQueues.back().get()).has_error());
+    }
+
+    for (uint32_t i = 0U; i < TestFixture::MAX_NUMBER_QUEUES; ++i)
+    {
+        const uint32_t staleIndex = TestFixture::MAX_NUMBER_QUEUES - 1U - i;
+        sut.getQueueIndex(remainingQueues[i]->m_uniqueId, staleIndex)
+            .and_then([&](const auto& index) { EXPECT_THAT(index, Eq(i)); })
+            .or_else([] { GTEST_FAIL() << "Expected to get an index!"; });
+    }
+    for (uint32_t i = 0U; i < removedQueues.size(); ++i)
+    {
+        EXPECT_FALSE(sut.getQueueIndex(removedQueues[i]->m_uniqueId, 2U * i).has_value());
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithLastIndexOfAnotherQueueDeliversToQueueWithUniqueId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "659e7159-8ab2-40a6-a3b2-1cd09db2cb6e");
+    constexpr uint32_t LAST_KNOWN_QUEUE_INDEX_3{2U};
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    auto queueData3 = this->getChunkQueueData();
+    auto queueData4 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData3.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData4.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData1.get()).has_error());
+
+    // the last known index of the third queue now refers to the fourth queue
+    constexpr uint32_t DATA_TO_SEND{4242};
+    ASSERT_FALSE(
+        sut.deliverToQueue(queueData3->m_uniqueId, LAST_KNOWN_QUEUE_INDEX_3, this->allocateChunk(DATA_TO_SEND))
+            .has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue3(queueData3.get());
+    auto maybeSharedChunk = queue3.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(DATA_TO_SEND));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue4(queueData4.get());
+    EXPECT_FALSE(queue4.tryPop().has_value());
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithOneQueueDeliversOneChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5bc10e0a-d67b-4123-887c-a50dc16cf680");
@@ -485,6 +564,89 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithMultipleQueuesDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3cb920b7-31af-4d0b-8dec-1da5387d6e81");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = 13U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i * 43));
+    }
+    auto numberOfDeliveries = sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (auto k = 0U; k < NUMBER_OF_CHUNKS; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k * 43u));
+        }
+        EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithEmptyBatchDeliversNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab2d97c3-297b-4b69-b5f6-7a5937397147");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    std::vector<SharedChunk> chunks;
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks)), Eq(0U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesNotifiesTheConsumerOncePerBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a8bf06a-947e-4863-a33f-7109ffee03d5");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ConditionVariableData condVar("Horscht");
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS = 5U;
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+    sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks));
+
+    uint64_t numberOfNotifications{0U};
+    while (condVar.m_semaphore->tryWait().value())
+    {
+        ++numberOfNotifications;
+    }
+    EXPECT_THAT(numberOfNotifications, Eq(1U));
+    EXPECT_THAT(queue.size(), Eq(NUMBER_OF_CHUNKS));
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1ed709b1-9129-454b-8440-50463ba1c02e");
@@ -822,4 +984,395 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, SenderWaitingForMultipleFullBlockingQueuesIsRegisteredInEachOfThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ea58b74-8891-432f-b648-ec93b0eb78eb");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueDatas;
+    std::vector<ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>> queues;
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 2U;
+
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueDatas.emplace_back(this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER,
+                                                        VariantQueueTypes::FiFo_MultiProducerSingleConsumer));
+        queues.emplace_back(queueDatas.back().get());
+        queues.back().setCapacity(1U);
+        ASSERT_FALSE(sut.tryAddQueue(queueDatas.back().get(), 0U).has_error());
+    }
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(425U));
+
+    std::thread t1([&] { sut.deliverToAllStoredQueues(this->allocateChunk(1152U)); });
+
+    // the sender sleeps once for all full queues instead of polling them
+    while (!queueDatas[0]->m_waitingProducers.hasRegisteredProducers()
+           || !queueDatas[1]->m_waitingProducers.hasRegisteredProducers())
+    {
+        std::this_thread::yield();
+    }
+
+    for (auto& queue : queues)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(425U));
+    }
+
+    t1.join();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        EXPECT_FALSE(queueDatas[i]->m_waitingProducers.hasRegisteredProducers());
+        auto maybeSharedChunk = queues[i].tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1152U));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingQueueDeliversTheRemainingChunksInOrderWhenSpaceBecomesAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4bb5fac9-0c17-4b2d-81e2-d8d44189f734");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS = 3U;
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i + 71U));
+    }
+
+    Barrier isThreadStarted(1U);
+    iox::concurrent::Atomic<bool> wasBatchDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks)), Eq(1U));
+        wasBatchDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        std::this_thread::sleep_for(this->BLOCKING_DURATION);
+        EXPECT_THAT(wasBatchDelivered.load(), Eq(i + 1U == NUMBER_OF_CHUNKS));
+
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i + 71U));
+    }
+
+    t1.join();
+    EXPECT_THAT(wasBatchDelivered.load(), Eq(true));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueWhileDeliveryIsBlockedByThisQueueUnblocksDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e0ff9ed-cdd0-4bd7-93ce-651a9e7b85df");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(37U));
+
+    Barrier isThreadStarted(1U);
+    iox::concurrent::Atomic<bool> hasDeliveryReturned{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(73U));
+        hasDeliveryReturned = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(hasDeliveryReturned.load(), Eq(false));
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join();
+    EXPECT_THAT(hasDeliveryReturned.load(), Eq(true));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithoutHistoryDoesNotTakeTheLock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67e2400c-3acb-4f46-aa16-745e62d4b1b6");
+    constexpr uint64_t NO_HISTORY{0U};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, NO_HISTORY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    Barrier isLockAcquired(1U);
+    Barrier isChunkDelivered(1U);
+    std::thread t1([&] {
+        sutData->lock();
+        isLockAcquired.notify();
+        isChunkDelivered.wait();
+        sutData->unlock();
+    });
+
+    isLockAcquired.wait();
+
+    // with the ThreadSafePolicy this would block until the deadlock watchdog terminates the test if the lock is taken
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(4711U)), Eq(1U));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(true));
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, 0U, this->allocateChunk(42U)).has_error());
+
+    isChunkDelivered.notify();
+    t1.join();
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4711U));
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(42U));
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupWithoutHistoryDoesNotFailWhenTheLockIsHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b584ed8c-a8f0-43ef-ba22-e3dbece7a0e6");
+    constexpr uint64_t NO_HISTORY{0U};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, NO_HISTORY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    Barrier isLockAcquired(1U);
+    Barrier isCleanupDone(1U);
+    std::thread t1([&] {
+        sutData->lock();
+        isLockAcquired.notify();
+        isCleanupDone.wait();
+        sutData->unlock();
+    });
+
+    isLockAcquired.wait();
+
+    sut.cleanup();
+
+    isCleanupDone.notify();
+    t1.join();
+
+    IOX_TESTING_EXPECT_OK();
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupReleasesTheHistoryWhenTheLockIsHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f0c7a52-9d1e-4b86-a2f4-6e8d15c07b93");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+    ASSERT_THAT(this->mempool.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+
+    // an application which was terminated while updating the history never releases the lock
+    Barrier isLockAcquired(1U);
+    Barrier isCleanupDone(1U);
+    std::thread t1([&] {
+        sutData->lock();
+        isLockAcquired.notify();
+        isCleanupDone.wait();
+        sutData->unlock();
+    });
+
+    isLockAcquired.wait();
+
+    sut.cleanup();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+
+    isCleanupDone.notify();
+    t1.join();
+
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+    IOX_TESTING_EXPECT_OK();
+}
+
+TYPED_TEST(ChunkDistributor_test, HistoryKeepsTheLatestChunksInOrderWhenItWrapsAround)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2e5b8a1-7f04-4d39-9e6b-48a0d3f1c5e7");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    const auto numberOfChunks = this->HISTORY_SIZE + this->HISTORY_SIZE / 2U;
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(this->HISTORY_SIZE));
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    for (auto i = numberOfChunks - this->HISTORY_SIZE; i < numberOfChunks; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovedQueueStaysAccessibleWhileTheSenderHoldsThePreviousSnapshot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "84b4bdeb-b937-42c1-85d8-5309abfffd4b");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // a sender which is stopped while delivering a chunk keeps the active snapshot pinned
+    const auto pinnedSnapshot = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaders[pinnedSnapshot].fetch_add(1U);
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+    EXPECT_THAT(sut.isQueueAccessibleBySender(queueData.get()), Eq(true));
+
+    sutData->m_queueSnapshotReaders[pinnedSnapshot].fetch_sub(1U);
+
+    EXPECT_THAT(sut.isQueueAccessibleBySender(queueData.get()), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, ModificationIsPendingUntilTheSenderReleasesThePreviousSnapshot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a1e7c3d-0b92-4f68-b4d7-e19c6a2f803b");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    const auto pinnedSnapshot = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaders[pinnedSnapshot].fetch_add(1U);
+
+    // the first modification uses the other snapshot, the second one would have to reuse the pinned snapshot
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+    EXPECT_THAT(sut.publishPendingQueues(), Eq(false));
+    EXPECT_THAT(sut.isQueueAccessibleBySender(queueData.get()), Eq(true));
+
+    sutData->m_queueSnapshotReaders[pinnedSnapshot].fetch_sub(1U);
+
+    EXPECT_THAT(sut.publishPendingQueues(), Eq(true));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(true));
+}
+
+TYPED_TEST(ChunkDistributor_test, PendingModificationIsPublishedWhenTheSenderIsConsideredDead)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "648b398e-b989-4673-851e-084e552ad8b2");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    iox::runtime::Heartbeat senderHeartbeat;
+    sutData->m_senderHeartbeat = &senderHeartbeat;
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // a sender which was terminated while delivering a chunk never releases the snapshot and stops beating
+    const auto pinnedSnapshot = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaders[pinnedSnapshot].fetch_add(1U);
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_THAT(sut.publishPendingQueues(), Eq(false));
+
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(iox::runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds())
+        + this->BLOCKING_DURATION);
+
+    EXPECT_THAT(sut.publishPendingQueues(), Eq(true));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(true));
+    EXPECT_THAT(sutData->m_queueSnapshotReaders[pinnedSnapshot].load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, PendingModificationIsPublishedWhenTheSenderIsDetached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3a9d1b7-52c6-4f0a-8d14-6b7e0c2f9a58");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    iox::runtime::Heartbeat senderHeartbeat;
+    sutData->m_senderHeartbeat = &senderHeartbeat;
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    const auto pinnedSnapshot = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaders[pinnedSnapshot].fetch_add(1U);
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_THAT(sut.publishPendingQueues(), Eq(false));
+
+    // RouDi detaches the sender when it destroys the port, e.g. after the heartbeat slot was released and reused
+    sut.detachSenderFromOwner();
+    EXPECT_THAT(sutData->m_senderHeartbeat.get(), Eq(nullptr));
+
+    EXPECT_THAT(sut.publishPendingQueues(), Eq(true));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(true));
+
+    sut.removeAllQueues();
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+    EXPECT_THAT(sut.isQueueAccessibleBySender(queueData.get()), Eq(false));
+    IOX_TESTING_EXPECT_OK();
+}
+
+TYPED_TEST(ChunkDistributor_test, QueuesOfADetachedSenderAreModifiedWhenTheLockIsHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b64d0f2-1c3a-4e85-8f7d-a52e6b9c1d04");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // the owner was terminated while updating the history and never releases the lock
+    Barrier isLockAcquired(1U);
+    Barrier isRemovalDone(1U);
+    std::thread t1([&] {
+        sutData->lock();
+        isLockAcquired.notify();
+        isRemovalDone.wait();
+        sutData->unlock();
+    });
+
+    isLockAcquired.wait();
+
+    sut.detachSenderFromOwner();
+    sut.removeAllQueues();
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+
+    isRemovalDone.notify();
+    t1.join();
+
+    IOX_TESTING_EXPECT_OK();
+}
+
 } // namespace
@@ -268,15 +268,34 @@ template <typename PolicyType>
 class ChunkQueueFiFo_test : public Test, public ChunkQueue_testBase
 {
   public:
-    void SetUp() override {};
+    void SetUp() override
+    {
+        iox::build::InterProcessSemaphore::Builder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(m_producerWakeUpSemaphore)
+            .expect("Creating a semaphore must not fail");
+    }
     void TearDown() override {};
 
     using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, PolicyType>;
 
+    bool wasProducerWokenUp()
+    {
+        return m_producerWakeUpSemaphore->tryWait().expect("Waiting on a semaphore must not fail");
+    }
+
     ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA,
                                  iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+
+    ChunkQueueData_t m_blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                                         iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> m_blockingPopper{&m_blockingChunkData};
+    ChunkQueuePusher<ChunkQueueData_t> m_blockingPusher{&m_blockingChunkData};
+
+    iox::optional<iox::build::InterProcessSemaphore> m_producerWakeUpSemaphore;
 };
 
 TYPED_TEST(ChunkQueueFiFo_test, InitialSize)
@@ -323,6 +342,62 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, RegisteredProducerIsWokenUpWhenAChunkIsPoppedFromBlockingQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ff4ae82-219b-4679-ad0b-d36d9255997d");
+    auto chunk = this->allocateChunk();
+    EXPECT_TRUE(this->m_blockingPusher.push(chunk));
+    auto slot = this->m_blockingChunkData.m_waitingProducers.registerProducer(*this->m_producerWakeUpSemaphore);
+    ASSERT_TRUE(slot.has_value());
+
+    EXPECT_TRUE(this->m_blockingPopper.tryPop().has_value());
+
+    EXPECT_TRUE(this->wasProducerWokenUp());
+    this->m_blockingChunkData.m_waitingProducers.deregisterProducer(slot.value());
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, RegisteredProducerIsWokenUpWhenBlockingQueueIsCleared)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bc60a121-bd63-48f6-972e-699a1100b912");
+    auto chunk = this->allocateChunk();
+    EXPECT_TRUE(this->m_blockingPusher.push(chunk));
+    auto slot = this->m_blockingChunkData.m_waitingProducers.registerProducer(*this->m_producerWakeUpSemaphore);
+    ASSERT_TRUE(slot.has_value());
+
+    this->m_blockingPopper.clear();
+
+    EXPECT_TRUE(this->wasProducerWokenUp());
+    this->m_blockingChunkData.m_waitingProducers.deregisterProducer(slot.value());
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PopFromBlockingQueueWithoutRegisteredProducerDoesNotWakeUpAnybody)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9634e64-1a9a-4191-9efb-98b6dda88745");
+    auto chunk = this->allocateChunk();
+    EXPECT_TRUE(this->m_blockingPusher.push(chunk));
+    auto slot = this->m_blockingChunkData.m_waitingProducers.registerProducer(*this->m_producerWakeUpSemaphore);
+    ASSERT_TRUE(slot.has_value());
+    this->m_blockingChunkData.m_waitingProducers.deregisterProducer(slot.value());
+
+    EXPECT_TRUE(this->m_blockingPopper.tryPop().has_value());
+
+    EXPECT_FALSE(this->wasProducerWokenUp());
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PopFromQueueWhichDoesNotBlockProducerDoesNotWakeUpRegisteredProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ebc3cfa9-c573-4f1e-8314-4168bcae1ab9");
+    auto chunk = this->allocateChunk();
+    EXPECT_TRUE(this->m_pusher.push(chunk));
+    auto slot = this->m_chunkData.m_waitingProducers.registerProducer(*this->m_producerWakeUpSemaphore);
+    ASSERT_TRUE(slot.has_value());
+
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+
+    EXPECT_FALSE(this->wasProducerWokenUp());
+    this->m_chunkData.m_waitingProducers.deregisterProducer(slot.value());
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
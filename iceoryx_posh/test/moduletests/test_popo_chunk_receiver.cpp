@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -184,6 +185,151 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getBatchFromEmptyQueueFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c114b146-9e58-4e04-9953-489bfbc44292");
+    bool wasCalled{false};
+    auto result = m_chunkReceiver.tryGetBatch(10U, [&](const auto*) { wasCalled = true; });
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    EXPECT_FALSE(wasCalled);
+}
+
+TEST_F(ChunkReceiver_test, getBatchProvidesTheChunksInOrderAndTheyCanBeReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "49c7efe8-0efc-405c-9c3b-da5a815257ad");
+    constexpr uint64_t NUMBER_OF_CHUNKS{5U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        static_cast<DummySample*>(new (sharedChunk.getUserPayload()) DummySample())->dummy = i;
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    auto result = m_chunkReceiver.tryGetBatch(NUMBER_OF_CHUNKS + 1U, [&](const auto* chunkHeader) {
+        chunks.push_back(chunkHeader);
+    });
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(NUMBER_OF_CHUNKS));
+    ASSERT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_TRUE(m_chunkReceiver.empty());
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunks[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunks[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getBatchIsLimitedByMaxNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f18d988-f5a6-40f0-995a-e1578b3681fb");
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    }
+
+    uint64_t numberOfCalls{0U};
+    auto result = m_chunkReceiver.tryGetBatch(2U, [&](const auto*) { ++numberOfCalls; });
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(2U));
+    EXPECT_THAT(numberOfCalls, Eq(2U));
+    EXPECT_THAT(m_chunkReceiver.size(), Eq(1U));
+}
+
+TEST_F(ChunkReceiver_test, getBatchWithTooManyChunksHeldFailsWithoutDroppingChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b82ff7f-d822-4331-a845-34c088844767");
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.push_back(maybeChunkHeader.value());
+    }
+
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    auto result = m_chunkReceiver.tryGetBatch(2U, [](const auto*) {});
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_THAT(m_chunkReceiver.size(), Eq(1U));
+
+    m_chunkReceiver.release(chunks.back());
+    result = m_chunkReceiver.tryGetBatch(2U, [](const auto*) {});
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(1U));
+}
+
+TEST_F(ChunkReceiver_test, getDoesNotRecordTheLatencyOfChunksWithoutSendTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be5eb595-81b4-4621-89d1-62b25e83749f");
+    iox::popo::LatencyHistogram latencyHistogram;
+    m_chunkReceiverData.m_latencyHistogram = &latencyHistogram;
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->sendTimestamp(), Eq(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+
+    EXPECT_THAT(latencyHistogram.drain().m_numberOfValues, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getAndGetBatchRecordTheLatencyOfChunksWithSendTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4ab40d7d-67d9-4b2a-9360-550996983771");
+    iox::popo::LatencyHistogram latencyHistogram;
+    m_chunkReceiverData.m_latencyHistogram = &latencyHistogram;
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<iox::DefaultChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+    constexpr bool STAMP_SEND_TIMESTAMP{true};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      STAMP_SEND_TIMESTAMP};
+    iox::popo::ChunkSender<ChunkSenderData_t> chunkSender{&chunkSenderData};
+    ASSERT_FALSE(chunkSender.tryAddQueue(&m_chunkReceiverData).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = chunkSender.tryAllocate(iox::popo::UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                        sizeof(DummySample),
+                                                        alignof(DummySample),
+                                                        iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                        iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkSender.send(*maybeChunkHeader);
+    }
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->sendTimestamp(), Ne(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    auto result =
+        m_chunkReceiver.tryGetBatch(NUMBER_OF_CHUNKS, [&](const auto* chunkHeader) { chunks.push_back(chunkHeader); });
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(NUMBER_OF_CHUNKS - 1U));
+    for (const auto* chunkHeader : chunks)
+    {
+        m_chunkReceiver.release(chunkHeader);
+    }
+
+    EXPECT_THAT(latencyHistogram.drain().m_numberOfValues, Eq(NUMBER_OF_CHUNKS));
+
+    chunkSender.releaseAll();
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a47fd0e-a217-4565-98af-05779c938340");
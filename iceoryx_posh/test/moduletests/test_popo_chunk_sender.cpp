@@ -36,7 +36,11 @@
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -57,6 +61,7 @@ class ChunkSender_test : public Test
         m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
         m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
         m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+        m_chunkSenderDataWithChunkCache.m_memPoolCache = &m_memPoolCache;
     }
 
     ~ChunkSender_test()
@@ -112,9 +117,14 @@ class ChunkSender_test : public Test
         &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0}; // must be 0 for test
     ChunkSenderData_t m_chunkSenderDataWithHistory{
         &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, HISTORY_CAPACITY};
+    static constexpr uint32_t CHUNK_CACHE_SIZE = 4;
+    iox::mepoo::MemPoolCache m_memPoolCache{CHUNK_CACHE_SIZE};
+    ChunkSenderData_t m_chunkSenderDataWithChunkCache{&m_memoryManager,
+                                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithHistory{&m_chunkSenderDataWithHistory};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithChunkCache{&m_chunkSenderDataWithChunkCache};
 };
 
 TEST_F(ChunkSender_test, allocate_OneChunkWithoutUserHeaderAndSmallUserPayloadAlignmentResultsInSmallChunk)
@@ -435,6 +445,201 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1160c20-d452-46ea-b541-61c2e67085b5");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        new ((*maybeChunkHeader)->userPayload()) DummySample{i};
+        chunkHeaders.emplace_back(*maybeChunkHeader);
+    }
+
+    auto numberOfDeliveries = m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(static_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+
+    auto maybePreviousChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(maybePreviousChunk.has_value());
+    EXPECT_THAT(*maybePreviousChunk, Eq(chunkHeaders.back()));
+}
+
+TEST_F(ChunkSender_test, sendBatchWithInvalidChunkDeliversOnlyTheValidChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b009123d-bf4a-4f15-8863-3fecba6326f5");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    ChunkMock<bool> myCrazyChunk;
+    iox::mepoo::ChunkHeader* chunkHeaders[] = {myCrazyChunk.chunkHeader(), *maybeChunkHeader};
+    auto numberOfDeliveries = m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader(), Eq(*maybeChunkHeader));
+    EXPECT_TRUE(myQueue.empty());
+}
+
+TEST_F(ChunkSender_test, sendUpdatesTheStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c813577-eb48-404f-927c-5cc0324527f7");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    iox::mepoo::ChunkHeader* lastChunkHeader{nullptr};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        lastChunkHeader = *maybeChunkHeader;
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    const auto& statistics = m_chunkSenderData.m_statistics;
+    EXPECT_THAT(statistics.m_numberOfSentChunks.load(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(statistics.m_numberOfSentUserPayloadBytes.load(), Eq(NUMBER_OF_CHUNKS * sizeof(DummySample)));
+    EXPECT_THAT(statistics.m_lastUserPayloadSize.load(), Eq(sizeof(DummySample)));
+    EXPECT_THAT(statistics.m_lastChunkSize.load(), Eq(lastChunkHeader->chunkSize()));
+    EXPECT_THAT(statistics.m_lastSendTimestampInNanoseconds.load(), Ne(0U));
+}
+
+TEST_F(ChunkSender_test, sendWithoutSendTimestampUpdatesTheLastSendTimestampAndInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b1c8a5e-3f7d-4e62-9a41-6d2e7c95b8f3");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{2U};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        EXPECT_THAT((*maybeChunkHeader)->sendTimestamp(), Eq(0U));
+        m_chunkSender.send(*maybeChunkHeader);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const auto& statistics = m_chunkSenderData.m_statistics;
+    EXPECT_THAT(statistics.m_lastSendTimestampInNanoseconds.load(), Ne(0U));
+    EXPECT_THAT(statistics.m_lastSendIntervalInNanoseconds.load(), Ne(0U));
+}
+
+TEST_F(ChunkSender_test, sendWithSendTimestampUpdatesTheLastSendTimestampAndInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61f3ca3b-c655-475d-ba27-ff472e8aadf9");
+    ChunkSenderData_t chunkSenderDataWithSendTimestamp{&m_memoryManager,
+                                                       iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                       0,
+                                                       iox::mepoo::MemoryInfo(),
+                                                       true};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderDataWithSendTimestamp};
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{2U};
+    iox::mepoo::ChunkHeader* lastChunkHeader{nullptr};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = sut.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                sizeof(DummySample),
+                                                alignof(DummySample),
+                                                USER_HEADER_SIZE,
+                                                USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        lastChunkHeader = *maybeChunkHeader;
+        sut.send(*maybeChunkHeader);
+    }
+
+    const auto& statistics = chunkSenderDataWithSendTimestamp.m_statistics;
+    EXPECT_THAT(statistics.m_numberOfSentChunks.load(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(statistics.m_lastSendTimestampInNanoseconds.load(), Eq(lastChunkHeader->sendTimestamp()));
+    EXPECT_THAT(statistics.m_lastSendTimestampInNanoseconds.load(), Ne(0U));
+    EXPECT_THAT(statistics.m_lastSendIntervalInNanoseconds.load(), Ne(0U));
+
+    sut.releaseAll();
+}
+
+TEST_F(ChunkSender_test, sendBatchUpdatesTheStatisticsForAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "84bd0569-f1d6-4285-aba3-e03b2153307a");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders.emplace_back(*maybeChunkHeader);
+    }
+
+    m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders));
+
+    const auto& statistics = m_chunkSenderData.m_statistics;
+    EXPECT_THAT(statistics.m_numberOfSentChunks.load(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(statistics.m_numberOfSentUserPayloadBytes.load(), Eq(NUMBER_OF_CHUNKS * sizeof(DummySample)));
+}
+
+TEST_F(ChunkSender_test, sendToFullQueueCountsTheLostChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e469d9e9-d0bd-473d-8954-3ac89b1079f9");
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    myQueue.setCapacity(1U);
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_numberOfSentChunks.load(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(m_chunkSenderData.m_numberOfLostChunks.load(), Eq(NUMBER_OF_CHUNKS - 1U));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -559,6 +764,46 @@ TEST_F(ChunkSender_test, sendToQueueWithInvalidChunkTriggersTheErrorHandler)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
 }
 
+TEST_F(ChunkSender_test, prepareSendToQueueReturnsTheChunkWhichIsDeliveredWithDeliverToQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "42c18246-45fa-4522-a39b-281dfa514c44");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> queuePopper(&m_chunkQueueData);
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto chunkHeader = *maybeChunkHeader;
+    uint64_t EXPECTED_SAMPLE_DATA{37};
+    new (chunkHeader->userPayload()) DummySample{EXPECTED_SAMPLE_DATA};
+    auto chunk = m_chunkSender.prepareSendToQueue(chunkHeader);
+    ASSERT_TRUE(chunk.has_value());
+    EXPECT_THAT(chunk->getChunkHeader(), Eq(chunkHeader));
+    EXPECT_FALSE(queuePopper.tryPop().has_value());
+
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    EXPECT_FALSE(m_chunkSender.deliverToQueue(m_chunkQueueData.m_uniqueId, EXPECTED_QUEUE_INDEX, chunk.value())
+                     .has_error());
+
+    auto maybeSharedChunk = queuePopper.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    auto receivedData = *(static_cast<DummySample*>(maybeSharedChunk.value().getUserPayload()));
+    EXPECT_THAT(receivedData.dummy, Eq(EXPECTED_SAMPLE_DATA));
+}
+
+TEST_F(ChunkSender_test, prepareSendToQueueWithInvalidChunkReturnsNulloptAndTriggersTheErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8ac4a8d1-d25b-460c-843f-ac7d87a6d418");
+    ChunkMock<bool> myCrazyChunk;
+    EXPECT_FALSE(m_chunkSender.prepareSendToQueue(myCrazyChunk.chunkHeader()).has_value());
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER);
+}
+
 TEST_F(ChunkSender_test, pushToHistory)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5ef98161-c7f9-455b-a9db-8eaa1a6b3342");
@@ -805,6 +1050,62 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, allocate_WithChunkCacheAcquiresChunksInBatches)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d8b7d78-e0e0-44e2-810e-9a90d8493dab");
+    std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+    for (uint32_t i = 0; i < CHUNK_CACHE_SIZE; i++)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithChunkCache.tryAllocate(
+            UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, 0U, 1U);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders.push_back(*maybeChunkHeader);
+
+        EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_minFreeChunks, Eq(NUM_CHUNKS_IN_POOL - CHUNK_CACHE_SIZE));
+    }
+
+    std::sort(chunkHeaders.begin(), chunkHeaders.end());
+    EXPECT_THAT(std::unique(chunkHeaders.begin(), chunkHeaders.end()), Eq(chunkHeaders.end()));
+}
+
+TEST_F(ChunkSender_test, allocateAndReleaseWithChunkCacheReportExactUsedAndCachedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1f0a8e2-59c4-4a7b-8a63-2d5e94b7f3a1");
+    std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+    for (uint32_t i = 1U; i <= CHUNK_CACHE_SIZE; i++)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithChunkCache.tryAllocate(
+            UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, 0U, 1U);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders.push_back(*maybeChunkHeader);
+
+        EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(i));
+        EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_cachedChunks, Eq(CHUNK_CACHE_SIZE - i));
+    }
+
+    for (uint32_t i = 1U; i <= CHUNK_CACHE_SIZE; i++)
+    {
+        m_chunkSenderWithChunkCache.release(chunkHeaders[i - 1U]);
+
+        EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_CACHE_SIZE - i));
+        EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_cachedChunks, Eq(0U));
+    }
+}
+
+TEST_F(ChunkSender_test, releaseAllReturnsTheChunksInTheChunkCache)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ad04564b-ed57-43b9-a2ac-785d27ec0a7e");
+    auto maybeChunkHeader = m_chunkSenderWithChunkCache.tryAllocate(
+        UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, 0U, 1U);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_cachedChunks, Eq(CHUNK_CACHE_SIZE - 1U));
+
+    m_chunkSenderWithChunkCache.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_cachedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
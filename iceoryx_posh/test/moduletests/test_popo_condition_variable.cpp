@@ -137,7 +137,7 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
     ConditionVariableData sut;
     for (auto& notification : sut.m_activeNotifications)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(notification.load(), Eq(0U));
     }
 }
 
@@ -152,7 +152,7 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRunt
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
     for (auto& notification : m_condVarData.m_activeNotifications)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(notification.load(), Eq(0U));
     }
 }
 
@@ -164,14 +164,10 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     sut.notify();
     for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER; i++)
     {
-        if (i == EVENT_INDEX)
-        {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(true));
-        }
-        else
-        {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(false));
-        }
+        const auto word = i / ConditionVariableData::BITS_PER_NOTIFICATION_WORD;
+        const auto bit = i % ConditionVariableData::BITS_PER_NOTIFICATION_WORD;
+        const bool isActive = (m_condVarData.m_activeNotifications[word].load() & (1ULL << bit)) != 0U;
+        EXPECT_THAT(isActive, Eq(i == EVENT_INDEX));
     }
 }
 
@@ -422,7 +418,7 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
         for (const auto& notification : m_condVarData.m_activeNotifications)
         {
-            EXPECT_THAT(notification.load(), Eq(false));
+            EXPECT_THAT(notification.load(), Eq(0U));
         }
     });
 
@@ -494,4 +490,112 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, SpinDurationIsZeroByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7e23740-1759-47f6-bf12-b4c116d0a866");
+    EXPECT_THAT(m_waiter.spinDuration(), Eq(iox::units::Duration::zero()));
+}
+
+TEST_F(ConditionVariable_test, SetSpinDurationWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ce2721b-6680-4cb1-b592-12efcf47bcb3");
+    m_waiter.setSpinDuration(42_us);
+    EXPECT_THAT(m_waiter.spinDuration(), Eq(42_us));
+}
+
+TEST_F(ConditionVariable_test, SetSpinDurationEnablesSpinningOnlyForNonZeroDuration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5a0e3b9-7c41-4f26-8e13-2b9f6a4c0d57");
+    EXPECT_FALSE(m_condVarData.m_isSpinEnabled.load());
+
+    m_waiter.setSpinDuration(42_us);
+    EXPECT_TRUE(m_condVarData.m_isSpinEnabled.load());
+
+    m_waiter.setSpinDuration(iox::units::Duration::zero());
+    EXPECT_FALSE(m_condVarData.m_isSpinEnabled.load());
+}
+
+TEST_F(ConditionVariable_test, NotifyWithoutSpinningPostsSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e7b2c19-a803-4d5f-b6e2-91c7f0a35d68");
+    m_notifiers[3U].notify();
+
+    auto wasPosted = m_condVarData.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_TRUE(wasPosted.value());
+}
+
+TEST_F(ConditionVariable_test, NotifyWhileListenerSpinsReturnsNotificationWithoutPostingSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f2df7ef-ee93-4211-a9c9-215e3bfac0ec");
+    m_waiter.setSpinDuration(1_s);
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] { activeNotifications = m_waiter.wait(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds() / 2U));
+    m_notifiers[3U].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(3U));
+
+    auto wasPosted = m_condVarData.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_FALSE(wasPosted.value());
+}
+
+TEST_F(ConditionVariable_test, WaitFallsBackToSemaphoreWhenSpinDurationElapsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a556b42-047b-4762-84bc-f5ffe51d184b");
+    m_waiter.setSpinDuration(1_ms);
+
+    iox::concurrent::Atomic<bool> isThreadFinished{false};
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] {
+        activeNotifications = m_waiter.wait();
+        isThreadFinished = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds()));
+    EXPECT_FALSE(isThreadFinished.load());
+    EXPECT_FALSE(m_condVarData.m_listenerIsSpinning.load());
+    m_notifiers[5U].notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(5U));
+}
+
+TEST_F(ConditionVariable_test, TimedWaitWithSpinDurationLongerThanTimeoutReturnsAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71d6102e-c3b1-4dc3-9e77-e9f63ee193db");
+    m_waiter.setSpinDuration(10_s);
+
+    auto start = std::chrono::steady_clock::now();
+    auto activeNotifications = m_waiter.timedWait(m_timingTestTime);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(activeNotifications.empty());
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(),
+                Ge(static_cast<int64_t>(m_timingTestTime.toMilliseconds())));
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(),
+                Lt(static_cast<int64_t>(m_timeToWait.toMilliseconds())));
+}
+
+TEST_F(ConditionVariable_test, DestroyWakesUpSpinningWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c0762186-44e1-4c7d-b77d-ac84628b2d86");
+    m_waiter.setSpinDuration(10_s);
+
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] { activeNotifications = m_waiter.wait(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds() / 2U));
+    m_waiter.destroy();
+    waiter.join();
+
+    EXPECT_TRUE(activeNotifications.empty());
+}
+
 } // namespace
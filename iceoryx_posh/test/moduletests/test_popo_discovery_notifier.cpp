@@ -0,0 +1,139 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class DiscoveryNotifier_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_watchdog.watchAndActOnFailure([&] { std::terminate(); });
+    }
+
+    std::vector<uint64_t> collect(const uint64_t begin, const uint64_t count)
+    {
+        std::vector<uint64_t> indices;
+        m_sut.forEachNotification(begin, count, [&](const uint64_t index) { indices.push_back(index); });
+        return indices;
+    }
+
+    DiscoveryNotifierData m_data;
+    DiscoveryListener m_sut{m_data};
+    Watchdog m_watchdog{2_s};
+};
+
+TEST_F(DiscoveryNotifier_test, TimedWaitWithoutNotificationTimesOut)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0979d516-df5f-4cb6-b8af-9b2e9950ad26");
+    EXPECT_FALSE(m_sut.timedWait(1_ms));
+    EXPECT_TRUE(collect(0U, DiscoveryNotifierData::CAPACITY).empty());
+}
+
+TEST_F(DiscoveryNotifier_test, TimedWaitReturnsAfterNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0deb842-7d15-4c3a-861c-eeb99deaa671");
+    DiscoveryNotifier(m_data, 7U).notify();
+    DiscoveryNotifier(m_data, 9U).notify();
+
+    EXPECT_TRUE(m_sut.timedWait(1_s));
+    // multiple notifications wake up the listener only once
+    EXPECT_FALSE(m_sut.timedWait(1_ms));
+}
+
+TEST_F(DiscoveryNotifier_test, TimedWaitReturnsAfterWakeUpFromAnotherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "48a0a489-9703-46be-99fb-cec09208381d");
+    std::thread waker([&] { m_sut.wakeUp(); });
+
+    EXPECT_TRUE(m_sut.timedWait(1_s));
+    EXPECT_TRUE(collect(0U, DiscoveryNotifierData::CAPACITY).empty());
+    waker.join();
+}
+
+TEST_F(DiscoveryNotifier_test, ForEachNotificationProvidesTheNotifiedIndicesRelativeToTheRange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce753a1a-1a95-499b-95d3-f8edc630671d");
+    DiscoveryNotifier(m_data, 3U).notify();
+    DiscoveryNotifier(m_data, 63U).notify();
+    DiscoveryNotifier(m_data, 64U).notify();
+    DiscoveryNotifier(m_data, 130U).notify();
+
+    EXPECT_THAT(collect(60U, 100U), ElementsAre(3U, 4U, 70U));
+    EXPECT_THAT(collect(0U, 60U), ElementsAre(3U));
+}
+
+TEST_F(DiscoveryNotifier_test, ForEachNotificationResetsOnlyTheNotificationsWithinTheRange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "27453fdc-d73e-46cf-bc36-b78682d380c6");
+    DiscoveryNotifier(m_data, 10U).notify();
+    DiscoveryNotifier(m_data, 20U).notify();
+
+    EXPECT_THAT(collect(15U, 10U), ElementsAre(5U));
+    EXPECT_TRUE(collect(15U, 10U).empty());
+    EXPECT_THAT(collect(0U, 15U), ElementsAre(10U));
+}
+
+TEST_F(DiscoveryNotifier_test, LastIndexCanBeNotified)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "770a07f4-eeab-4187-9cd5-556edaea7fdb");
+    constexpr uint64_t LAST_INDEX{DiscoveryNotifierData::CAPACITY - 1U};
+    DiscoveryNotifier(m_data, LAST_INDEX).notify();
+
+    EXPECT_THAT(collect(0U, DiscoveryNotifierData::CAPACITY), ElementsAre(LAST_INDEX));
+}
+
+TEST_F(DiscoveryNotifier_test, SubscribeOfAnAttachedSubscriberPortNotifiesTheDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "31ec5d5a-b606-4d1a-b854-b1268ce9c794");
+    constexpr uint64_t NOTIFICATION_INDEX{42U};
+    SubscriberOptions options;
+    options.subscribeOnCreate = false;
+    SubscriberPortData portData{{"a", "b", "c"},
+                                "myApp",
+                                iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                options};
+    portData.m_discoveryNotifierDataPtr = &m_data;
+    portData.m_discoveryNotificationIndex = NOTIFICATION_INDEX;
+    SubscriberPortUser subscriber{&portData};
+
+    subscriber.subscribe();
+
+    EXPECT_TRUE(m_sut.timedWait(1_s));
+    EXPECT_THAT(collect(0U, DiscoveryNotifierData::CAPACITY), ElementsAre(NOTIFICATION_INDEX));
+
+    subscriber.destroy();
+
+    EXPECT_THAT(collect(0U, DiscoveryNotifierData::CAPACITY), ElementsAre(NOTIFICATION_INDEX));
+}
+
+} // namespace
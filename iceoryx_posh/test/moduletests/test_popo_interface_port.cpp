@@ -14,7 +14,9 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
+#include "iox/duration.hpp"
 
 #include "test.hpp"
 
@@ -23,6 +25,7 @@ namespace
 using namespace iox;
 using namespace iox::popo;
 using namespace ::testing;
+using namespace iox::units::duration_literals;
 using ::testing::_;
 
 class InterfacePort_test : public Test
@@ -109,4 +112,41 @@ TEST_F(InterfacePort_test, MessageDiscaredIfInterfacesAreEqualWhenInterfacePortI
         ASSERT_FALSE(maybeMessage.has_value());
     }
 }
+
+TEST_F(InterfacePort_test, DispatchingMessageNotifiesConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9580e8f5-dd6b-4a51-8bb4-7f0c972eb3fb");
+    InterfacePortData interfacePortData("", roudi::DEFAULT_UNIQUE_ROUDI_ID, capro::Interfaces::INTERNAL);
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    InterfacePort sut(&interfacePortData);
+
+    sut.setConditionVariable(condVar, 0U);
+    EXPECT_TRUE(sut.isConditionVariableSet());
+    EXPECT_FALSE(sut.hasCaProMessage());
+
+    sut.dispatchCaProMessage(generateMessage(capro::Interfaces::INTERNAL));
+
+    EXPECT_TRUE(sut.hasCaProMessage());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TEST_F(InterfacePort_test, DispatchingMessageDoesNotNotifyUnsetConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5dcacfc4-6e6e-4c32-8676-9efae5d2402c");
+    InterfacePortData interfacePortData("", roudi::DEFAULT_UNIQUE_ROUDI_ID, capro::Interfaces::INTERNAL);
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    InterfacePort sut(&interfacePortData);
+
+    sut.setConditionVariable(condVar, 0U);
+    sut.unsetConditionVariable();
+    EXPECT_FALSE(sut.isConditionVariableSet());
+
+    sut.dispatchCaProMessage(generateMessage(capro::Interfaces::INTERNAL));
+
+    EXPECT_TRUE(sut.hasCaProMessage());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
 } // namespace
@@ -0,0 +1,125 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include "test.hpp"
+
+#include <limits>
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    std::unique_ptr<LatencyHistogram> sut{new LatencyHistogram()};
+};
+
+TEST_F(LatencyHistogram_test, DrainingAnEmptyHistogramReturnsNoValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d44652c7-0220-4527-bdd6-41753efb51a3");
+    const auto snapshot = sut->drain();
+
+    EXPECT_THAT(snapshot.m_numberOfValues, Eq(0U));
+    EXPECT_THAT(snapshot.percentile(0.5), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, SmallValuesAreSortedIntoExactBuckets)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a46c3522-6de7-480a-b1c9-ce5ee21a1981");
+    for (uint64_t value = 0U; value < LatencyHistogram::SUB_BUCKETS_PER_RANGE; ++value)
+    {
+        EXPECT_THAT(LatencyHistogram::bucketIndex(value), Eq(value));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(value)), Eq(value));
+    }
+}
+
+TEST_F(LatencyHistogram_test, BucketIndexIsMonotonicAndUpperBoundContainsTheValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d775501c-61a6-491e-8c57-5f380fdf9388");
+    uint64_t previousIndex{0U};
+    for (uint64_t value = 1U; value < (1ULL << 33U); value = value * 5U / 4U + 1U)
+    {
+        const auto index = LatencyHistogram::bucketIndex(value);
+        EXPECT_THAT(index, Ge(previousIndex));
+        EXPECT_THAT(index, Lt(LatencyHistogram::NUMBER_OF_BUCKETS));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(index), Ge(value));
+        if (index > 0U)
+        {
+            EXPECT_THAT(LatencyHistogram::bucketUpperBound(index - 1U), Lt(value));
+        }
+        previousIndex = index;
+    }
+}
+
+TEST_F(LatencyHistogram_test, RelativeErrorOfTheBucketsIsBounded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d229465f-b8d9-48ff-a386-0ba0ceba2412");
+    for (uint64_t value = LatencyHistogram::SUB_BUCKETS_PER_RANGE; value < (1ULL << 33U); value = value * 3U / 2U)
+    {
+        const auto upperBound = LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(value));
+        EXPECT_THAT(static_cast<double>(upperBound - value) / static_cast<double>(value),
+                    Le(1.0 / static_cast<double>(LatencyHistogram::SUB_BUCKETS_PER_RANGE)));
+    }
+}
+
+TEST_F(LatencyHistogram_test, ValuesBeyondTheLargestRangeAreSortedIntoTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "59118975-87dd-4071-8c35-73804051b9e4");
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()),
+                Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+}
+
+TEST_F(LatencyHistogram_test, PercentilesAreCalculatedFromTheRecordedValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c157509-43be-4abb-a5ae-9a03ee63512c");
+    constexpr uint64_t NUMBER_OF_FAST_VALUES{990U};
+    constexpr uint64_t FAST_VALUE{1000U};
+    constexpr uint64_t SLOW_VALUE{100000U};
+    for (uint64_t i = 0U; i < NUMBER_OF_FAST_VALUES; ++i)
+    {
+        sut->record(FAST_VALUE);
+    }
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        sut->record(SLOW_VALUE);
+    }
+
+    const auto snapshot = sut->drain();
+
+    const auto fastBucketUpperBound = LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(FAST_VALUE));
+    const auto slowBucketUpperBound = LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(SLOW_VALUE));
+    EXPECT_THAT(snapshot.m_numberOfValues, Eq(1000U));
+    EXPECT_THAT(snapshot.percentile(0.5), Eq(fastBucketUpperBound));
+    EXPECT_THAT(snapshot.percentile(0.99), Eq(fastBucketUpperBound));
+    EXPECT_THAT(snapshot.percentile(0.999), Eq(slowBucketUpperBound));
+}
+
+TEST_F(LatencyHistogram_test, DrainResetsTheHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "210c56f3-940f-42a5-9882-14ab3346c67c");
+    sut->record(42U);
+    sut->record(73U);
+
+    EXPECT_THAT(sut->drain().m_numberOfValues, Eq(2U));
+    EXPECT_THAT(sut->drain().m_numberOfValues, Eq(0U));
+}
+
+} // namespace
@@ -133,8 +133,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const uint32_t numberOfCallbackWorkers = 0U) noexcept
+        : Listener(data, numberOfCallbackWorkers)
     {
     }
 };
@@ -1237,4 +1237,166 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
+//////////////////////////////////
+// BEGIN callback workers
+//////////////////////////////////
+TEST_F(Listener_test, ListenerHasNoCallbackWorkersByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "80097a60-a5b5-4e91-a00c-600684c3e44a");
+    EXPECT_THAT(m_sut->numberOfCallbackWorkers(), Eq(0U));
+}
+
+TEST_F(Listener_test, ListenerHasRequestedNumberOfCallbackWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4bebce31-d1a8-46d6-a860-a18c3b2c6ae4");
+    constexpr uint32_t NUMBER_OF_CALLBACK_WORKERS{3U};
+    m_sut.emplace(m_condVarData, NUMBER_OF_CALLBACK_WORKERS);
+    EXPECT_THAT(m_sut->numberOfCallbackWorkers(), Eq(NUMBER_OF_CALLBACK_WORKERS));
+}
+
+TEST_F(Listener_test, NumberOfCallbackWorkersIsClampedToMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3745fe88-1e02-466e-8032-4a2a0d7d352e");
+    m_sut.emplace(m_condVarData, iox::MAX_NUMBER_OF_CALLBACK_WORKERS_PER_LISTENER + 1U);
+    EXPECT_THAT(m_sut->numberOfCallbackWorkers(), Eq(iox::MAX_NUMBER_OF_CALLBACK_WORKERS_PER_LISTENER));
+}
+
+TIMING_TEST_F(Listener_test, CallbackWorkersExecuteCallbacksOfDifferentEventsConcurrently, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "c75836c4-c591-4dc5-b485-2b057e51372e");
+    m_sut.emplace(m_condVarData, 2U);
+    SimpleEventClass fuu;
+    SimpleEventClass bar;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(bar,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    bar.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // both callbacks are running while the first one is still blocked
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_count.load() == 1U);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(2U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source.load() == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_source.load() == &bar);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_count.load() == 1U);
+})
+
+TIMING_TEST_F(Listener_test, CallbackWorkersDoNotExecuteCallbackOfSameEventConcurrently, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "1905e8b3-0098-4a65-8fb8-475c02ef0886");
+    m_sut.emplace(m_condVarData, 4U);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    constexpr uint64_t NUMBER_OF_RETRIGGERS = 10U;
+
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_RETRIGGERS; ++i)
+    {
+        fuu.triggerStoepsel();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1U));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // the idle workers must not execute the callback while it is still blocked
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(NUMBER_OF_RETRIGGERS + 1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source.load() == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 2U);
+})
+
+TIMING_TEST_F(Listener_test, DetachedCallbacksAreNotBeingCalledByCallbackWorkersWhenTriggeredBefore, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "ec847add-1af4-49d2-abb5-ab300f19ccaa");
+    m_sut.emplace(m_condVarData, 1U);
+    SimpleEventClass fuu;
+    SimpleEventClass bar;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(bar,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+
+    // the only worker is blocked in the callback of fuu, therefore the event of bar stays scheduled
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    bar.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    m_sut->detachEvent(bar, SimpleEvent::StoepselBachelorParty);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(2U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_count.load() == 0U);
+})
+//////////////////////////////////
+// END
+//////////////////////////////////
+
+//////////////////////////////////
+// BEGIN spinning
+//////////////////////////////////
+TEST_F(Listener_test, SpinDurationIsZeroByDefaultAndCanBeSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d36eadb8-ac42-4c03-a48a-ed125543d684");
+    EXPECT_THAT(m_sut->spinDuration(), Eq(iox::units::Duration::zero()));
+    m_sut->setSpinDuration(10_us);
+    EXPECT_THAT(m_sut->spinDuration(), Eq(10_us));
+}
+
+TIMING_TEST_F(Listener_test, TriggerWhileListenerSpinsLeadsToCallback, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "9e16ace6-0084-499e-98c2-6b231e45a7d6");
+    m_sut->setSpinDuration(1_s);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    // the first trigger wakes up the listener thread which spins afterwards
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source.load() == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 2U);
+})
+//////////////////////////////////
+// END
+//////////////////////////////////
+
 } // namespace
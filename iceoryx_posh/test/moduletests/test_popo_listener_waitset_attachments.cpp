@@ -228,7 +228,15 @@ TEST_F(ListenerWaitsetAttachments_test, ServiceDiscoveryDestructorCallsTriggerRe
                                       roudi::DEFAULT_UNIQUE_ROUDI_ID,
                                       VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
                                       SubscriberOptions());
-    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&subscriberData));
+    SubscriberPortData changesSubscriberData({SERVICE, INSTANCE, EVENT},
+                                             RUNTIME_NAME,
+                                             roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                             VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                             SubscriberOptions());
+    // the service discovery subscribes to the complete service registry and to the service registry changes
+    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&subscriberData))
+        .WillOnce(Return(&changesSubscriberData));
 
     optional<iox::runtime::ServiceDiscovery> serviceDiscovery;
     serviceDiscovery.emplace();
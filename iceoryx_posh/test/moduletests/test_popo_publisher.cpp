@@ -274,6 +274,30 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, PublishBatchSendsAllSamplesWithASingleCallToTheUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f906fc59-3a78-4dcb-968a-31aa73d7549e");
+    ChunkMock<DummyData> anotherChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::ok(anotherChunkMock.chunkHeader()))));
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks).WillOnce(Invoke([&](auto chunkHeaders) {
+        sentChunkHeaders.assign(chunkHeaders.begin(), chunkHeaders.end());
+    }));
+    EXPECT_CALL(portMock, releaseChunk).Times(0);
+    // ===== Test ===== //
+    std::vector<iox::popo::Sample<DummyData>> samples;
+    samples.emplace_back(std::move(sut.loan().value()));
+    samples.emplace_back(std::move(sut.loan().value()));
+    sut.publishBatch(iox::span<iox::popo::Sample<DummyData>>(samples.data(), samples.size()));
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_EQ(sentChunkHeaders[0], chunkMock.chunkHeader());
+    EXPECT_EQ(sentChunkHeaders[1], anotherChunkMock.chunkHeader());
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -32,6 +32,9 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.chunkCacheSize = 13U;
+    testOptions.stampSendTimestamp = true;
+    testOptions.preferredNumaNode = 3U;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +49,15 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.chunkCacheSize, Ne(defaultOptions.chunkCacheSize));
+            EXPECT_THAT(roundTripOptions.chunkCacheSize, Eq(testOptions.chunkCacheSize));
+
+            EXPECT_THAT(roundTripOptions.stampSendTimestamp, Ne(defaultOptions.stampSendTimestamp));
+            EXPECT_THAT(roundTripOptions.stampSendTimestamp, Eq(testOptions.stampSendTimestamp));
+
+            EXPECT_THAT(roundTripOptions.preferredNumaNode, Ne(defaultOptions.preferredNumaNode));
+            EXPECT_THAT(roundTripOptions.preferredNumaNode, Eq(testOptions.preferredNumaNode));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +78,15 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr uint32_t CHUNK_CACHE_SIZE{0U};
+    constexpr bool STAMP_SEND_TIMESTAMP{false};
 
-    const auto serialized =
-        iox::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::Serialization::create(HISTORY_CAPACITY,
+                                                       NODE_NAME,
+                                                       OFFER_ON_CREATE,
+                                                       SUBSCRIBER_TOO_SLOW_POLICY,
+                                                       CHUNK_CACHE_SIZE,
+                                                       STAMP_SEND_TIMESTAMP);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
@@ -501,6 +501,42 @@ TEST_F(PublisherPort_test, sendWhenSubscribedDeliversAChunk)
     EXPECT_THAT(dummySample.dummy, Eq(17U));
 }
 
+TEST_F(PublisherPort_test, sendChunksWhenSubscribedDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4801639f-85dd-4aa0-b613-9580a1c4752b");
+    m_sutNoOfferOnCreateUserSide.offer();
+    m_sutNoOfferOnCreateRouDiSide.tryGetCaProMessage();
+    ChunkQueueData_t m_chunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                      iox::popo::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
+    iox::capro::CaproMessage caproMessage(iox::capro::CaproMessageType::SUB,
+                                          iox::capro::ServiceDescription("a", "b", "c"));
+    caproMessage.m_chunkQueueData = &m_chunkQueueData;
+    caproMessage.m_historyCapacity = 0U;
+    m_sutNoOfferOnCreateRouDiSide.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_sutNoOfferOnCreateUserSide.tryAllocateChunk(
+            sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        new (maybeChunkHeader.value()->userPayload()) DummySample{17U + i};
+        chunkHeaders[i] = maybeChunkHeader.value();
+    }
+    m_sutNoOfferOnCreateUserSide.sendChunks(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders));
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        auto dummySample = *reinterpret_cast<DummySample*>(maybeSharedChunk->getUserPayload());
+        EXPECT_THAT(dummySample.dummy, Eq(17U + i));
+    }
+    EXPECT_FALSE(m_chunkQueuePopper.tryPop().has_value());
+}
+
 TEST_F(PublisherPort_test, subscribeWithHistoryLikeTheARAField)
 {
     ::testing::Test::RecordProperty("TEST_ID", "12ea9650-c928-4185-8519-be949e2afcf7");
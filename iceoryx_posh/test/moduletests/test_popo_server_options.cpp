@@ -34,6 +34,7 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.offerOnCreate = false;
     testOptions.requestQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.clientTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.concurrentRequestProcessing = true;
 
     iox::popo::ServerOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,6 +52,9 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Ne(defaultOptions.clientTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Eq(testOptions.clientTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.concurrentRequestProcessing, Ne(defaultOptions.concurrentRequestProcessing));
+            EXPECT_THAT(roundTripOptions.concurrentRequestProcessing, Eq(testOptions.concurrentRequestProcessing));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of ServerOptions failed!"; });
 }
@@ -72,9 +76,14 @@ iox::Serialization enumSerialization(QueueFullPolicyUT requsetQueueFullPolicy,
     constexpr uint64_t REQUEST_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
-
-    return iox::Serialization::create(
-        REQUEST_QUEUE_CAPACITY, NODE_NAME, OFFER_ON_CREATE, requsetQueueFullPolicy, clientTooSlowPolicy);
+    constexpr bool CONCURRENT_REQUEST_PROCESSING{false};
+
+    return iox::Serialization::create(REQUEST_QUEUE_CAPACITY,
+                                      NODE_NAME,
+                                      OFFER_ON_CREATE,
+                                      requsetQueueFullPolicy,
+                                      clientTooSlowPolicy,
+                                      CONCURRENT_REQUEST_PROCESSING);
 }
 
 TEST(ServerOptions_test, DeserializingValidRequestQueueFullPolicyAndClientTooSlowPolicyIsSuccessful)
@@ -188,4 +197,16 @@ TEST(ServerOptions_test, ComparisonOperatorReturnsFalseClientTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ServerOptions_test, ComparisonOperatorReturnsFalseConcurrentRequestProcessingDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da1e956b-124b-4302-aafa-95bba9e09291");
+    ServerOptions options1;
+    options1.concurrentRequestProcessing = true;
+    ServerOptions options2;
+    options2.concurrentRequestProcessing = false;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -74,6 +74,7 @@ class ServerPort_test : public Test
         IOX_DISCARD_RESULT(serverPortWithoutOfferOnCreate.portRouDi.tryGetCaProMessage());
         IOX_DISCARD_RESULT(serverOptionsWithBlockProducerRequestQueueFullPolicy.portRouDi.tryGetCaProMessage());
         IOX_DISCARD_RESULT(serverOptionsWithWaitForConsumerClientTooSlowPolicy.portRouDi.tryGetCaProMessage());
+        IOX_DISCARD_RESULT(serverPortWithConcurrentRequestProcessing.portRouDi.tryGetCaProMessage());
     }
 
     void TearDown() override
@@ -217,6 +218,13 @@ class ServerPort_test : public Test
         options.clientTooSlowPolicy = ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
         return options;
     }();
+    ServerOptions m_serverOptionsWithConcurrentRequestProcessing = [&] {
+        ServerOptions options;
+        options.offerOnCreate = true;
+        options.requestQueueCapacity = QUEUE_CAPACITY;
+        options.concurrentRequestProcessing = true;
+        return options;
+    }();
 
     iox::optional<SutServerPort> clientPortForStateTransitionTests;
 
@@ -236,6 +244,8 @@ class ServerPort_test : public Test
         m_serviceDescription, m_runtimeName, m_serverOptionsWithBlockProducerRequestQueueFullPolicy, m_memoryManager};
     SutServerPort serverOptionsWithWaitForConsumerClientTooSlowPolicy{
         m_serviceDescription, m_runtimeName, m_serverOptionsWithWaitForConsumerClientTooSlowPolicy, m_memoryManager};
+    SutServerPort serverPortWithConcurrentRequestProcessing{
+        m_serviceDescription, m_runtimeName, m_serverOptionsWithConcurrentRequestProcessing, m_memoryManager};
 };
 
 } // namespace iox_test_popo_server_port
@@ -19,6 +19,11 @@
 #include "test_popo_server_port_common.hpp"
 
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
+#include "iox/atomic.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 namespace iox_test_popo_server_port
 {
@@ -719,6 +724,80 @@ TEST_F(ServerPort_test, SendResponseWithValidClientQueueIdReleasesDeliversToTheC
 
 // END sendResponse tests
 
+// BEGIN concurrent request processing tests
+
+TEST_F(ServerPort_test, ConcurrentWorkersAnswerEveryRequestExactlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "828232af-41cd-4b9a-bcae-c3a99e8c8e16");
+    auto& sut = serverPortWithConcurrentRequestProcessing;
+    addClientQueue(sut);
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{1000U};
+    constexpr uint32_t NUMBER_OF_WORKERS{iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY};
+    // the requests in flight are limited to prevent an overflow of the request and response queues
+    constexpr uint64_t MAX_REQUESTS_IN_FLIGHT{QUEUE_CAPACITY};
+
+    iox::concurrent::Atomic<bool> keepRunning{true};
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0U; i < NUMBER_OF_WORKERS; ++i)
+    {
+        workers.emplace_back([&] {
+            while (keepRunning.load())
+            {
+                auto requestResult = sut.portUser.getRequest();
+                if (requestResult.has_error())
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                auto* requestHeader = requestResult.value();
+                const auto requestData = getRequestData(requestHeader);
+                sut.portUser.allocateResponse(requestHeader, USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+                    .and_then([&](auto* responseHeader) {
+                        new (ChunkHeader::fromUserHeader(responseHeader)->userPayload()) uint64_t(requestData);
+                        EXPECT_FALSE(sut.portUser.sendResponse(responseHeader).has_error());
+                    })
+                    .or_else([](const auto& error) { GTEST_FAIL() << "Expected a response but got: " << error; });
+                sut.portUser.releaseRequest(requestHeader);
+            }
+        });
+    }
+
+    std::vector<bool> isAnswered(NUMBER_OF_REQUESTS, false);
+    uint64_t numberOfSentRequests{0U};
+    uint64_t numberOfResponses{0U};
+    while (numberOfResponses < NUMBER_OF_REQUESTS)
+    {
+        if (numberOfSentRequests < NUMBER_OF_REQUESTS
+            && numberOfSentRequests - numberOfResponses < MAX_REQUESTS_IN_FLIGHT)
+        {
+            ASSERT_TRUE(pushRequests(sut.requestQueuePusher, 1U, numberOfSentRequests));
+            ++numberOfSentRequests;
+        }
+
+        clientResponseQueue.tryPop().and_then([&](const auto& chunk) {
+            const auto data = *static_cast<const uint64_t*>(chunk.getUserPayload());
+            ASSERT_THAT(data, Lt(NUMBER_OF_REQUESTS));
+            EXPECT_FALSE(isAnswered[data]);
+            isAnswered[data] = true;
+            ++numberOfResponses;
+        });
+    }
+
+    keepRunning = false;
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    EXPECT_THAT(std::count(isAnswered.begin(), isAnswered.end(), true), Eq(NUMBER_OF_REQUESTS));
+    // the chunk sender keeps the last sent response for reuse
+    constexpr uint64_t NUMBER_OF_RESPONSE_CHUNKS{1U};
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_RESPONSE_CHUNKS));
+}
+
+// END concurrent request processing tests
+
 // BEGIN condition variable tests
 
 TEST_F(ServerPort_test, ConditionVariableInitiallyNotSet)
@@ -177,6 +177,71 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeAllProvidesAllTakenChunksWrappedInSamples)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1aba19b-216f-487c-b24b-2efc2761c054");
+    // ===== Setup ===== //
+    const iox::mepoo::ChunkHeader* chunkHeader = chunkMock.chunkHeader();
+    EXPECT_CALL(sut, takeAllChunks)
+        .WillOnce(Invoke([&](auto onChunk) -> iox::expected<uint64_t, iox::popo::ChunkReceiveResult> {
+            onChunk(chunkHeader);
+            return iox::ok<uint64_t>(1U);
+        }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(AtLeast(1));
+    // ===== Test ===== //
+    uint64_t numberOfSamples{0U};
+    auto result = sut.takeAll([&](auto&& sample) {
+        EXPECT_EQ(sample.get(), chunkHeader->userPayload());
+        ++numberOfSamples;
+    });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(1U));
+    EXPECT_THAT(numberOfSamples, Eq(1U));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBatchAppendsTheSamplesTakenViaBaseSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fcc00f46-f270-4ab0-bcd5-a666fe7881d0");
+    // ===== Setup ===== //
+    const iox::mepoo::ChunkHeader* chunkHeader = chunkMock.chunkHeader();
+    constexpr uint64_t CAPACITY{3U};
+    iox::vector<iox::popo::Sample<const DummyData>, CAPACITY> samples;
+    EXPECT_CALL(sut, takeChunks)
+        .WillOnce(Invoke([&](auto maxNumberOfChunks,
+                             auto onChunk) -> iox::expected<uint64_t, iox::popo::ChunkReceiveResult> {
+            EXPECT_THAT(maxNumberOfChunks, Eq(CAPACITY));
+            onChunk(chunkHeader);
+            return iox::ok<uint64_t>(1U);
+        }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(AtLeast(1));
+    // ===== Test ===== //
+    auto result = sut.takeBatch(samples);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(1U));
+    ASSERT_THAT(samples.size(), Eq(1U));
+    EXPECT_EQ(samples[0].get(), chunkHeader->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBatchWithFailingBaseSubscriberReturnsTheError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ea4d9c13-565c-4218-88fa-92b5c024c027");
+    // ===== Setup ===== //
+    iox::vector<iox::popo::Sample<const DummyData>, 2U> samples;
+    EXPECT_CALL(sut, takeChunks)
+        .WillOnce(Return(iox::err(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE)));
+    // ===== Test ===== //
+    auto result = sut.takeBatch(samples);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+    EXPECT_TRUE(samples.empty());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f30fe1ae-046c-48b3-b5cd-b9adbf9b864f");
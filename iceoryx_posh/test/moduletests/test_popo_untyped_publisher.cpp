@@ -137,6 +137,44 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, PublishBatchSendsAllUserPayloadsWithASingleCallToTheUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ff604de-7191-4733-890b-4d5f3acb540b");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> anotherChunkMock;
+    void* userPayloads[] = {chunkMock.chunkHeader()->userPayload(), anotherChunkMock.chunkHeader()->userPayload()};
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks).WillOnce(Invoke([&](auto chunkHeaders) {
+        sentChunkHeaders.assign(chunkHeaders.begin(), chunkHeaders.end());
+    }));
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<void* const>(userPayloads));
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_EQ(sentChunkHeaders[0], chunkMock.chunkHeader());
+    EXPECT_EQ(sentChunkHeaders[1], anotherChunkMock.chunkHeader());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishBatchWithMoreUserPayloadsThanLoanableChunksIsSplit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a89dcb9f-a442-4f2d-af1f-4e1eb49e414f");
+    // ===== Setup ===== //
+    constexpr uint64_t NUMBER_OF_USER_PAYLOADS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U};
+    std::vector<void*> userPayloads(NUMBER_OF_USER_PAYLOADS, chunkMock.chunkHeader()->userPayload());
+    std::vector<uint64_t> batchSizes;
+    EXPECT_CALL(portMock, sendChunks).Times(2).WillRepeatedly(Invoke([&](auto chunkHeaders) {
+        batchSizes.push_back(chunkHeaders.size());
+    }));
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<void* const>(userPayloads.data(), userPayloads.size()));
+    // ===== Verify ===== //
+    ASSERT_THAT(batchSizes.size(), Eq(2U));
+    EXPECT_THAT(batchSizes[0], Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
+    EXPECT_THAT(batchSizes[1], Eq(1U));
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -159,6 +159,50 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeBatchProvidesTheUserPayloadsOfTheTakenChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9684ea8-3ed0-43f5-bea0-10106780ebcb");
+    // ===== Setup ===== //
+    const iox::mepoo::ChunkHeader* chunkHeader = chunkMock.chunkHeader();
+    EXPECT_CALL(sut, takeChunks(3U, _))
+        .WillOnce(Invoke([&](auto, auto onChunk) -> iox::expected<uint64_t, iox::popo::ChunkReceiveResult> {
+            onChunk(chunkHeader);
+            onChunk(chunkHeader);
+            return iox::ok<uint64_t>(2U);
+        }));
+    // ===== Test ===== //
+    const void* userPayloads[3U] = {nullptr, nullptr, nullptr};
+    auto result = sut.takeBatch(iox::span<const void*>(userPayloads, 3U));
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(2U));
+    EXPECT_EQ(userPayloads[0], chunkHeader->userPayload());
+    EXPECT_EQ(userPayloads[1], chunkHeader->userPayload());
+    EXPECT_EQ(userPayloads[2], nullptr);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedSubscriberTest, TakeAllCallsTheCallbackWithTheUserPayloadOfEachChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba5400a6-adfd-4181-ac35-bc1710914628");
+    // ===== Setup ===== //
+    const iox::mepoo::ChunkHeader* chunkHeader = chunkMock.chunkHeader();
+    EXPECT_CALL(sut, takeAllChunks)
+        .WillOnce(Invoke([&](auto onChunk) -> iox::expected<uint64_t, iox::popo::ChunkReceiveResult> {
+            onChunk(chunkHeader);
+            return iox::ok<uint64_t>(1U);
+        }));
+    // ===== Test ===== //
+    std::vector<const void*> userPayloads;
+    auto result = sut.takeAll([&](const void* userPayload) { userPayloads.push_back(userPayload); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(1U));
+    ASSERT_THAT(userPayloads.size(), Eq(1U));
+    EXPECT_EQ(userPayloads[0], chunkHeader->userPayload());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "66c0fb02-aa6d-48dd-8439-754e05cd29af");
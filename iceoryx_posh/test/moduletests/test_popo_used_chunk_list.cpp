@@ -121,6 +121,55 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, InsertBatchInsertsAllProvidedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f95b3385-b83c-42e8-8ac7-e74105f53058");
+    std::vector<SharedChunk> chunks;
+    createMultipleChunks(3U, [&](SharedChunk&& chunk) { chunks.emplace_back(chunk); });
+
+    uint32_t index{0U};
+    auto numberOfInsertedChunks = sut.insertBatch([&]() -> iox::optional<SharedChunk> {
+        if (index < chunks.size())
+        {
+            return chunks[index++];
+        }
+        return iox::nullopt;
+    });
+    EXPECT_THAT(numberOfInsertedChunks, Eq(3U));
+
+    for (auto& chunk : chunks)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+        EXPECT_TRUE(removedChunk == chunk);
+    }
+}
+
+TEST_F(UsedChunkList_test, InsertBatchWithoutChunksInsertsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b87b619-a988-4cc0-927c-b09c6172e84d");
+    auto numberOfInsertedChunks = sut.insertBatch([]() -> iox::optional<SharedChunk> { return iox::nullopt; });
+    EXPECT_THAT(numberOfInsertedChunks, Eq(0U));
+
+    checkIfEmpty();
+}
+
+TEST_F(UsedChunkList_test, InsertBatchStopsRequestingChunksWhenTheListIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af0e26dd-1e46-4c24-b21a-dc803a91e135");
+    EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+
+    uint32_t numberOfRequestedChunks{0U};
+    auto numberOfInsertedChunks = sut.insertBatch([&]() -> iox::optional<SharedChunk> {
+        ++numberOfRequestedChunks;
+        return getChunkFromMemoryManager();
+    });
+    EXPECT_THAT(numberOfInsertedChunks, Eq(USED_CHUNK_LIST_CAPACITY - 1U));
+    EXPECT_THAT(numberOfRequestedChunks, Eq(USED_CHUNK_LIST_CAPACITY - 1U));
+
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
@@ -37,8 +37,10 @@ class VariantQueue_test : public Test
     }
 };
 
-using QueueTypes =
-    Types<std::integral_constant<VariantQueueTypes, VariantQueueTypes::FiFo_MultiProducerSingleConsumer>>;
+using QueueTypes = Types<
+    std::integral_constant<VariantQueueTypes, VariantQueueTypes::FiFo_MultiProducerSingleConsumer>,
+    std::integral_constant<VariantQueueTypes, VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity>,
+    std::integral_constant<VariantQueueTypes, VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity>>;
 
 TYPED_TEST_SUITE(VariantQueue_test, QueueTypes, );
 
@@ -121,4 +123,99 @@ TYPED_TEST(VariantQueue_test, noPopWhenEmpty)
     EXPECT_THAT(sut.pop().has_value(), Eq(false));
 }
 
+TEST(VariantQueueFixedCapacity_test, setCapacityLimitsTheNumberOfElementsOfTheFifo)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c221012e-0b14-4ab3-9fae-1836f1ac50de");
+    VariantQueue<int32_t, 5> sut(VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity);
+    ASSERT_THAT(sut.setCapacity(3U), Eq(true));
+    EXPECT_THAT(sut.capacity(), Eq(3U));
+
+    EXPECT_THAT(sut.push(1).has_value(), Eq(false));
+    EXPECT_THAT(sut.push(2).has_value(), Eq(false));
+    EXPECT_THAT(sut.push(3).has_value(), Eq(false));
+    auto rejectedValue = sut.push(4);
+    ASSERT_THAT(rejectedValue.has_value(), Eq(true));
+    EXPECT_THAT(rejectedValue.value(), Eq(4));
+    EXPECT_THAT(sut.size(), Eq(3U));
+}
+
+TEST(VariantQueueFixedCapacity_test, setCapacityLimitsTheNumberOfElementsOfTheSofi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0add8a6d-c009-4a67-8f6d-e3fdec1a53f8");
+    VariantQueue<int32_t, 5> sut(VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity);
+    ASSERT_THAT(sut.setCapacity(2U), Eq(true));
+
+    sut.push(1);
+    sut.push(2);
+    auto overriddenValue = sut.push(3);
+    ASSERT_THAT(overriddenValue.has_value(), Eq(true));
+    EXPECT_THAT(overriddenValue.value(), Eq(1));
+    EXPECT_THAT(sut.pop().value(), Eq(2));
+    EXPECT_THAT(sut.pop().value(), Eq(3));
+}
+
+TEST(VariantQueueFixedCapacity_test, setCapacityFailsWhenTheQueueIsNotEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "443e5510-2b44-4fab-9af5-1f76beffc3b2");
+    VariantQueue<int32_t, 5> sut(VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity);
+    sut.push(1);
+
+    EXPECT_THAT(sut.setCapacity(3U), Eq(false));
+    EXPECT_THAT(sut.capacity(), Eq(5U));
+}
+
+TEST(VariantQueueFixedCapacity_test, setCapacityFailsWhenTheCapacityExceedsTheMaximumCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "60f4efb8-1238-48c4-a356-47a76a091c15");
+    VariantQueue<int32_t, 5> sut(VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity);
+
+    EXPECT_THAT(sut.setCapacity(6U), Eq(false));
+    EXPECT_THAT(sut.capacity(), Eq(5U));
+}
+
+TEST(VariantQueueFixedCapacity_test, fifoDoesNotAcceptMoreElementsThanItsCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e310b4e0-ee8f-425e-ab03-6bb0182eafcb");
+    VariantQueue<int32_t, 2> sut(VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity);
+    EXPECT_THAT(sut.push(1).has_value(), Eq(false));
+    EXPECT_THAT(sut.push(2).has_value(), Eq(false));
+    auto rejectedValue = sut.push(3);
+    ASSERT_THAT(rejectedValue.has_value(), Eq(true));
+    EXPECT_THAT(rejectedValue.value(), Eq(3));
+    EXPECT_THAT(sut.size(), Eq(2U));
+}
+
+TEST(VariantQueueFixedCapacity_test, sofiOverridesTheOldestElementWhenFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fb49df17-7d2d-4248-b300-54ea88aabb38");
+    VariantQueue<int32_t, 2> sut(VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity);
+    sut.push(1);
+    sut.push(2);
+    auto overriddenValue = sut.push(3);
+    ASSERT_THAT(overriddenValue.has_value(), Eq(true));
+    EXPECT_THAT(overriddenValue.value(), Eq(1));
+    EXPECT_THAT(sut.pop().value(), Eq(2));
+    EXPECT_THAT(sut.pop().value(), Eq(3));
+}
+
+TEST(VariantQueueFixedCapacity_test, fixedCapacityQueueTypeSelectsTheFixedCapacityMultiProducerQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5144edad-59fc-47e3-aab8-2d155b94eca5");
+    using Queue_t = VariantQueue<int32_t, 5>;
+    EXPECT_THAT(Queue_t::fixedCapacityQueueType(VariantQueueTypes::FiFo_MultiProducerSingleConsumer),
+                Eq(VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity));
+    EXPECT_THAT(Queue_t::fixedCapacityQueueType(VariantQueueTypes::SoFi_MultiProducerSingleConsumer),
+                Eq(VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity));
+}
+
+TEST(VariantQueueFixedCapacity_test, fixedCapacityQueueTypeKeepsTheSingleProducerQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8779cefc-3d4d-48c4-abf0-95d6dd8984e3");
+    using Queue_t = VariantQueue<int32_t, 5>;
+    EXPECT_THAT(Queue_t::fixedCapacityQueueType(VariantQueueTypes::FiFo_SingleProducerSingleConsumer),
+                Eq(VariantQueueTypes::FiFo_SingleProducerSingleConsumer));
+    EXPECT_THAT(Queue_t::fixedCapacityQueueType(VariantQueueTypes::SoFi_SingleProducerSingleConsumer),
+                Eq(VariantQueueTypes::SoFi_SingleProducerSingleConsumer));
+}
+
 } // namespace
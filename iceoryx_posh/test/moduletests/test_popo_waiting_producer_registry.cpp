@@ -0,0 +1,163 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/waiting_producer_registry.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class WaitingProducerRegistry_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        for (auto& semaphore : m_semaphores)
+        {
+            iox::build::InterProcessSemaphore::Builder()
+                .initialValue(0U)
+                .isInterProcessCapable(false)
+                .create(semaphore)
+                .expect("Creating a semaphore must not fail");
+        }
+    }
+
+    uint32_t numberOfWakeUps(const uint32_t index)
+    {
+        uint32_t wakeUps{0U};
+        while (m_semaphores[index]->tryWait().expect("Waiting on a semaphore must not fail"))
+        {
+            ++wakeUps;
+        }
+        return wakeUps;
+    }
+
+    static constexpr uint32_t NUMBER_OF_SEMAPHORES{WaitingProducerRegistry::CAPACITY + 1U};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) test only
+    iox::optional<iox::build::InterProcessSemaphore> m_semaphores[NUMBER_OF_SEMAPHORES];
+    WaitingProducerRegistry m_sut;
+};
+
+TEST_F(WaitingProducerRegistry_test, InitiallyHasNoRegisteredProducers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9af804b3-c010-468d-bfc2-12e6af9bee11");
+    EXPECT_FALSE(m_sut.hasRegisteredProducers());
+}
+
+TEST_F(WaitingProducerRegistry_test, RegisteringAndDeregisteringAProducerUpdatesTheRegisteredProducers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "75800468-462f-4121-8bd6-edb2c059ee16");
+    auto slot = m_sut.registerProducer(*m_semaphores[0]);
+    ASSERT_TRUE(slot.has_value());
+    EXPECT_TRUE(m_sut.hasRegisteredProducers());
+
+    m_sut.deregisterProducer(slot.value());
+    EXPECT_FALSE(m_sut.hasRegisteredProducers());
+}
+
+TEST_F(WaitingProducerRegistry_test, RegisteringMoreProducersThanTheCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "47515bb9-3c63-45fe-98c0-c01b58d5eab9");
+    for (uint32_t i = 0U; i < WaitingProducerRegistry::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(m_sut.registerProducer(*m_semaphores[i]).has_value());
+    }
+
+    EXPECT_FALSE(m_sut.registerProducer(*m_semaphores[WaitingProducerRegistry::CAPACITY]).has_value());
+}
+
+TEST_F(WaitingProducerRegistry_test, DeregisteringAProducerFreesTheSlotForAnotherProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e02f359f-ed4c-4125-9cb8-e29a497561b7");
+    iox::optional<uint32_t> slot;
+    for (uint32_t i = 0U; i < WaitingProducerRegistry::CAPACITY; ++i)
+    {
+        slot = m_sut.registerProducer(*m_semaphores[i]);
+        ASSERT_TRUE(slot.has_value());
+    }
+
+    m_sut.deregisterProducer(slot.value());
+
+    EXPECT_TRUE(m_sut.registerProducer(*m_semaphores[WaitingProducerRegistry::CAPACITY]).has_value());
+}
+
+TEST_F(WaitingProducerRegistry_test, WakeUpAllPostsTheSemaphoreOfEveryRegisteredProducerOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41ee87d7-904e-43ae-bdd7-95fdc4104677");
+    for (uint32_t i = 0U; i < WaitingProducerRegistry::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(m_sut.registerProducer(*m_semaphores[i]).has_value());
+    }
+
+    m_sut.wakeUpAll();
+
+    for (uint32_t i = 0U; i < WaitingProducerRegistry::CAPACITY; ++i)
+    {
+        EXPECT_THAT(numberOfWakeUps(i), Eq(1U));
+    }
+    EXPECT_THAT(numberOfWakeUps(WaitingProducerRegistry::CAPACITY), Eq(0U));
+}
+
+TEST_F(WaitingProducerRegistry_test, WakeUpAllDoesNotPostTheSemaphoreOfADeregisteredProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e932789-083e-49bd-a2a8-5f42952f68d4");
+    auto slot = m_sut.registerProducer(*m_semaphores[0]);
+    ASSERT_TRUE(slot.has_value());
+    EXPECT_TRUE(m_sut.registerProducer(*m_semaphores[1]).has_value());
+    m_sut.deregisterProducer(slot.value());
+
+    m_sut.wakeUpAll();
+
+    EXPECT_THAT(numberOfWakeUps(0U), Eq(0U));
+    EXPECT_THAT(numberOfWakeUps(1U), Eq(1U));
+}
+
+TEST_F(WaitingProducerRegistry_test, RemovingAProducerFreesAllItsSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a71c3e95-0d4b-4f62-9e8a-3b5c6d2f1e84");
+
+    ASSERT_TRUE(m_sut.registerProducer(*m_semaphores[0]).has_value());
+    ASSERT_TRUE(m_sut.registerProducer(*m_semaphores[1]).has_value());
+    ASSERT_TRUE(m_sut.registerProducer(*m_semaphores[0]).has_value());
+
+    m_sut.removeProducer(*m_semaphores[0]);
+    m_sut.wakeUpAll();
+
+    EXPECT_TRUE(m_sut.hasRegisteredProducers());
+    EXPECT_THAT(numberOfWakeUps(0U), Eq(0U));
+    EXPECT_THAT(numberOfWakeUps(1U), Eq(1U));
+
+    // the slots of the removed producer are free again
+    for (uint32_t i = 2U; i <= WaitingProducerRegistry::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(m_sut.registerProducer(*m_semaphores[i]).has_value());
+    }
+}
+
+TEST_F(WaitingProducerRegistry_test, RemovingTheLastProducerLeavesNoRegisteredProducers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e8f5b21-6c7a-4d09-8f3e-c4a1b9d07e62");
+
+    ASSERT_TRUE(m_sut.registerProducer(*m_semaphores[0]).has_value());
+
+    m_sut.removeProducer(*m_semaphores[0]);
+
+    EXPECT_FALSE(m_sut.hasRegisteredProducers());
+}
+
+} // namespace
@@ -1823,5 +1823,30 @@ TEST_F(WaitSet_test, WaitSetReturnsAgainIfStateTriggeredBeforeAttachingWithEvent
     EXPECT_TRUE(triggerVector2[0U]->doesOriginateFrom(&m_simpleEvents[0U]));
 }
 
+TEST_F(WaitSet_test, SpinDurationIsZeroByDefaultAndCanBeSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ab06182-0210-4659-8e40-bd750cc9d468");
+    EXPECT_THAT(m_sut->spinDuration(), Eq(iox::units::Duration::zero()));
+    m_sut->setSpinDuration(10_us);
+    EXPECT_THAT(m_sut->spinDuration(), Eq(10_us));
+}
+
+TEST_F(WaitSet_test, WaitWithSpinDurationReturnsTriggeredEvent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7261c86-870b-4eae-bb81-e2fc006ff963");
+    m_sut->setSpinDuration(1_s);
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 42U).has_error());
+
+    std::thread t([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_simpleEvents[0U].trigger();
+    });
+
+    auto triggerVector = m_sut->wait();
+    t.join();
+
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_TRUE(triggerVector[0U]->doesOriginateFrom(&m_simpleEvents[0U]));
+}
 
 } // namespace
@@ -370,9 +370,13 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryChanges{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                                iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                                iox::SERVICE_DISCOVERY_CHANGES_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryChanges);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -855,6 +859,78 @@ TEST_F(PoshRuntime_test, GetMiddlewareConditionVariableListOverflow)
     IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW);
 }
 
+TEST_F(PoshRuntime_test, CreatePortsWithAllPortTypesIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "376f7e23-7fa1-4a01-84eb-a337b62e1498");
+    using iox::runtime::PortRequest;
+
+    const iox::capro::ServiceDescription publisherService("99", "1", "20");
+    const iox::capro::ServiceDescription subscriberService("99", "1", "21");
+    const iox::capro::ServiceDescription clientService("99", "1", "22");
+    const iox::capro::ServiceDescription serverService("99", "1", "23");
+
+    PortRequest requests[] = {PortRequest::publisher(publisherService),
+                              PortRequest::subscriber(subscriberService),
+                              PortRequest::client(clientService),
+                              PortRequest::server(serverService),
+                              PortRequest::conditionVariable()};
+
+    EXPECT_EQ(m_runtime->createPorts(iox::span<PortRequest>(requests)), 5U);
+    IOX_TESTING_EXPECT_OK();
+
+    ASSERT_NE(nullptr, requests[0].publisherPortData());
+    EXPECT_EQ(publisherService, requests[0].publisherPortData()->m_serviceDescription);
+    ASSERT_NE(nullptr, requests[1].subscriberPortData());
+    EXPECT_EQ(subscriberService, requests[1].subscriberPortData()->m_serviceDescription);
+    ASSERT_NE(nullptr, requests[2].clientPortData());
+    EXPECT_EQ(clientService, requests[2].clientPortData()->m_serviceDescription);
+    ASSERT_NE(nullptr, requests[3].serverPortData());
+    EXPECT_EQ(serverService, requests[3].serverPortData()->m_serviceDescription);
+    EXPECT_NE(nullptr, requests[4].conditionVariableData());
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithMoreRequestsThanFitIntoOneMessageCreatesAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3353a3c6-22e0-4ab5-8379-ebf1f3a0097c");
+    using iox::runtime::PortRequest;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{3U * iox::MAX_PORT_REQUESTS_PER_MESSAGE + 1U};
+    std::vector<PortRequest> requests;
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        requests.push_back(PortRequest::subscriber({"SomeLongerServiceName",
+                                                    "SomeLongerInstanceName",
+                                                    into<lossy<iox::capro::IdString_t>>(convert::toString(i))}));
+    }
+
+    EXPECT_EQ(m_runtime->createPorts(iox::span<PortRequest>(requests.data(), requests.size())), NUMBER_OF_REQUESTS);
+    IOX_TESTING_EXPECT_OK();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        ASSERT_NE(nullptr, requests[i].subscriberPortData());
+        EXPECT_EQ(into<lossy<iox::capro::IdString_t>>(convert::toString(i)),
+                  requests[i].subscriberPortData()->m_serviceDescription.getEventIDString());
+    }
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithForbiddenServiceDescriptionCreatesTheRemainingPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5bff241-75b5-46e5-974b-2cf2846a93f8");
+    using iox::runtime::PortRequest;
+
+    PortRequest requests[] = {PortRequest::subscriber({"99", "1", "20"}),
+                              PortRequest::publisher(iox::roudi::IntrospectionPortService),
+                              PortRequest::publisher({"99", "1", "21"})};
+
+    EXPECT_EQ(m_runtime->createPorts(iox::span<PortRequest>(requests)), 2U);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN);
+
+    EXPECT_NE(nullptr, requests[0].subscriberPortData());
+    EXPECT_EQ(nullptr, requests[1].publisherPortData());
+    EXPECT_NE(nullptr, requests[2].publisherPortData());
+}
+
 TEST_F(PoshRuntime_test, ShutdownUnblocksBlockingPublisher)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c3a97770-ee9a-46a4-baf7-80ebbac74f4b");
@@ -181,6 +181,42 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_INVALID_MEMPOOL_FALLBACK_POLICY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    mempool_fallback = "somewhere"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_PREFAULT_THREAD_COUNT = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    prefault_threads = 0
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_NUMA_POLICY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    numa_policy = "everywhere"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,6 +236,12 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_FALLBACK_POLICY,
+                                 CONFIG_INVALID_MEMPOOL_FALLBACK_POLICY},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_PREFAULT_THREAD_COUNT,
+                                 CONFIG_INVALID_PREFAULT_THREAD_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_POLICY,
+                                 CONFIG_INVALID_NUMA_POLICY},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
@@ -218,4 +260,123 @@ TEST_P(RoudiConfigTomlFileProvider_test, ParseMalformedInputFileCausesError)
     EXPECT_EQ(expectedErrorCode, result.error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithoutMemPoolFallbackPolicyResultsInNoFallback)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ead64a54-f53f-4018-9df2-df9c625e136e");
+    std::istringstream stream(R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)");
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value().m_sharedMemorySegments.size(), Eq(1U));
+    EXPECT_THAT(result.value().m_sharedMemorySegments[0].m_mempoolConfig.m_fallbackPolicy,
+                Eq(iox::mepoo::MemPoolFallbackPolicy::NO_FALLBACK));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithNextLargerMemPoolFallbackPolicyIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d144741e-a8b3-4b36-b361-1a0345251693");
+    std::istringstream stream(R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    mempool_fallback = "next_larger"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)");
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value().m_sharedMemorySegments.size(), Eq(1U));
+    EXPECT_THAT(result.value().m_sharedMemorySegments[0].m_mempoolConfig.m_fallbackPolicy,
+                Eq(iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithSharedMemoryOptionsIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36f2ba4e-8571-4e31-9f6b-7e314beab69f");
+    std::istringstream stream(R"(
+    [general]
+    version = 1
+
+    [management]
+    lock_memory = true
+    prefault_threads = 2
+
+    [[segment]]
+    transparent_huge_pages = true
+    prefault_threads = 4
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)");
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& managementOptions = result.value().m_managementSharedMemoryOptions;
+    EXPECT_FALSE(managementOptions.transparentHugePages);
+    EXPECT_TRUE(managementOptions.lockMemory);
+    EXPECT_THAT(managementOptions.prefaultThreadCount, Eq(2U));
+
+    ASSERT_THAT(result.value().m_sharedMemorySegments.size(), Eq(1U));
+    const auto& segmentOptions = result.value().m_sharedMemorySegments[0].m_sharedMemoryOptions;
+    EXPECT_TRUE(segmentOptions.transparentHugePages);
+    EXPECT_FALSE(segmentOptions.lockMemory);
+    EXPECT_THAT(segmentOptions.prefaultThreadCount, Eq(4U));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithNumaPoliciesIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b42ddc69-476a-4119-9800-64e208d67546");
+    std::istringstream stream(R"(
+    [general]
+    version = 1
+
+    [management]
+    numa_policy = "interleave"
+
+    [[segment]]
+    writer = "node0"
+    numa_policy = "bind"
+    numa_node = 0
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+
+    [[segment]]
+    writer = "node1"
+    numa_policy = "bind"
+    numa_node = 1
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)");
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value().m_managementSharedMemoryOptions.numaPolicy, Eq(iox::NumaPolicy::INTERLEAVE));
+
+    ASSERT_THAT(result.value().m_sharedMemorySegments.size(), Eq(2U));
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        const auto& segmentOptions = result.value().m_sharedMemorySegments[i].m_sharedMemoryOptions;
+        EXPECT_THAT(segmentOptions.numaPolicy, Eq(iox::NumaPolicy::BIND));
+        EXPECT_THAT(segmentOptions.numaNode, Eq(i));
+    }
+}
+
 } // namespace
@@ -72,8 +72,14 @@ class SegmentMock
         return iox::PosixGroup::getGroupOfCurrentProcess();
     }
 
+    const iox::mepoo::SharedMemoryOptions& getSharedMemoryOptions() const
+    {
+        return sharedMemoryOptions;
+    }
+
   private:
     MePooMemoryManager_MOCK memoryManager;
+    iox::mepoo::SharedMemoryOptions sharedMemoryOptions;
 };
 
 class SegmentManagerMock
@@ -45,10 +45,18 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPort;
     }
+    void sendSubscriberPortsData()
+    {
+        iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPortsData();
+    }
     iox::optional<PublisherPort>& getPublisherPortThroughput()
     {
         return this->m_publisherPortThroughput;
     }
+    iox::optional<PublisherPort>& getPublisherPortSubscriberPortsData()
+    {
+        return this->m_publisherPortSubscriberPortsData;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -147,6 +155,10 @@ class PortIntrospection_test : public Test
         {
             return false;
         }
+        if (a.recordLatency != b.recordLatency)
+        {
+            return false;
+        }
         if (a.subscribeOnCreate != b.subscribeOnCreate)
         {
             return false;
@@ -510,6 +522,133 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 }
 
 
+TEST_F(PortIntrospection_test, sendThroughputDataContainsTheStatisticsOfThePublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "db2965d4-b9f1-4c3d-8cd3-2d4bb46b95a7");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 1U;
+    iox::popo::PublisherPortData portData(iox::capro::ServiceDescription("a", "b", "c"),
+                                          iox::RuntimeName_t("name"),
+                                          iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                          &memoryManager,
+                                          publisherOptions);
+    ASSERT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    constexpr uint64_t NUMBER_OF_SENT_CHUNKS{42U};
+    constexpr uint64_t USER_PAYLOAD_SIZE{16U};
+    constexpr uint64_t CHUNK_SIZE{128U};
+    constexpr uint64_t SEND_INTERVAL{1000U};
+    constexpr uint64_t NUMBER_OF_LOST_CHUNKS{3U};
+    auto& statistics = portData.m_chunkSenderData.m_statistics;
+    statistics.m_numberOfSentChunks.store(NUMBER_OF_SENT_CHUNKS);
+    statistics.m_numberOfSentUserPayloadBytes.store(NUMBER_OF_SENT_CHUNKS * USER_PAYLOAD_SIZE);
+    statistics.m_lastUserPayloadSize.store(USER_PAYLOAD_SIZE);
+    statistics.m_lastChunkSize.store(CHUNK_SIZE);
+    statistics.m_lastSendIntervalInNanoseconds.store(SEND_INTERVAL);
+    portData.m_chunkSenderData.m_numberOfLostChunks.store(NUMBER_OF_LOST_CHUNKS);
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunk.get()->chunkHeader()))));
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    const auto& throughput = chunk->sample()->m_throughputList[0];
+    EXPECT_THAT(throughput.m_numberOfSentChunks, Eq(NUMBER_OF_SENT_CHUNKS));
+    EXPECT_THAT(throughput.m_numberOfSentBytes, Eq(NUMBER_OF_SENT_CHUNKS * USER_PAYLOAD_SIZE));
+    EXPECT_THAT(throughput.m_sampleSize, Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(throughput.m_chunkSize, Eq(CHUNK_SIZE));
+    EXPECT_THAT(throughput.m_lastSendIntervalInNanoseconds, Eq(SEND_INTERVAL));
+    EXPECT_THAT(throughput.m_numberOfLostChunks, Eq(NUMBER_OF_LOST_CHUNKS));
+    EXPECT_THAT(throughput.m_chunksPerMinute, Gt(0.0));
+    EXPECT_THAT(throughput.m_isField, Eq(true));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendThroughputDataReportsNoRateWithoutNewChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "682383a5-f610-44b1-ad10-4f3fff7de7c8");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData portData(iox::capro::ServiceDescription("a", "b", "c"),
+                                          iox::RuntimeName_t("name"),
+                                          iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                          &memoryManager,
+                                          iox::popo::PublisherOptions());
+    portData.m_chunkSenderData.m_statistics.m_numberOfSentChunks.store(13U);
+    ASSERT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(1);
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_throughputList[0].m_numberOfSentChunks, Eq(13U));
+    EXPECT_THAT(chunk->sample()->m_throughputList[0].m_chunksPerMinute, Eq(0.0));
+    EXPECT_THAT(chunk->sample()->m_throughputList[0].m_isField, Eq(false));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendSubscriberPortsDataContainsTheLatencyPercentilesOfTheSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d67bb67f-389e-4e0c-a0ce-db79384c930a");
+    using Topic = iox::roudi::SubscriberPortChangingIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::popo::SubscriberPortData portData{iox::capro::ServiceDescription("a", "b", "c"),
+                                           iox::RuntimeName_t("name"),
+                                           iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                           iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                           iox::popo::SubscriberOptions()};
+    iox::popo::LatencyHistogram latencyHistogram;
+    portData.m_chunkReceiverData.m_latencyHistogram = &latencyHistogram;
+    ASSERT_THAT(m_introspectionAccess.addSubscriber(portData), Eq(true));
+
+    constexpr uint64_t NUMBER_OF_VALUES{1000U};
+    for (uint64_t i = 1U; i <= NUMBER_OF_VALUES; ++i)
+    {
+        latencyHistogram.record(i * 1000U);
+    }
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunk.get()->chunkHeader()))));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberPortsData().value(), sendChunk(_)).Times(1);
+
+    m_introspectionAccess.sendSubscriberPortsData();
+
+    ASSERT_THAT(chunk->sample()->subscriberPortChangingDataList.size(), Eq(1U));
+    const auto& subscriberData = chunk->sample()->subscriberPortChangingDataList[0];
+    EXPECT_THAT(subscriberData.numberOfLatencySamples, Eq(NUMBER_OF_VALUES));
+    // the percentiles are reported as upper bound of the histogram buckets
+    EXPECT_THAT(subscriberData.latencyP50InNanoseconds, Ge(500U * 1000U));
+    EXPECT_THAT(subscriberData.latencyP50InNanoseconds, Le(500U * 1000U * 9U / 8U));
+    EXPECT_THAT(subscriberData.latencyP99InNanoseconds, Ge(990U * 1000U));
+    EXPECT_THAT(subscriberData.latencyP99InNanoseconds, Le(990U * 1000U * 9U / 8U));
+    EXPECT_THAT(subscriberData.latencyP999InNanoseconds, Ge(subscriberData.latencyP99InNanoseconds));
+    EXPECT_THAT(latencyHistogram.drain().m_numberOfValues, Eq(0U));
+
+    chunk->sample()->~SubscriberPortChangingIntrospectionFieldTopic();
+}
+
 TEST_F(PortIntrospection_test, Thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ae5b252d-0060-4bb7-a193-0c2ae0ebbb7a");
@@ -912,4 +912,38 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, DeleteTerminatedPublisherRemovesItsWaitingRegistrationFromTheSubscriberQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d0b7e2a-3f18-4c9e-b6a1-8e4f2c7d9a03");
+    const iox::RuntimeName_t publisherRuntimeName{"terminated"};
+    PublisherOptions publisherOptions{
+        0U, iox::NodeName_t("node"), true, iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER};
+    SubscriberOptions subscriberOptions{
+        1U, 0U, iox::NodeName_t("node"), true, iox::popo::QueueFullPolicy::BLOCK_PRODUCER};
+    auto publisherData = m_portManager
+                             ->acquirePublisherPortData({"1", "1", "1"},
+                                                        publisherOptions,
+                                                        publisherRuntimeName,
+                                                        m_payloadDataSegmentMemoryManager,
+                                                        PortConfigInfo())
+                             .value();
+    auto subscriberData =
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value();
+    ASSERT_TRUE(publisherData->m_chunkSenderData.m_senderWakeUpSemaphore.has_value());
+
+    // the application of the publisher was terminated while it waited for the full subscriber queue
+    auto& waitingProducers = subscriberData->m_chunkReceiverData.m_waitingProducers;
+    auto& publisherWakeUpSemaphore = *publisherData->m_chunkSenderData.m_senderWakeUpSemaphore;
+    ASSERT_TRUE(waitingProducers.registerProducer(publisherWakeUpSemaphore).has_value());
+    ASSERT_TRUE(waitingProducers.hasRegisteredProducers());
+
+    m_portManager->deletePortsOfProcess(publisherRuntimeName);
+
+    EXPECT_FALSE(waitingProducers.hasRegisteredProducers());
+    // a consumer which takes a chunk must not access the semaphore of the released publisher anymore
+    waitingProducers.wakeUpAll();
+    IOX_TESTING_EXPECT_OK();
+}
+
 } // namespace iox_test_roudi_portmanager
@@ -213,6 +213,34 @@ TEST_F(PortPool_test, RemovePublisherPortIsSuccessful)
     EXPECT_EQ(sut.getPublisherPortDataList().size(), 0U);
 }
 
+TEST_F(PortPool_test, AddPublisherPortWithoutChunkCacheHasNoMemPoolCache)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cdec65a8-4a96-4d28-ac7e-07599ee98d2b");
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+
+    EXPECT_FALSE(publisherPort.value()->m_chunkSenderData.m_memPoolCache);
+    EXPECT_EQ(m_portPoolData.m_memPoolCaches.size(), 0U);
+}
+
+TEST_F(PortPool_test, AddAndRemovePublisherPortWithChunkCacheAcquiresAndReleasesAMemPoolCache)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79124a7b-f3dc-4f96-9529-49f6e08e3482");
+    m_publisherOptions.chunkCacheSize = 4U;
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+
+    ASSERT_TRUE(publisherPort.value()->m_chunkSenderData.m_memPoolCache);
+    EXPECT_TRUE(publisherPort.value()->m_chunkSenderData.m_memPoolCache->isEnabled());
+    EXPECT_EQ(m_portPoolData.m_memPoolCaches.size(), 1U);
+
+    sut.removePublisherPort(publisherPort.value());
+
+    EXPECT_EQ(m_portPoolData.m_memPoolCaches.size(), 0U);
+}
+
 // END PublisherPort tests
 
 // BEGIN SubscriberPort tests
@@ -327,6 +355,31 @@ TEST_F(PortPool_test, RemoveSubscriberPortIsSuccessful)
     EXPECT_EQ(sut.getSubscriberPortDataList().size(), 0U);
 }
 
+TEST_F(PortPool_test, AddSubscriberPortWithoutRecordLatencyHasNoLatencyHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "47761096-f1e9-4d00-a741-20557438b232");
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort.has_error());
+
+    EXPECT_FALSE(subscriberPort.value()->m_chunkReceiverData.m_latencyHistogram);
+    EXPECT_EQ(m_portPoolData.m_latencyHistograms.size(), 0U);
+}
+
+TEST_F(PortPool_test, AddAndRemoveSubscriberPortWithRecordLatencyAcquiresAndReleasesALatencyHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "416cc070-7758-40ba-bb6c-f3160217b6cb");
+    m_subscriberOptions.recordLatency = true;
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort.has_error());
+
+    EXPECT_TRUE(subscriberPort.value()->m_chunkReceiverData.m_latencyHistogram);
+    EXPECT_EQ(m_portPoolData.m_latencyHistograms.size(), 1U);
+
+    sut.removeSubscriberPort(subscriberPort.value());
+
+    EXPECT_EQ(m_portPoolData.m_latencyHistograms.size(), 0U);
+}
+
 // END SubscriberPort tests
 
 // BEGIN ClientPort tests
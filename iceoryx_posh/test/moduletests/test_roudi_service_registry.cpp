@@ -23,6 +23,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -704,6 +705,83 @@ TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
     EXPECT_EQ(filtered[1].serviceDescription, service3);
 }
 
+TYPED_TEST(ServiceRegistry_test, RemainingServicesAreFoundAfterRemovingEveryOtherServiceOfAFullRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b076d4e-219a-4997-968b-905257746fb5");
+    auto makeService = [](const uint64_t i) {
+        return ServiceDescription("Foo", "Bar", iox::into<iox::lossy<IdString_t>>(iox::convert::toString(i)));
+    };
+
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_FALSE(this->sut.add(makeService(i)).has_error());
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+    {
+        this->sut.remove(makeService(i));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        auto service = makeService(i);
+        this->find(service.getServiceIDString(), service.getInstanceIDString(), service.getEventIDString());
+        EXPECT_THAT(this->searchResult.size(), Eq(i % 2U));
+    }
+
+    this->find(IdString_t("Foo"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(CAPACITY / 2U));
+}
+
+TYPED_TEST(ServiceRegistry_test, RemovedSlotsAreReusedAndTheServicesCanBeFoundAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "486d0f08-a3d2-4790-a69c-e9f47a097dbc");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("a", "b", "d");
+    iox::capro::ServiceDescription service3("a", "e", "c");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    this->sut.remove(service1);
+    ASSERT_FALSE(this->sut.add(service3).has_error());
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+
+    this->find(IdString_t("a"), iox::capro::Wildcard, IdString_t("c"));
+
+    ASSERT_THAT(this->searchResult.size(), Eq(2U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service3));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(service1));
+
+    this->find(iox::capro::Wildcard, IdString_t("b"), iox::capro::Wildcard);
+
+    ASSERT_THAT(this->searchResult.size(), Eq(2U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service2));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(service1));
+}
+
+TYPED_TEST(ServiceRegistry_test, CopyOfTheRegistryFindsTheSameServices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3552b85a-b377-48bc-83f6-635479dea11f");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("d", "b", "c");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+
+    // the registry is copied into a chunk to be published to the applications
+    auto copy = std::make_unique<ServiceRegistry>(this->sut.registry);
+    this->sut.remove(service1);
+
+    SearchResult_t searchResult;
+    copy->find(iox::capro::Wildcard, IdString_t("b"), IdString_t("c"), [&](const auto& entry) {
+        searchResult.push_back(entry);
+    });
+
+    ASSERT_THAT(searchResult.size(), Eq(2U));
+    EXPECT_THAT(searchResult[0].serviceDescription, Eq(service1));
+    EXPECT_THAT(searchResult[1].serviceDescription, Eq(service2));
+}
+
 TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueOnInitialCall)
 {
     ::testing::Test::RecordProperty("TEST_ID", "51398abb-53b2-4dce-9267-73f02f9d7574");
@@ -746,4 +824,114 @@ TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueAfterRemo
     EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
 }
 
+TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueAfterRemovingOneOfTwoKindsOfService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4aa6f5d-0870-4c71-86a1-76bc36e16d47");
+
+    iox::capro::ServiceDescription service("a", "a", "a");
+
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    ASSERT_FALSE(this->sut.otherAdd(service).has_error());
+    this->sut.registry.hasDataChangedSinceLastCall();
+
+    this->sut.remove(service);
+
+    EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
+}
+
+TYPED_TEST(ServiceRegistry_test, SequenceNumberIsIncrementedWithEveryModification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d2fa3f1e-a0f8-43a2-af44-809c605a5c03");
+
+    iox::capro::ServiceDescription service("a", "a", "a");
+
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(0U));
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(2U));
+    this->sut.remove(service);
+    this->sut.remove(service);
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(4U));
+}
+
+TYPED_TEST(ServiceRegistry_test, SequenceNumberIsNotIncrementedWhenRemovingUnknownService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a74460a6-3a90-4bf1-854c-84dccae97598");
+
+    this->sut.remove(iox::capro::ServiceDescription("a", "a", "a"));
+
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(0U));
+}
+
+TEST(ServiceRegistryChange_test, ApplyingTheChangesOfARegistryToACopyResultsInTheSameServices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e218be12-da3b-463b-ac9f-2c7c3477d484");
+    using Kind = ServiceRegistryChange::Kind;
+
+    auto origin = std::make_unique<ServiceRegistry>();
+    auto copy = std::make_unique<ServiceRegistry>();
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("d", "b", "c");
+
+    uint64_t sequenceNumber{0U};
+    for (const auto& change : {std::make_pair(Kind::ADD_PUBLISHER, service1),
+                               std::make_pair(Kind::ADD_SERVER, service2),
+                               std::make_pair(Kind::ADD_PUBLISHER, service2),
+                               std::make_pair(Kind::REMOVE_PUBLISHER, service1),
+                               std::make_pair(Kind::REMOVE_SERVER, service2)})
+    {
+        switch (change.first)
+        {
+        case Kind::ADD_PUBLISHER:
+            ASSERT_FALSE(origin->addPublisher(change.second).has_error());
+            break;
+        case Kind::REMOVE_PUBLISHER:
+            origin->removePublisher(change.second);
+            break;
+        case Kind::ADD_SERVER:
+            ASSERT_FALSE(origin->addServer(change.second).has_error());
+            break;
+        case Kind::REMOVE_SERVER:
+            origin->removeServer(change.second);
+            break;
+        }
+        EXPECT_TRUE(copy->applyChange({++sequenceNumber, change.first, change.second}));
+    }
+
+    EXPECT_THAT(copy->sequenceNumber(), Eq(origin->sequenceNumber()));
+    SearchResult_t searchResult;
+    copy->forEach([&](const auto& entry) { searchResult.push_back(entry); });
+    ASSERT_THAT(searchResult.size(), Eq(1U));
+    EXPECT_THAT(searchResult[0].serviceDescription, Eq(service2));
+    EXPECT_THAT(searchResult[0].publisherCount, Eq(1U));
+    EXPECT_THAT(searchResult[0].serverCount, Eq(0U));
+}
+
+TEST(ServiceRegistryChange_test, ApplyingAChangeWhichDoesNotFollowTheCurrentStateFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4577817b-dadc-4ddd-9165-15dcd338e3b7");
+    using Kind = ServiceRegistryChange::Kind;
+
+    auto sut = std::make_unique<ServiceRegistry>();
+    iox::capro::ServiceDescription service("a", "b", "c");
+
+    EXPECT_FALSE(sut->applyChange({2U, Kind::ADD_PUBLISHER, service}));
+    EXPECT_FALSE(sut->applyChange({0U, Kind::ADD_PUBLISHER, service}));
+
+    EXPECT_THAT(sut->sequenceNumber(), Eq(0U));
+    uint64_t numberOfEntries{0U};
+    sut->forEach([&](const auto&) { ++numberOfEntries; });
+    EXPECT_THAT(numberOfEntries, Eq(0U));
+}
+
+TEST(ServiceRegistryChange_test, ApplyingAChangeWithoutEffectOnTheCopyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61ca3e19-fa4c-4f4f-aa47-fefe7dafda1b");
+
+    auto sut = std::make_unique<ServiceRegistry>();
+
+    EXPECT_FALSE(sut->applyChange(
+        {1U, ServiceRegistryChange::Kind::REMOVE_SERVER, iox::capro::ServiceDescription("a", "b", "c")}));
+}
+
 } // namespace
@@ -0,0 +1,153 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/duration.hpp"
+#include "iox/logging.hpp"
+#include "iox/std_string_support.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace iox::units::duration_literals;
+using iox::runtime::IpcMessage;
+using iox::runtime::IpcMessageType;
+
+#if defined(__clang__)
+const std::string compiler = "clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+const std::string compiler = "gcc-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+const std::string compiler = "msvc-" + std::to_string(_MSC_VER);
+#endif
+
+constexpr uint64_t NUMBER_OF_REQUESTS_PER_RUNTIME{4U};
+
+void printResult(const uint32_t numberOfWorkers,
+                 const uint64_t numberOfRuntimes,
+                 const uint64_t numberOfSuccessfulRuntimes,
+                 const uint64_t actualDurationNanoSeconds)
+{
+    // Not using iceoryx logger due to width requirements
+    auto seconds = actualDurationNanoSeconds / iox::units::Duration::NANOSECS_PER_SEC;
+    auto nanosecs = actualDurationNanoSeconds % iox::units::Duration::NANOSECS_PER_SEC;
+    auto nanosecsPerRuntime = (numberOfRuntimes == 0U) ? 0U : actualDurationNanoSeconds / numberOfRuntimes;
+    std::cout << std::setw(16) << compiler << " [ " << std::setw(1) << seconds << "s " << std::setw(9) << nanosecs
+              << "ns ] " << std::setw(4) << numberOfSuccessfulRuntimes << "/" << numberOfRuntimes
+              << " (runtimes) : " << std::setw(9) << nanosecsPerRuntime << " (nanosecs/runtime) : " << std::setw(2)
+              << numberOfWorkers << " worker(s)" << std::endl;
+}
+
+/// @brief acts like the runtime of an application which registers, requests some condition variables and unregisters
+bool runFakeRuntime(const iox::RuntimeName_t& runtimeName)
+{
+    auto ipcInterface = iox::runtime::IpcRuntimeInterface::create(runtimeName, iox::DEFAULT_DOMAIN_ID, 10_s);
+    if (ipcInterface.has_error())
+    {
+        return false;
+    }
+
+    IpcMessage response;
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS_PER_RUNTIME; ++i)
+    {
+        IpcMessage request;
+        request << iox::runtime::IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << runtimeName;
+        if (!ipcInterface->sendRequestToRouDi(request, response, 10_s))
+        {
+            return false;
+        }
+    }
+
+    IpcMessage termination;
+    termination << iox::runtime::IpcMessageTypeToString(IpcMessageType::TERMINATION) << runtimeName;
+    return ipcInterface->sendRequestToRouDi(termination, response, 10_s)
+           && iox::runtime::stringToIpcMessageType(response.getElementAtIndex(0U).c_str())
+                  == IpcMessageType::TERMINATION_ACK;
+}
+
+/// @brief starts all fake runtimes at once, like the applications of a system after a boot, and measures the time
+///        until RouDi processed all of their requests
+void benchmarkConcurrentRegistration(const uint32_t numberOfWorkers, const uint64_t numberOfRuntimes)
+{
+    auto config = iox::roudi_env::MinimalIceoryxConfigBuilder().create();
+    config.runtimeMessageWorkerCount = numberOfWorkers;
+    iox::roudi_env::RouDiEnv roudiEnv{config};
+
+    iox::concurrent::Atomic<bool> start{false};
+    iox::concurrent::Atomic<uint64_t> numberOfSuccessfulRuntimes{0U};
+    std::vector<std::thread> runtimes;
+    for (uint64_t i = 0U; i < numberOfRuntimes; ++i)
+    {
+        runtimes.emplace_back([&, i] {
+            const auto runtimeName =
+                iox::into<iox::lossy<iox::RuntimeName_t>>("bm_runtime_" + iox::convert::toString(i));
+            while (!start)
+            {
+                std::this_thread::yield();
+            }
+            if (runFakeRuntime(runtimeName))
+            {
+                ++numberOfSuccessfulRuntimes;
+            }
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start = true;
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto actualDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+
+    printResult(numberOfWorkers,
+                numberOfRuntimes,
+                numberOfSuccessfulRuntimes.load(),
+                static_cast<uint64_t>(actualDuration.count()));
+}
+} // namespace
+
+int main()
+{
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Warn);
+
+    const uint64_t numberOfRuntimes = std::min<uint64_t>(200U, iox::MAX_PROCESS_NUMBER);
+
+    std::cout << numberOfRuntimes << " runtimes which register concurrently and send " << NUMBER_OF_REQUESTS_PER_RUNTIME
+              << " requests each" << std::endl;
+
+    for (uint32_t numberOfWorkers = 1U; numberOfWorkers <= iox::roudi::MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS;
+         numberOfWorkers *= 2U)
+    {
+        benchmarkConcurrentRegistration(numberOfWorkers, numberOfRuntimes);
+    }
+
+    return 0;
+}
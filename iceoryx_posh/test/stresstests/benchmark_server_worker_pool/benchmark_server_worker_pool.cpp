@@ -0,0 +1,204 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/client.hpp"
+#include "iceoryx_posh/popo/server.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/atomic.hpp"
+#include "iox/duration.hpp"
+#include "iox/logging.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+#if defined(__clang__)
+const std::string compiler = "clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+const std::string compiler = "gcc-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+const std::string compiler = "msvc-" + std::to_string(_MSC_VER);
+#endif
+
+using Client = iox::popo::Client<uint64_t, uint64_t>;
+using Server = iox::popo::Server<uint64_t, uint64_t>;
+
+constexpr uint64_t NUMBER_OF_CLIENTS{8U};
+constexpr uint64_t NUMBER_OF_REQUESTS_PER_CLIENT{2000U};
+/// @brief a client can loan at most MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY requests, therefore it also keeps at most
+///        this number of requests in flight
+constexpr uint64_t REQUESTS_IN_FLIGHT_PER_CLIENT{iox::MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY};
+constexpr std::chrono::microseconds PROCESSING_TIME_PER_REQUEST{10};
+constexpr std::chrono::seconds TIMEOUT{30};
+
+void printResult(const uint32_t numberOfWorkers,
+                 const uint64_t numberOfRequests,
+                 const uint64_t numberOfResponses,
+                 const uint64_t actualDurationNanoSeconds)
+{
+    // Not using iceoryx logger due to width requirements
+    auto seconds = actualDurationNanoSeconds / iox::units::Duration::NANOSECS_PER_SEC;
+    auto nanosecs = actualDurationNanoSeconds % iox::units::Duration::NANOSECS_PER_SEC;
+    uint64_t requestsPerSecond{0U};
+    if (actualDurationNanoSeconds != 0U)
+    {
+        requestsPerSecond = numberOfResponses * iox::units::Duration::NANOSECS_PER_SEC / actualDurationNanoSeconds;
+    }
+    std::cout << std::setw(16) << compiler << " [ " << std::setw(1) << seconds << "s " << std::setw(9) << nanosecs
+              << "ns ] " << std::setw(6) << numberOfResponses << "/" << numberOfRequests
+              << " (responses) : " << std::setw(9) << requestsPerSecond << " (requests/s) : " << std::setw(2)
+              << numberOfWorkers << " worker(s)" << std::endl;
+}
+
+/// @brief emulates the processing of a request which keeps the worker busy, like a computation
+uint64_t processRequest(const uint64_t request)
+{
+    const auto end = std::chrono::steady_clock::now() + PROCESSING_TIME_PER_REQUEST;
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+    return request + 1U;
+}
+
+void runWorker(Server& server, const iox::concurrent::Atomic<bool>& stop)
+{
+    while (!stop)
+    {
+        if (!server.take()
+                 .and_then([&](const auto& request) {
+                     const auto result = processRequest(*request);
+                     server.loan(request).and_then([&](auto& response) {
+                         *response = result;
+                         IOX_DISCARD_RESULT(response.send());
+                     });
+                 })
+                 .has_value())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/// @brief sends the requests and keeps up to REQUESTS_IN_FLIGHT_PER_CLIENT of them in flight
+uint64_t runClient(Client& client, const std::chrono::steady_clock::time_point deadline)
+{
+    uint64_t numberOfSentRequests{0U};
+    uint64_t numberOfResponses{0U};
+    while (numberOfResponses < NUMBER_OF_REQUESTS_PER_CLIENT && std::chrono::steady_clock::now() < deadline)
+    {
+        while (numberOfSentRequests < NUMBER_OF_REQUESTS_PER_CLIENT
+               && numberOfSentRequests - numberOfResponses < REQUESTS_IN_FLIGHT_PER_CLIENT)
+        {
+            bool hasSent{false};
+            client.loan().and_then([&](auto& request) {
+                *request = numberOfSentRequests;
+                hasSent = !request.send().has_error();
+            });
+            if (!hasSent)
+            {
+                break;
+            }
+            ++numberOfSentRequests;
+        }
+
+        if (!client.take().and_then([&](const auto&) { ++numberOfResponses; }).has_value())
+        {
+            std::this_thread::yield();
+        }
+    }
+    return numberOfResponses;
+}
+
+/// @brief all clients send their requests at once to a server which processes them with a pool of workers and
+///        measures the time until all responses are received
+void benchmarkWorkerPool(const uint32_t numberOfWorkers)
+{
+    iox::roudi_env::RouDiEnv roudiEnv{
+        iox::roudi_env::MinimalIceoryxConfigBuilder().payloadChunkCount(1000U).create()};
+    iox::runtime::PoshRuntime::initRuntime("iox-bm-server-worker-pool");
+
+    const iox::capro::ServiceDescription service{"Benchmark", "Server", "WorkerPool"};
+    iox::popo::ServerOptions serverOptions;
+    serverOptions.concurrentRequestProcessing = true;
+    Server server{service, serverOptions};
+
+    std::vector<std::unique_ptr<Client>> clients;
+    for (uint64_t i = 0U; i < NUMBER_OF_CLIENTS; ++i)
+    {
+        clients.emplace_back(new Client(service));
+    }
+    roudiEnv.triggerDiscoveryLoopAndWaitToFinish();
+
+    iox::concurrent::Atomic<bool> stop{false};
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0U; i < numberOfWorkers; ++i)
+    {
+        workers.emplace_back([&] { runWorker(server, stop); });
+    }
+
+    iox::concurrent::Atomic<uint64_t> numberOfResponses{0U};
+    auto begin = std::chrono::steady_clock::now();
+    const auto deadline = begin + TIMEOUT;
+    std::vector<std::thread> clientThreads;
+    for (auto& client : clients)
+    {
+        clientThreads.emplace_back([&] { numberOfResponses += runClient(*client, deadline); });
+    }
+    for (auto& clientThread : clientThreads)
+    {
+        clientThread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto actualDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+
+    stop = true;
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    printResult(numberOfWorkers,
+                NUMBER_OF_CLIENTS * NUMBER_OF_REQUESTS_PER_CLIENT,
+                numberOfResponses.load(),
+                static_cast<uint64_t>(actualDuration.count()));
+}
+} // namespace
+
+int main()
+{
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Warn);
+
+    std::cout << NUMBER_OF_CLIENTS << " clients which send " << NUMBER_OF_REQUESTS_PER_CLIENT << " requests each with "
+              << REQUESTS_IN_FLIGHT_PER_CLIENT << " requests in flight; the processing of a request takes "
+              << PROCESSING_TIME_PER_REQUEST.count() << "us" << std::endl;
+
+    for (uint32_t numberOfWorkers = 1U; numberOfWorkers <= iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
+         numberOfWorkers *= 2U)
+    {
+        benchmarkWorkerPool(numberOfWorkers);
+    }
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
+#include "iox/atomic.hpp"
+#include "iox/duration.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace iox::units::duration_literals;
+using iox::popo::VariantQueueTypes;
+
+#if defined(__clang__)
+const std::string compiler = "clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+const std::string compiler = "gcc-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+const std::string compiler = "msvc-" + std::to_string(_MSC_VER);
+#endif
+
+constexpr uint64_t QUEUE_CAPACITY{iox::MAX_SUBSCRIBER_QUEUE_CAPACITY};
+using Queue_t = iox::popo::VariantQueue<uint64_t, QUEUE_CAPACITY>;
+
+struct QueueUnderTest
+{
+    VariantQueueTypes type;
+    const char* name;
+};
+
+const std::vector<QueueUnderTest> QUEUES_UNDER_TEST{
+    {VariantQueueTypes::FiFo_SingleProducerSingleConsumer, "FiFo_SingleProducerSingleConsumer"},
+    {VariantQueueTypes::FiFo_MultiProducerSingleConsumer, "FiFo_MultiProducerSingleConsumer"},
+    {VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity,
+     "FiFo_MultiProducerSingleConsumer_FixedCapacity"},
+    {VariantQueueTypes::SoFi_SingleProducerSingleConsumer, "SoFi_SingleProducerSingleConsumer"},
+    {VariantQueueTypes::SoFi_MultiProducerSingleConsumer, "SoFi_MultiProducerSingleConsumer"},
+    {VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity,
+     "SoFi_MultiProducerSingleConsumer_FixedCapacity"}};
+
+bool isSingleProducerQueue(const VariantQueueTypes type)
+{
+    return type == VariantQueueTypes::FiFo_SingleProducerSingleConsumer
+           || type == VariantQueueTypes::SoFi_SingleProducerSingleConsumer;
+}
+
+void printResult(const char* queueName,
+                 const uint64_t numberOfProducers,
+                 const uint64_t numberOfTransfers,
+                 const uint64_t actualDurationNanoSeconds)
+{
+    // Not using iceoryx logger due to width requirements
+    auto seconds = actualDurationNanoSeconds / iox::units::Duration::NANOSECS_PER_SEC;
+    auto nanosecs = actualDurationNanoSeconds % iox::units::Duration::NANOSECS_PER_SEC;
+    auto nanosecsPerTransfer = (numberOfTransfers == 0U) ? 0U : actualDurationNanoSeconds / numberOfTransfers;
+    std::cout << std::setw(16) << compiler << " [ " << std::setw(1) << seconds << "s " << std::setw(9) << nanosecs
+              << "ns ] " << std::setw(15) << numberOfTransfers << " (transfers) : " << std::setw(6)
+              << nanosecsPerTransfer << " (nanosecs/transfer) : " << std::setw(2) << numberOfProducers
+              << " producer(s) : " << queueName << std::endl;
+}
+
+/// @brief pushes and pops one element after another from the same thread to measure the pure overhead of the queue
+void benchmarkSingleThreaded(const QueueUnderTest& queueUnderTest, const iox::units::Duration& duration)
+{
+    auto queue = std::make_unique<Queue_t>(queueUnderTest.type);
+
+    iox::concurrent::Atomic<bool> keepRunning{true};
+    uint64_t numberOfTransfers{0U};
+    uint64_t actualDurationNanoSeconds{0U};
+    std::thread t([&] {
+        auto start = std::chrono::system_clock::now();
+        while (keepRunning)
+        {
+            queue->push(numberOfTransfers);
+            if (queue->pop().has_value())
+            {
+                ++numberOfTransfers;
+            }
+        }
+        auto end = std::chrono::system_clock::now();
+        auto actualDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        actualDurationNanoSeconds = static_cast<uint64_t>(actualDuration.count());
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration.toMilliseconds()));
+    keepRunning = false;
+    t.join();
+
+    printResult(queueUnderTest.name, 1U, numberOfTransfers, actualDurationNanoSeconds);
+}
+
+/// @brief lets multiple producers push concurrently while a single consumer pops, like multiple publishers or
+///        clients delivering into the queue of one subscriber or server
+void benchmarkMultiProducer(const QueueUnderTest& queueUnderTest,
+                            const uint64_t numberOfProducers,
+                            const iox::units::Duration& duration)
+{
+    auto queue = std::make_unique<Queue_t>(queueUnderTest.type);
+
+    iox::concurrent::Atomic<bool> keepRunning{true};
+    uint64_t numberOfTransfers{0U};
+    uint64_t actualDurationNanoSeconds{0U};
+
+    std::vector<std::thread> producers;
+    for (uint64_t i = 0U; i < numberOfProducers; ++i)
+    {
+        producers.emplace_back([&, i] {
+            uint64_t value{i};
+            while (keepRunning)
+            {
+                if (!queue->push(value).has_value())
+                {
+                    value += numberOfProducers;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::thread consumer([&] {
+        auto start = std::chrono::system_clock::now();
+        while (keepRunning)
+        {
+            if (queue->pop().has_value())
+            {
+                ++numberOfTransfers;
+            }
+        }
+        auto end = std::chrono::system_clock::now();
+        auto actualDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        actualDurationNanoSeconds = static_cast<uint64_t>(actualDuration.count());
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration.toMilliseconds()));
+    keepRunning = false;
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    consumer.join();
+
+    printResult(queueUnderTest.name, numberOfProducers, numberOfTransfers, actualDurationNanoSeconds);
+}
+} // namespace
+
+int main()
+{
+    constexpr uint64_t MAX_NUMBER_OF_PRODUCERS{4U};
+    const auto duration = 2_s;
+
+    std::cout << "VariantQueue with capacity " << QUEUE_CAPACITY << std::endl;
+
+    std::cout << std::endl << "single threaded push and pop" << std::endl;
+    for (const auto& queueUnderTest : QUEUES_UNDER_TEST)
+    {
+        benchmarkSingleThreaded(queueUnderTest, duration);
+    }
+
+    for (uint64_t numberOfProducers = 1U; numberOfProducers <= MAX_NUMBER_OF_PRODUCERS; numberOfProducers *= 2U)
+    {
+        std::cout << std::endl << numberOfProducers << " producer(s) and one consumer" << std::endl;
+        for (const auto& queueUnderTest : QUEUES_UNDER_TEST)
+        {
+            if (numberOfProducers > 1U && isSingleProducerQueue(queueUnderTest.type))
+            {
+                continue;
+            }
+            benchmarkMultiProducer(queueUnderTest, numberOfProducers, duration);
+        }
+    }
+
+    return 0;
+}
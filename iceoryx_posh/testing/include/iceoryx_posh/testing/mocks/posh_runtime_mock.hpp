@@ -75,6 +75,7 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                 (const iox::capro::Interfaces, const iox::NodeName_t&),
                 (noexcept, override));
     MOCK_METHOD(iox::popo::ConditionVariableData*, getMiddlewareConditionVariable, (), (noexcept, override));
+    MOCK_METHOD(uint64_t, createPorts, (const iox::span<iox::runtime::PortRequest>), (noexcept, override));
     MOCK_METHOD(bool,
                 sendRequestToRouDi,
                 (const iox::runtime::IpcMessage&,
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/popo/subscriber.hpp"
 
 #include <curses.h>
+#include <deque>
 #include <map>
 #include <vector>
 
@@ -46,6 +47,9 @@ static constexpr iox::units::Duration MIN_UPDATE_PERIOD = 500_ms;
 static constexpr iox::units::Duration DEFAULT_UPDATE_PERIOD = 1000_ms;
 static constexpr iox::units::Duration MAX_UPDATE_PERIOD = 10000_ms;
 
+/// @brief number of recent mempool samples the rates are calculated from
+static constexpr uint64_t MEMPOOL_TIME_SERIES_LENGTH{8U};
+
 /// @brief color pairs for terminal printing
 enum class ColorPairs : uint8_t
 {
@@ -132,6 +136,12 @@ class IntrospectionApp
     /// @brief prints table showing current mempool usage
     void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo);
 
+    /// @brief appends the counters of all mempools to the time series and drops the samples which are too old
+    void updateMemPoolTimeSeries(const MemPoolIntrospectionInfoContainer& introspectionInfo);
+
+    /// @brief calculates the rates of a mempool from the oldest and the newest sample of its time series
+    MemPoolRates calculateMemPoolRates(const uint32_t segmentId, const uint64_t memPoolIndex) const;
+
     template <typename Topic>
     iox::unique_ptr<iox::popo::Subscriber<Topic>>
     createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept;
@@ -177,6 +187,9 @@ class IntrospectionApp
 
     /// @brief first pad column to show on the ncurses window
     int32_t xPad{0};
+
+    /// @brief recent counter samples of every mempool, accessed by the segment ID and the mempool index
+    std::map<uint32_t, std::vector<std::deque<MemPoolCounterSample>>> m_memPoolTimeSeries;
 };
 
 } // namespace introspection
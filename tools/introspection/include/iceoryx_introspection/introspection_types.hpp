@@ -45,6 +45,25 @@ struct IntrospectionSelection
     bool port{false};
 };
 
+/// @brief accumulated counters of a mempool at a point in time
+struct MemPoolCounterSample
+{
+    uint64_t timestampInNanoseconds{0};
+    uint64_t allocatedChunks{0};
+    uint64_t freedChunks{0};
+    uint64_t failedAllocations{0};
+    uint64_t spilledChunks{0};
+};
+
+/// @brief rates of the mempool counters in events per second
+struct MemPoolRates
+{
+    double allocatedChunks{0.0};
+    double freedChunks{0.0};
+    double failedAllocations{0.0};
+    double spilledChunks{0.0};
+};
+
 /// @note this contains just pointer to the real data, therefore pay attention to the lifetime of the original data
 struct ComposedPublisherPortData
 {
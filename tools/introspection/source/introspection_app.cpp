@@ -306,22 +306,49 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
 
     wprintw(pad, "Shared memory segment reader group: ");
     prettyPrint(iox::into<std::string>(introspectionInfo.m_readerGroupName), PrettyOptions::bold);
+    wprintw(pad, "\n");
+
+    wprintw(pad, "Shared memory segment NUMA placement: ");
+    switch (introspectionInfo.m_numaPolicy)
+    {
+    case iox::NumaPolicy::BIND:
+        prettyPrint("node " + std::to_string(introspectionInfo.m_numaNode), PrettyOptions::bold);
+        break;
+    case iox::NumaPolicy::INTERLEAVE:
+        prettyPrint("interleaved", PrettyOptions::bold);
+        break;
+    case iox::NumaPolicy::DEFAULT:
+        prettyPrint("default", PrettyOptions::bold);
+        break;
+    }
     wprintw(pad, "\n\n");
 
     constexpr int32_t memPoolWidth{8};
     constexpr int32_t usedchunksWidth{14};
+    constexpr int32_t cachedchunksWidth{7};
     constexpr int32_t numchunksWidth{9};
     constexpr int32_t minFreechunksWidth{9};
+    constexpr int32_t spilledchunksWidth{9};
+    constexpr int32_t rateWidth{10};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
+    wprintw(pad, "%*s |", cachedchunksWidth, "Cached");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
+    wprintw(pad, "%*s |", spilledchunksWidth, "Spilled");
+    wprintw(pad, "%*s |", rateWidth, "Allocs/s");
+    wprintw(pad, "%*s |", rateWidth, "Frees/s");
+    wprintw(pad, "%*s |", rateWidth, "Failed/s");
+    wprintw(pad, "%*s |", rateWidth, "Spills/s");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
     wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad,
+            "--------------------------------------------------"
+            "--------------------------------------------------"
+            "--------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -330,8 +357,15 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
         {
             wprintw(pad, "%*zu |", memPoolWidth, i + 1u);
             wprintw(pad, "%*u |", usedchunksWidth, info.m_usedChunks);
+            wprintw(pad, "%*u |", cachedchunksWidth, info.m_cachedChunks);
             wprintw(pad, "%*u |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*u |", minFreechunksWidth, info.m_minFreeChunks);
+            wprintw(pad, FORMAT_UINT64_T<uint64_t>, spilledchunksWidth, info.m_spilledChunks, " |");
+            const auto rates = calculateMemPoolRates(introspectionInfo.m_id, i);
+            wprintw(pad, "%*.1f |", rateWidth, rates.allocatedChunks);
+            wprintw(pad, "%*.1f |", rateWidth, rates.freedChunks);
+            wprintw(pad, "%*.1f |", rateWidth, rates.failedAllocations);
+            wprintw(pad, "%*.1f |", rateWidth, rates.spilledChunks);
             wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkSizeWidth, info.m_chunkSize, " |");
             wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkPayloadSizeWidth, info.m_chunkPayloadSize, "\n");
         }
@@ -339,6 +373,72 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     wprintw(pad, "\n");
 }
 
+void IntrospectionApp::updateMemPoolTimeSeries(const MemPoolIntrospectionInfoContainer& introspectionInfo)
+{
+    for (const auto& segment : introspectionInfo)
+    {
+        auto& timeSeries = m_memPoolTimeSeries[segment.m_id];
+        timeSeries.resize(segment.m_mempoolInfo.size());
+        for (size_t i = 0u; i < segment.m_mempoolInfo.size(); ++i)
+        {
+            const auto& info = segment.m_mempoolInfo[i];
+            auto& samples = timeSeries[i];
+            // counters which decrease belong to a restarted RouDi and would corrupt the rates
+            if (!samples.empty()
+                && (samples.back().allocatedChunks > info.m_allocatedChunks
+                    || samples.back().freedChunks > info.m_freedChunks
+                    || samples.back().failedAllocations > info.m_failedAllocations
+                    || samples.back().spilledChunks > info.m_spilledChunks))
+            {
+                samples.clear();
+            }
+            samples.push_back({segment.m_timestampInNanoseconds,
+                               info.m_allocatedChunks,
+                               info.m_freedChunks,
+                               info.m_failedAllocations,
+                               info.m_spilledChunks});
+            if (samples.size() > MEMPOOL_TIME_SERIES_LENGTH)
+            {
+                samples.pop_front();
+            }
+        }
+    }
+}
+
+MemPoolRates IntrospectionApp::calculateMemPoolRates(const uint32_t segmentId, const uint64_t memPoolIndex) const
+{
+    MemPoolRates rates;
+    auto timeSeries = m_memPoolTimeSeries.find(segmentId);
+    if (timeSeries == m_memPoolTimeSeries.end() || memPoolIndex >= timeSeries->second.size())
+    {
+        return rates;
+    }
+
+    const auto& samples = timeSeries->second[memPoolIndex];
+    if (samples.size() < 2u)
+    {
+        return rates;
+    }
+
+    const auto& oldest = samples.front();
+    const auto& newest = samples.back();
+    if (newest.timestampInNanoseconds <= oldest.timestampInNanoseconds)
+    {
+        return rates;
+    }
+
+    const auto seconds = static_cast<double>(newest.timestampInNanoseconds - oldest.timestampInNanoseconds)
+                         / static_cast<double>(iox::units::Duration::NANOSECS_PER_SEC);
+    auto rate = [seconds](const uint64_t oldValue, const uint64_t newValue) {
+        return static_cast<double>(newValue - oldValue) / seconds;
+    };
+    rates.allocatedChunks = rate(oldest.allocatedChunks, newest.allocatedChunks);
+    rates.freedChunks = rate(oldest.freedChunks, newest.freedChunks);
+    rates.failedAllocations = rate(oldest.failedAllocations, newest.failedAllocations);
+    rates.spilledChunks = rate(oldest.spilledChunks, newest.spilledChunks);
+    return rates;
+}
+
 void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPublisherPortData>& publisherPortData,
                                                   const std::vector<ComposedSubscriberPortData>& subscriberPortData)
 {
@@ -346,12 +446,15 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     constexpr int32_t instanceWidth{16};
     constexpr int32_t eventWidth{21};
     constexpr int32_t runtimeNameWidth{23};
-    // uncomment once this information is needed
-    // constexpr int32_t sampleSizeWidth{12};
-    // constexpr int32_t chunkSizeWidth{12};
-    // constexpr int32_t chunksWidth{12};
-    // constexpr int32_t intervalWidth{19};
+    constexpr int32_t sampleSizeWidth{12};
+    constexpr int32_t chunkSizeWidth{12};
+    constexpr int32_t chunksWidth{12};
+    constexpr int32_t intervalWidth{19};
+    constexpr int32_t sentChunksWidth{12};
+    constexpr int32_t lostChunksWidth{12};
     constexpr int32_t subscriptionStateWidth{14};
+    constexpr int32_t latencySamplesWidth{10};
+    constexpr int32_t latencyWidth{10};
     // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
     constexpr int32_t scopeWidth{12};
     constexpr int32_t interfaceSourceWidth{8};
@@ -363,26 +466,28 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", instanceWidth, "Instance");
     wprintw(pad, " %*s |", eventWidth, "Event");
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
-    // wprintw(pad, " %*s |", chunksWidth, "Chunks");
-    // wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
+    wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
+    wprintw(pad, " %*s |", chunksWidth, "Chunks");
+    wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", sentChunksWidth, "Sent Chunks");
+    wprintw(pad, " %*s |", lostChunksWidth, "Lost Chunks");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "Src. Itf.");
 
     wprintw(pad, " %*s |", serviceWidth, "");
     wprintw(pad, " %*s |", instanceWidth, "");
     wprintw(pad, " %*s |", eventWidth, "");
     wprintw(pad, " %*s |", runtimeNameWidth, "");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
-    // wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
+    wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", sentChunksWidth, "");
+    wprintw(pad, " %*s |", lostChunksWidth, "");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "");
 
-    wprintw(pad,
-            "---------------------------------------------------------------------------------------------------\n");
+    wprintw(pad, "---------------------------------------------------------------------------------------------------");
+    wprintw(pad, "----------------------------------------------------------------------------------------------\n");
 
     bool needsLineBreak{false};
     uint32_t currentLine{0U};
@@ -419,11 +524,17 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
     for (auto& publisherPort : publisherPortData)
     {
-        // uncomment once this information is needed
-        // std::string m_sampleSize{"n/a"};
-        // std::string m_chunkSize{"n/a"};
-        // std::string m_chunksPerMinute{"n/a"};
-        // std::string sendInterval{"n/a"};
+        const auto& throughput = *publisherPort.throughputData;
+        const std::string sampleSize{std::to_string(throughput.m_sampleSize)};
+        const std::string chunkSize{std::to_string(throughput.m_chunkSize)};
+        std::stringstream chunksPerMinute;
+        chunksPerMinute << std::fixed << std::setprecision(1) << throughput.m_chunksPerMinute;
+        std::stringstream sendInterval;
+        sendInterval << std::fixed << std::setprecision(3)
+                     << static_cast<double>(throughput.m_lastSendIntervalInNanoseconds)
+                            / iox::units::Duration::NANOSECS_PER_MILLISEC;
+        const std::string sentChunks{std::to_string(throughput.m_numberOfSentChunks)};
+        const std::string lostChunks{std::to_string(throughput.m_numberOfLostChunks)};
 
         currentLine = 0;
         do
@@ -443,11 +554,12 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             wprintw(pad,
                     " %s |",
                     printEntry(runtimeNameWidth, iox::into<std::string>(publisherPort.portData->m_name)).c_str());
-            // uncomment once this information is needed
-            // wprintw(pad, " %s |", printEntry(sampleSizeWidth, m_sampleSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunkSizeWidth, m_chunkSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunksWidth, m_chunksPerMinute).c_str());
-            // wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
+            wprintw(pad, " %s |", printEntry(sampleSizeWidth, sampleSize).c_str());
+            wprintw(pad, " %s |", printEntry(chunkSizeWidth, chunkSize).c_str());
+            wprintw(pad, " %s |", printEntry(chunksWidth, chunksPerMinute.str()).c_str());
+            wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval.str()).c_str());
+            wprintw(pad, " %s |", printEntry(sentChunksWidth, sentChunks).c_str());
+            wprintw(pad, " %s |", printEntry(lostChunksWidth, lostChunks).c_str());
             wprintw(
                 pad,
                 " %s\n",
@@ -471,6 +583,10 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
     wprintw(pad, " %*s |", subscriptionStateWidth, "Subscription");
     // wprintw(pad, " %*s |", fifoWidth, "FiFo"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", latencySamplesWidth, "Latency");
+    wprintw(pad, " %*s |", latencyWidth, "p50");
+    wprintw(pad, " %*s |", latencyWidth, "p99");
+    wprintw(pad, " %*s |", latencyWidth, "p99.9");
     wprintw(pad, " %*s\n", scopeWidth, "Propagation");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -479,10 +595,21 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", runtimeNameWidth, "");
     wprintw(pad, " %*s |", subscriptionStateWidth, "State");
     // wprintw(pad, " %*s |", fifoWidth, "size / capacity"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", latencySamplesWidth, "Samples");
+    wprintw(pad, " %*s |", latencyWidth, "[us]");
+    wprintw(pad, " %*s |", latencyWidth, "[us]");
+    wprintw(pad, " %*s |", latencyWidth, "[us]");
     wprintw(pad, " %*s\n", scopeWidth, "scope");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
-    wprintw(pad, "--------------------\n");
+    wprintw(pad, "---------------------------------------------------------------\n");
+
+    auto latencyToString = [](const uint64_t latencyInNanoseconds) -> std::string {
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(1)
+               << static_cast<double>(latencyInNanoseconds) / iox::units::Duration::NANOSECS_PER_MICROSEC;
+        return stream.str();
+    };
 
     auto subscriptionStateToString = [](iox::SubscribeState subState) -> std::string {
         switch (subState)
@@ -539,6 +666,16 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             //{
             // wprintw(pad, " %*s |", fifoWidth, "");
             //}
+            const auto& changingData = *subscriber.subscriberPortChangingData;
+            wprintw(pad,
+                    " %s |",
+                    printEntry(latencySamplesWidth, std::to_string(changingData.numberOfLatencySamples)).c_str());
+            wprintw(
+                pad, " %s |", printEntry(latencyWidth, latencyToString(changingData.latencyP50InNanoseconds)).c_str());
+            wprintw(
+                pad, " %s |", printEntry(latencyWidth, latencyToString(changingData.latencyP99InNanoseconds)).c_str());
+            wprintw(
+                pad, " %s |", printEntry(latencyWidth, latencyToString(changingData.latencyP999InNanoseconds)).c_str());
             wprintw(pad,
                     " %s\n",
                     printEntry(scopeWidth,
@@ -555,6 +692,10 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
         wprintw(pad, " %*s |", runtimeNameWidth, "");
         wprintw(pad, " %*s |", subscriptionStateWidth, "");
         // wprintw(pad, " %*s |", fifoWidth, ""); // uncomment once this information is needed
+        wprintw(pad, " %*s |", latencySamplesWidth, "");
+        wprintw(pad, " %*s |", latencyWidth, "");
+        wprintw(pad, " %*s |", latencyWidth, "");
+        wprintw(pad, " %*s |", latencyWidth, "");
         wprintw(pad, " %*s", scopeWidth, "");
         wprintw(pad, "\n");
     }
@@ -595,7 +736,8 @@ IntrospectionApp::composePublisherPortData(const PortIntrospectionFieldTopic* po
     auto listSize = portData->m_publisherList.size();
     publisherPortData.reserve(static_cast<size_t>(listSize));
 
-    const PortThroughputData dummyThroughputData;
+    // the composed data keeps a pointer to the throughput data, therefore the fallback must outlive this function
+    static const PortThroughputData dummyThroughputData;
 
     auto& m_publisherList = portData->m_publisherList;
     auto& m_throughputList = throughputData->m_throughputList;
@@ -813,7 +955,10 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
         {
             prettyPrint("### MemPool Status ###\n\n", PrettyOptions::highlight);
 
-            memPoolSubscriber->take().and_then([&](auto& sample) { memPoolSample = std::move(sample); });
+            memPoolSubscriber->take().and_then([&](auto& sample) {
+                memPoolSample = std::move(sample);
+                updateMemPoolTimeSeries(*memPoolSample.value().get());
+            });
 
             if (memPoolSample)
             {